@@ -46,6 +46,10 @@ struct client_data {
     std::optional<sstring> ssl_protocol;
     std::optional<sstring> username;
     std::optional<sstring> scheduling_group_name;
+    std::optional<sstring> compression;
+    // The sizes of the responses sent on a compressed connection, before and after compression.
+    std::optional<int64_t> uncompressed_bytes_sent;
+    std::optional<int64_t> compressed_bytes_sent;
 
     sstring stage_str() const { return to_string(connection_stage); }
     sstring client_type_str() const { return to_string(ct); }
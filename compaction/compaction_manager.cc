@@ -560,9 +560,21 @@ class major_compaction_task_executor : public compaction_task_executor, public m
         // those are eligible for major compaction.
         table_state* t = _compacting_table;
         sstables::compaction_strategy cs = t->get_compaction_strategy();
-        sstables::compaction_descriptor descriptor = cs.get_major_compaction_job(*t, _cm.get_candidates(*t));
+        // Repaired and unrepaired sstables are compacted separately, see
+        // compaction_manager::get_sstables_for_compaction().
+        auto candidates = _cm.get_candidates(*t);
+        auto repaired = std::ranges::partition(candidates, std::not_fn(std::mem_fn(&sstables::sstable::is_repaired)));
+        auto repaired_candidates = std::vector<sstables::shared_sstable>(repaired.begin(), repaired.end());
+        candidates.erase(repaired.begin(), repaired.end());
+        sstables::compaction_descriptor descriptor = cs.get_major_compaction_job(*t, std::move(candidates));
         descriptor.gc_check_only_compacting_sstables = _consider_only_existing_data;
         auto compacting = compacting_sstable_registration(_cm, _cm.get_compaction_state(t), descriptor.sstables);
+        std::optional<sstables::compaction_descriptor> repaired_descriptor;
+        if (!repaired_candidates.empty()) {
+            repaired_descriptor = cs.get_major_compaction_job(*t, std::move(repaired_candidates));
+            repaired_descriptor->gc_check_only_compacting_sstables = _consider_only_existing_data;
+            compacting.register_compacting(repaired_descriptor->sstables);
+        }
         auto on_replace = compacting.update_on_sstable_replacement();
         setup_new_compaction(descriptor.run_identifier);
 
@@ -585,6 +597,12 @@ class major_compaction_task_executor : public compaction_task_executor, public m
 
         finish_compaction();
 
+        if (repaired_descriptor && !_compaction_data.is_stop_requested()) {
+            setup_new_compaction(repaired_descriptor->run_identifier);
+            co_await compact_sstables_and_update_history(std::move(*repaired_descriptor), _compaction_data, on_replace);
+            finish_compaction();
+        }
+
         co_return std::nullopt;
     }
 };
@@ -746,6 +764,19 @@ compaction_manager::run_with_compaction_disabled(table_state& t, std::function<f
     co_await func();
 }
 
+future<>
+compaction_manager::run_with_sstables_compacting(std::vector<sstables::shared_sstable> sstables,
+        noncopyable_function<future<> (const std::vector<sstables::shared_sstable>&)> func) {
+    std::erase_if(sstables, [this] (const sstables::shared_sstable& sst) {
+        return _compacting_sstables.contains(sst);
+    });
+    register_compacting_sstables(sstables);
+    auto deregister = defer([this, &sstables] () noexcept {
+        deregister_compacting_sstables(sstables);
+    });
+    co_await func(sstables);
+}
+
 auto fmt::formatter<compaction::compaction_task_executor::state>::format(compaction::compaction_task_executor::state s,
                                                                          fmt::format_context& ctx) const -> decltype(ctx.out()) {
     std::string_view name;
@@ -899,8 +930,13 @@ sstables::compaction_stopped_exception compaction_task_executor::make_compaction
 
 class compaction_manager::strategy_control : public compaction::strategy_control {
     compaction_manager& _cm;
+    // If engaged, only the sstables which are (or aren't) repaired are candidates.
+    std::optional<bool> _repaired;
 public:
-    explicit strategy_control(compaction_manager& cm) noexcept : _cm(cm) {}
+    explicit strategy_control(compaction_manager& cm, std::optional<bool> repaired = std::nullopt) noexcept
+        : _cm(cm)
+        , _repaired(repaired)
+    {}
 
     bool has_ongoing_compaction(table_state& table_s) const noexcept override {
         return std::any_of(_cm._tasks.begin(), _cm._tasks.end(), [&s = table_s.schema()] (const compaction_task_executor& task) {
@@ -911,14 +947,41 @@ class compaction_manager::strategy_control : public compaction::strategy_control
     }
 
     std::vector<sstables::shared_sstable> candidates(table_state& t) const override {
-        return _cm.get_candidates(t, *t.main_sstable_set().all());
+        auto candidates = _cm.get_candidates(t, *t.main_sstable_set().all());
+        if (_repaired) {
+            std::erase_if(candidates, [this] (const sstables::shared_sstable& sst) {
+                return sst->is_repaired() != *_repaired;
+            });
+        }
+        return candidates;
     }
 
     std::vector<sstables::frozen_sstable_run> candidates_as_runs(table_state& t) const override {
-        return _cm.get_candidates(t, t.main_sstable_set().all_sstable_runs());
+        auto candidates = _cm.get_candidates(t, t.main_sstable_set().all_sstable_runs());
+        if (_repaired) {
+            std::erase_if(candidates, [this] (const sstables::frozen_sstable_run& run) {
+                return std::ranges::all_of(run->all(), std::mem_fn(&sstables::sstable::is_repaired)) != *_repaired;
+            });
+        }
+        return candidates;
     }
 };
 
+sstables::compaction_descriptor compaction_manager::get_sstables_for_compaction(table_state& t) {
+    // Repaired and unrepaired sstables are never compacted together, so that
+    // the repaired data stays repaired and incremental repair doesn't have to
+    // read it again. Unrepaired sstables are compacted first.
+    auto& cs = t.get_compaction_strategy();
+    for (bool repaired : {false, true}) {
+        auto control = strategy_control(*this, repaired);
+        auto descriptor = cs.get_sstables_for_compaction(t, control);
+        if (!descriptor.sstables.empty()) {
+            return descriptor;
+        }
+    }
+    return sstables::compaction_descriptor();
+}
+
 compaction_manager::compaction_manager(config cfg, abort_source& as, tasks::task_manager& tm)
     : _task_manager_module(make_shared<task_manager_module>(tm))
     , _cfg(std::move(cfg))
@@ -1272,8 +1335,7 @@ class regular_compaction_task_executor : public compaction_task_executor, public
             }
 
             table_state& t = *_compacting_table;
-            sstables::compaction_strategy cs = t.get_compaction_strategy();
-            sstables::compaction_descriptor descriptor = cs.get_sstables_for_compaction(t, _cm.get_strategy_control());
+            sstables::compaction_descriptor descriptor = _cm.get_sstables_for_compaction(t);
             int weight = calculate_weight(descriptor);
 
             if (descriptor.sstables.empty() || !can_proceed() || t.is_auto_compaction_disabled_by_user()) {
@@ -1361,8 +1423,7 @@ future<> compaction_manager::maybe_wait_for_sstable_count_reduction(table_state&
         co_return;
     }
     auto num_runs_for_compaction = [&, this] {
-        auto& cs = t.get_compaction_strategy();
-        auto desc = cs.get_sstables_for_compaction(t, get_strategy_control());
+        auto desc = get_sstables_for_compaction(t);
         return std::ranges::size(desc.sstables
             | std::views::transform(std::mem_fn(&sstables::sstable::run_identifier))
             | std::ranges::to<std::unordered_set>());
@@ -390,6 +390,12 @@ class compaction_manager {
     // Run a function with compaction temporarily disabled for a table T.
     future<> run_with_compaction_disabled(compaction::table_state& t, std::function<future<> ()> func);
 
+    // Run a function on the sstables which aren't being compacted, with them
+    // registered as compacting, so that no compaction picks them until the
+    // function completes. The others are left out.
+    future<> run_with_sstables_compacting(std::vector<sstables::shared_sstable> sstables,
+            noncopyable_function<future<> (const std::vector<sstables::shared_sstable>&)> func);
+
     void plug_system_keyspace(db::system_keyspace& sys_ks) noexcept;
     void unplug_system_keyspace() noexcept;
 
@@ -434,6 +440,9 @@ class compaction_manager {
 
     compaction::strategy_control& get_strategy_control() const noexcept;
 
+    // Returns the next regular compaction job of the table, if any.
+    sstables::compaction_descriptor get_sstables_for_compaction(compaction::table_state& t);
+
     tombstone_gc_state& get_tombstone_gc_state() noexcept {
         return _tombstone_gc_state;
     };
@@ -516,6 +516,7 @@ scylla_tests = set([
     'test/boost/managed_bytes_test',
     'test/boost/managed_vector_test',
     'test/boost/map_difference_test',
+    'test/boost/messaging_service_test',
     'test/boost/murmur_hash_test',
     'test/boost/mutation_fragment_test',
     'test/boost/mutation_query_test',
@@ -559,6 +560,7 @@ scylla_tests = set([
     'test/boost/string_format_test',
     'test/boost/summary_test',
     'test/boost/tagged_integer_test',
+    'test/boost/tdigest_test',
     'test/boost/token_metadata_test',
     'test/boost/top_k_test',
     'test/boost/transport_test',
@@ -606,6 +608,7 @@ perf_tests = set([
     'test/perf/perf_vint',
     'test/perf/perf_big_decimal',
     'test/perf/perf_sort_by_proximity',
+    'test/perf/perf_like_matcher',
 ])
 
 raft_tests = set([
@@ -769,6 +772,8 @@ scylla_core = (['message/messaging_service.cc',
                 'replica/exceptions.cc',
                 'replica/dirty_memory_manager.cc',
                 'replica/mutation_dump.cc',
+                'replica/query_result_cache.cc',
+                'replica/counter_shard_cache.cc',
                 'mutation/atomic_cell.cc',
                 'mutation/canonical_mutation.cc',
                 'mutation/frozen_mutation.cc',
@@ -858,6 +863,7 @@ scylla_core = (['message/messaging_service.cc',
                 'transport/server.cc',
                 'transport/controller.cc',
                 'transport/messages/result_message.cc',
+                'transport/zstd_compressor.cc',
                 'cdc/cdc_partitioner.cc',
                 'cdc/log.cc',
                 'cdc/split.cc',
@@ -875,6 +881,7 @@ scylla_core = (['message/messaging_service.cc',
                 'cql3/sets.cc',
                 'cql3/maps.cc',
                 'cql3/values.cc',
+                'cql3/expr/compiled_filter.cc',
                 'cql3/expr/expression.cc',
                 'cql3/expr/restrictions.cc',
                 'cql3/expr/prepare_expr.cc',
@@ -954,6 +961,7 @@ scylla_core = (['message/messaging_service.cc',
                 'service/migration_manager.cc',
                 'service/tablet_allocator.cc',
                 'service/storage_proxy.cc',
+                'service/replica_load_tracker.cc',
                 'query_ranges_to_vnodes.cc',
                 'service/mapreduce_service.cc',
                 'service/paxos/proposal.cc',
@@ -1090,6 +1098,7 @@ scylla_core = (['message/messaging_service.cc',
                 'streaming/stream_result_future.cc',
                 'streaming/stream_session_state.cc',
                 'streaming/consumer.cc',
+                'streaming/stream_blob.cc',
                 'clocks-impl.cc',
                 'partition_slice_builder.cc',
                 'init.cc',
@@ -1485,6 +1494,7 @@ deps['test/boost/combined_tests'] += [
     'test/boost/error_injection_test.cc',
     'test/boost/extensions_test.cc',
     'test/boost/filtering_test.cc',
+    'test/boost/gossiper_test.cc',
     'test/boost/group0_cmd_merge_test.cc',
     'test/boost/group0_test.cc',
     'test/boost/index_with_paging_test.cc',
@@ -1546,6 +1556,7 @@ deps['test/boost/allocation_strategy_test'] = ['test/boost/allocation_strategy_t
 deps['test/boost/log_heap_test'] = ['test/boost/log_heap_test.cc']
 deps['test/boost/estimated_histogram_test'] = ['test/boost/estimated_histogram_test.cc']
 deps['test/boost/summary_test'] = ['test/boost/summary_test.cc']
+deps['test/boost/tdigest_test'] = ['test/boost/tdigest_test.cc']
 deps['test/boost/anchorless_list_test'] = ['test/boost/anchorless_list_test.cc']
 deps['test/perf/perf_commitlog'] += ['test/perf/perf.cc', 'seastar/tests/perf/linux_perf_event.cc']
 deps['test/perf/perf_row_cache_reads'] += ['test/perf/perf.cc', 'seastar/tests/perf/linux_perf_event.cc']
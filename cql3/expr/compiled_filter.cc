@@ -0,0 +1,149 @@
+// Copyright (C) 2025-present ScyllaDB
+// SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+
+#include "compiled_filter.hh"
+
+#include "cql3/expr/evaluate.hh"
+#include "cql3/expr/expr-utils.hh"
+#include "cql3/selection/selection.hh"
+#include "types/types.hh"
+
+namespace cql3::expr {
+
+namespace {
+
+bool is_compilable_op(oper_t op) {
+    switch (op) {
+    case oper_t::EQ:
+    case oper_t::NEQ:
+    case oper_t::LT:
+    case oper_t::LTE:
+    case oper_t::GT:
+    case oper_t::GTE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+struct compiled_column {
+    compiled_filter::column_source source;
+    uint32_t index;
+};
+
+std::optional<compiled_column> compile_column(const column_definition& cdef, const selection::selection& selection) {
+    switch (cdef.kind) {
+    case column_kind::partition_key:
+        return compiled_column{compiled_filter::column_source::partition_key, cdef.id};
+    case column_kind::clustering_key:
+        return compiled_column{compiled_filter::column_source::clustering_key, cdef.id};
+    case column_kind::static_column:
+    case column_kind::regular_column: {
+        auto index = selection.index_of(cdef);
+        if (index == -1) {
+            // Let the generic evaluation report the error, if the row is ever evaluated.
+            return std::nullopt;
+        }
+        return compiled_column{compiled_filter::column_source::static_and_regular_columns, uint32_t(index)};
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+// Returns the bytes of the compared column in the evaluated row, without copying them.
+std::optional<managed_bytes_view> column_view(const compiled_filter::comparison& c, const evaluation_inputs& inputs) {
+    switch (c.source) {
+    case compiled_filter::column_source::partition_key:
+        return managed_bytes_view(bytes_view(inputs.partition_key[c.index]));
+    case compiled_filter::column_source::clustering_key:
+        if (c.index >= inputs.clustering_key.size()) {
+            // partial clustering key, or a static row
+            return std::nullopt;
+        }
+        return managed_bytes_view(bytes_view(inputs.clustering_key[c.index]));
+    case compiled_filter::column_source::static_and_regular_columns: {
+        const auto& v = inputs.static_and_regular_columns[c.index];
+        if (!v) {
+            return std::nullopt;
+        }
+        return managed_bytes_view(*v);
+    }
+    }
+    std::abort();
+}
+
+bool compare(const compiled_filter::comparison& c, managed_bytes_view lhs) {
+    switch (c.op) {
+    case oper_t::EQ:
+        return c.type->equal(lhs, managed_bytes_view(c.value));
+    case oper_t::NEQ:
+        return !c.type->equal(lhs, managed_bytes_view(c.value));
+    case oper_t::LT:
+        return c.type->compare(lhs, managed_bytes_view(c.value)) < 0;
+    case oper_t::LTE:
+        return c.type->compare(lhs, managed_bytes_view(c.value)) <= 0;
+    case oper_t::GT:
+        return c.type->compare(lhs, managed_bytes_view(c.value)) > 0;
+    case oper_t::GTE:
+        return c.type->compare(lhs, managed_bytes_view(c.value)) >= 0;
+    default:
+        std::abort();
+    }
+}
+
+} // anonymous namespace
+
+compiled_filter::compiled_filter(const expression& filter, const selection::selection& selection, const query_options& options) {
+    std::vector<expression> residual;
+    for (auto& factor : boolean_factors(filter)) {
+        auto binop = as_if<binary_operator>(&factor);
+        auto col = binop ? as_if<column_value>(&binop->lhs) : nullptr;
+        if (!binop
+                || !col
+                || !is_compilable_op(binop->op)
+                || binop->order != comparison_order::cql
+                || binop->null_handling != null_handling_style::sql
+                || col->col->type->is_multi_cell()
+                || !(is<constant>(binop->rhs) || is<bind_variable>(binop->rhs))) {
+            residual.push_back(std::move(factor));
+            continue;
+        }
+        auto compiled_col = compile_column(*col->col, selection);
+        if (!compiled_col) {
+            residual.push_back(std::move(factor));
+            continue;
+        }
+        auto value = evaluate(binop->rhs, options).to_managed_bytes_opt();
+        if (!value) {
+            // With SQL null handling, a comparison with NULL is never true.
+            _never_satisfied = true;
+            continue;
+        }
+        _comparisons.push_back(comparison{
+            .source = compiled_col->source,
+            .index = compiled_col->index,
+            .op = binop->op,
+            .type = &col->col->type->without_reversed(),
+            .value = std::move(*value),
+        });
+    }
+    if (!residual.empty()) {
+        _residual = residual.size() == 1 ? std::move(residual.front()) : expression(conjunction{std::move(residual)});
+    }
+}
+
+bool compiled_filter::is_satisfied_by(const evaluation_inputs& inputs) const {
+    if (_never_satisfied) {
+        return false;
+    }
+    for (const auto& c : _comparisons) {
+        auto lhs = column_view(c, inputs);
+        if (!lhs || !compare(c, *lhs)) {
+            return false;
+        }
+    }
+    return !_residual || expr::is_satisfied_by(*_residual, inputs);
+}
+
+} // namespace cql3::expr
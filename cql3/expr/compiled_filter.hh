@@ -0,0 +1,77 @@
+// Copyright (C) 2025-present ScyllaDB
+// SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+
+#pragma once
+
+#include "expression.hh"
+
+#include "bytes.hh"
+#include "utils/managed_bytes.hh"
+
+namespace cql3 {
+
+class query_options;
+
+namespace selection {
+    class selection;
+} // namespace selection
+
+} // namespace cql3
+
+namespace cql3::expr {
+
+struct evaluation_inputs;
+
+// A filtering expression, flattened into a list of comparisons between a
+// column and a value which is known before the rows are read.
+//
+// Evaluating a filter with is_satisfied_by() walks the expression tree for
+// every row, copies the compared column values and bind variables, and looks
+// up regular columns in the selection by a linear search. For the common
+// restrictions of the form `col <op> value` (with op being one of =, !=, <,
+// <=, >, >=), all of that can be done once per query instead: the value is
+// evaluated up front, the column is resolved to its position in the row, and
+// the row's bytes are compared in place with the column type's comparator.
+//
+// Factors which can't be compiled this way are kept as a residual expression
+// and evaluated the regular way, after the compiled comparisons pass.
+class compiled_filter {
+public:
+    enum class column_source : uint8_t {
+        partition_key,
+        clustering_key,
+        static_and_regular_columns,
+    };
+
+    struct comparison {
+        column_source source;
+        // Position of the column in the evaluation_inputs member selected by `source`.
+        uint32_t index;
+        oper_t op;
+        const abstract_type* type;
+        managed_bytes value;
+    };
+private:
+    std::vector<comparison> _comparisons;
+    std::optional<expression> _residual;
+    // Set if a compared value is NULL, in which case no row can match.
+    bool _never_satisfied = false;
+public:
+    // Compiles `filter` for rows produced by `selection`, using the bind
+    // variables from `options`. The result is only valid for these options.
+    compiled_filter(const expression& filter, const selection::selection& selection, const query_options& options);
+
+    // Equivalent to is_satisfied_by(filter, inputs) for the filter this
+    // object was compiled from.
+    bool is_satisfied_by(const evaluation_inputs& inputs) const;
+
+    const std::vector<comparison>& comparisons() const {
+        return _comparisons;
+    }
+
+    const std::optional<expression>& residual() const {
+        return _residual;
+    }
+};
+
+} // namespace cql3::expr
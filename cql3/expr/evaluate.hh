@@ -35,5 +35,12 @@ cql3::raw_value evaluate(const expression& e, const evaluation_inputs&);
 
 cql3::raw_value evaluate(const expression& e, const query_options&);
 
+// Evaluates `step`, an entry of split_aggregation()'s inner loop, and stores the
+// result in temporaries[index]. `inputs.temporaries` must view `temporaries`.
+// If the step reads the aggregation state from temporaries[index], the state is
+// moved into the step function instead of copied, so that the function can
+// update it in place.
+void evaluate_aggregation_step(const expression& step, std::span<cql3::raw_value> temporaries, size_t index, const evaluation_inputs& inputs);
+
 
 }
@@ -1602,6 +1602,23 @@ static cql3::raw_value do_evaluate(const usertype_constructor& user_val, const e
     return val_bytes;
 }
 
+static cql3::raw_value function_result_to_raw_value(const functions::scalar_function& scalar_fun, bytes_opt result) {
+    if (!result.has_value()) {
+        return cql3::raw_value::make_null();
+    }
+
+    try {
+        scalar_fun.return_type()->validate(*result);
+    } catch (marshal_exception&) {
+        throw runtime_exception(fmt::format("Return of function {} ({}) is not a valid value for its declared return type {}",
+                                       scalar_fun, to_hex(result),
+                                       scalar_fun.return_type()->as_cql3_type()
+                                       ));
+    }
+
+    return raw_value::make_value(std::move(*result));
+}
+
 static cql3::raw_value do_evaluate(const function_call& fun_call, const evaluation_inputs& inputs) {
     const shared_ptr<functions::function>* fun = std::get_if<shared_ptr<functions::function>>(&fun_call.func);
     if (fun == nullptr) {
@@ -1620,7 +1637,7 @@ static cql3::raw_value do_evaluate(const function_call& fun_call, const evaluati
     for (const expression& arg : fun_call.args) {
         cql3::raw_value arg_val = evaluate(arg, inputs);
 
-        arguments.emplace_back(to_bytes_opt(std::move(arg_val)));
+        arguments.emplace_back(std::move(arg_val).to_bytes_opt());
     }
 
     bool has_cache_id = fun_call.lwt_cache_id.get() != nullptr && fun_call.lwt_cache_id->has_value();
@@ -1638,20 +1655,30 @@ static cql3::raw_value do_evaluate(const function_call& fun_call, const evaluati
         inputs.options->cache_pk_function_call(**fun_call.lwt_cache_id, result);
     }
 
-    if (!result.has_value()) {
-        return cql3::raw_value::make_null();
+    return function_result_to_raw_value(*scalar_fun, std::move(result));
+}
+
+void evaluate_aggregation_step(const expression& step, std::span<cql3::raw_value> temporaries, size_t index, const evaluation_inputs& inputs) {
+    auto fun_call = as_if<function_call>(&step);
+    auto fun = fun_call ? std::get_if<shared_ptr<functions::function>>(&fun_call->func) : nullptr;
+    auto scalar_fun = fun ? dynamic_cast<functions::scalar_function*>(fun->get()) : nullptr;
+    auto state = scalar_fun && !fun_call->args.empty() ? as_if<temporary>(&fun_call->args.front()) : nullptr;
+    if (!state || state->index != index) {
+        temporaries[index] = evaluate(step, inputs);
+        return;
     }
 
-    try {
-        scalar_fun->return_type()->validate(*result);
-    } catch (marshal_exception&) {
-        throw runtime_exception(fmt::format("Return of function {} ({}) is not a valid value for its declared return type {}",
-                                       *scalar_fun, to_hex(result),
-                                       scalar_fun->return_type()->as_cql3_type()
-                                       ));
+    std::vector<bytes_opt> arguments;
+    arguments.reserve(fun_call->args.size());
+    arguments.emplace_back();
+    for (const expression& arg : fun_call->args | std::views::drop(1)) {
+        arguments.emplace_back(evaluate(arg, inputs).to_bytes_opt());
     }
+    // The remaining arguments are evaluated first, since they may read the
+    // state as well. Then the state is handed over to the step function.
+    arguments[0] = std::move(temporaries[index]).to_bytes_opt();
 
-    return raw_value::make_value(std::move(*result));
+    temporaries[index] = function_result_to_raw_value(*scalar_fun, scalar_fun->execute_consuming(arguments));
 }
 
 static void ensure_can_get_value_elements(const cql3::raw_value& val,
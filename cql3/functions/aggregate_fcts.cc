@@ -22,8 +22,15 @@
 #include "first_function.hh"
 #include "exceptions/exceptions.hh"
 #include "utils/multiprecision_int.hh"
+#include "utils/murmur_hash.hh"
+#include "utils/tdigest.hh"
+#include "sstables/hyperloglog.hh"
+#include <seastar/core/byteorder.hh>
+#include <bit>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <optional>
 #include <type_traits>
 
@@ -95,6 +102,29 @@ class internal_scalar_function : public scalar_function {
     }
 };
 
+// An internal function which may consume its parameters when called through
+// execute_consuming(), e.g. an aggregation step updating its state in place.
+class internal_consuming_scalar_function : public internal_scalar_function {
+    noncopyable_function<bytes_opt (std::span<bytes_opt> parameters)> _consuming_func;
+public:
+    internal_consuming_scalar_function(
+            sstring name,
+            data_type return_type,
+            std::vector<data_type> arg_types,
+            noncopyable_function<bytes_opt (std::span<bytes_opt> parameters)> func)
+            : internal_scalar_function(std::move(name), std::move(return_type), std::move(arg_types),
+                    [this] (std::span<const bytes_opt> parameters) {
+                        auto copy = std::vector<bytes_opt>(parameters.begin(), parameters.end());
+                        return _consuming_func(copy);
+                    })
+            , _consuming_func(std::move(func)) {
+    }
+
+    virtual bytes_opt execute_consuming(std::span<bytes_opt> parameters) override {
+        return _consuming_func(parameters);
+    }
+};
+
 // Called if any of the inputs is NULL
 using null_handler = bytes_opt (*)(std::span<const bytes_opt>);
 
@@ -267,6 +297,130 @@ make_avg_function() {
         });
 }
 
+// approx_percentile()'s state is the requested percentile and the number of
+// buffered values, followed by a fixed-size buffer of values which weren't
+// added to the t-digest yet, followed by the serialized t-digest.
+//
+// Going through a t-digest means deserializing and reserializing all of its
+// centroids, so the step function only appends each value to the buffer, in
+// place, and folds the buffer into the digest once it fills up.
+static constexpr size_t percentile_buffer_capacity = 512;
+static constexpr size_t percentile_buffer_offset = 2 * sizeof(uint64_t);
+static constexpr size_t percentile_digest_offset = percentile_buffer_offset + percentile_buffer_capacity * sizeof(double);
+
+static double read_state_double(bytes_view state, size_t offset) {
+    return std::bit_cast<double>(read_le<uint64_t>(reinterpret_cast<const char*>(state.data() + offset)));
+}
+
+static void write_state_double(bytes& state, size_t offset, double v) {
+    write_le<uint64_t>(reinterpret_cast<char*>(state.data() + offset), std::bit_cast<uint64_t>(v));
+}
+
+static uint64_t percentile_state_buffered(bytes_view state) {
+    if (state.size() < percentile_digest_offset) {
+        throw std::runtime_error("truncated approx_percentile state");
+    }
+    auto buffered = read_le<uint64_t>(reinterpret_cast<const char*>(state.data() + sizeof(double)));
+    if (buffered > percentile_buffer_capacity) {
+        throw std::runtime_error("malformed approx_percentile state");
+    }
+    return buffered;
+}
+
+static bytes
+make_percentile_state(double percentile, const utils::tdigest& digest) {
+    auto serialized_digest = digest.serialize();
+    bytes ret(percentile_digest_offset + serialized_digest.size(), int8_t(0));
+    write_state_double(ret, 0, percentile);
+    std::ranges::copy(serialized_digest, ret.begin() + percentile_digest_offset);
+    return ret;
+}
+
+static double
+percentile_state_percentile(bytes_view state) {
+    percentile_state_buffered(state);
+    return read_state_double(state, 0);
+}
+
+// Returns the digest of all values in the state, including buffered ones.
+static utils::tdigest
+percentile_state_digest(bytes_view state) {
+    auto buffered = percentile_state_buffered(state);
+    auto digest = utils::tdigest::deserialize(state.substr(percentile_digest_offset));
+    for (uint64_t i = 0; i < buffered; ++i) {
+        digest.add(read_state_double(state, percentile_buffer_offset + i * sizeof(double)));
+    }
+    return digest;
+}
+
+template <typename Type>
+static
+shared_ptr<aggregate_function>
+make_approx_percentile_function() {
+    auto input_type = data_type_for<Type>();
+    return make_shared<db::functions::aggregate_function>(
+        db::functions::stateless_aggregate_function{
+            .name = function_name::native_function(APPROX_PERCENTILE_FUNCTION_NAME),
+            .state_type = bytes_type,
+            .result_type = double_type,
+            .argument_types = {input_type, double_type},
+            .initial_state = std::nullopt,
+            .aggregation_function = ::make_shared<internal_consuming_scalar_function>(
+                    "approx_percentile_step",
+                    bytes_type,
+                    std::vector<data_type>({bytes_type, input_type, double_type}),
+                    [input_type] (std::span<bytes_opt> args) -> bytes_opt {
+                        if (!args[1]) {
+                            return std::move(args[0]);
+                        }
+                        if (!args[2]) {
+                            throw exceptions::invalid_request_exception("approx_percentile(): percentile must not be null");
+                        }
+                        auto percentile = value_cast<double>(double_type->deserialize(*args[2]));
+                        if (!(percentile >= 0 && percentile <= 1)) {
+                            throw exceptions::invalid_request_exception(format("approx_percentile(): percentile must be between 0 and 1, got {}", percentile));
+                        }
+                        auto value = static_cast<double>(value_cast<Type>(input_type->deserialize(*args[1])));
+                        if (!args[0]) {
+                            args[0] = make_percentile_state(percentile, utils::tdigest());
+                        }
+                        auto& state = *args[0];
+                        auto buffered = percentile_state_buffered(state);
+                        if (buffered == percentile_buffer_capacity) {
+                            auto digest = percentile_state_digest(state);
+                            digest.add(value);
+                            return make_percentile_state(percentile, digest);
+                        }
+                        write_state_double(state, percentile_buffer_offset + buffered * sizeof(double), value);
+                        write_le<uint64_t>(reinterpret_cast<char*>(state.data() + sizeof(double)), buffered + 1);
+                        return std::move(args[0]);
+                    }),
+            .state_to_result_function = ::make_shared<internal_scalar_function>(
+                    "approx_percentile_finalizer",
+                    double_type,
+                    std::vector<data_type>({bytes_type}),
+                    [] (std::span<const bytes_opt> args) -> bytes_opt {
+                        if (!args[0]) {
+                            return std::nullopt;
+                        }
+                        auto digest = percentile_state_digest(*args[0]);
+                        return double_type->decompose(digest.quantile(percentile_state_percentile(*args[0])));
+                    }),
+            .state_reduction_function = ::make_shared<internal_scalar_function>(
+                    "approx_percentile_reducer",
+                    bytes_type,
+                    std::vector<data_type>({bytes_type, bytes_type}),
+                    [] (std::span<const bytes_opt> args) -> bytes_opt {
+                        if (!args[0] || !args[1]) {
+                            return return_any_nonnull(args);
+                        }
+                        auto digest = percentile_state_digest(*args[0]);
+                        digest.merge(percentile_state_digest(*args[1]));
+                        return make_percentile_state(percentile_state_percentile(*args[0]), digest);
+                    }),
+        });
+}
+
 template <typename T>
 struct aggregate_type_for {
     using type = T;
@@ -326,6 +480,96 @@ aggregate_fcts::make_count_function(data_type input_type) {
         });
 }
 
+// Register width of approx_count_distinct()'s HyperLogLog: 2^12 registers,
+// for a standard error of about 1.6%.
+static constexpr uint8_t approx_count_distinct_precision = 12;
+
+static std::span<const uint8_t> hll_registers(bytes_view state) {
+    return {reinterpret_cast<const uint8_t*>(state.data()), state.size()};
+}
+
+static bytes hll_state(std::span<const uint8_t> registers) {
+    return bytes(reinterpret_cast<const int8_t*>(registers.data()), registers.size());
+}
+
+static uint64_t approx_count_distinct_hash(bytes_view value) {
+    // The partial states computed by different nodes are merged, so the hash
+    // must not depend on the standard library the node was built with, the
+    // way std::hash does. Same hash as the sstable cardinality estimator.
+    return utils::murmur_hash::hash2_64(value, 0);
+}
+
+// Equal values of most types have a single serialized form, so their bytes are
+// hashed directly. Varints may carry redundant sign bytes and equal decimals
+// may differ in scale (1.0 and 1.00), so those are hashed in a canonical form.
+static uint64_t approx_count_distinct_hash(const abstract_type& type, bytes_view value) {
+    switch (type.get_kind()) {
+    case abstract_type::kind::varint:
+        return approx_count_distinct_hash(type.deserialize(value).serialize_nonnull());
+    case abstract_type::kind::decimal: {
+        auto d = value_cast<big_decimal>(type.deserialize(value));
+        auto scale = d.scale();
+        auto unscaled = d.unscaled_value();
+        if (unscaled == 0) {
+            scale = 0;
+        }
+        while (unscaled != 0 && unscaled % 10 == 0 && scale > std::numeric_limits<int32_t>::min()) {
+            unscaled /= 10;
+            --scale;
+        }
+        return approx_count_distinct_hash(data_value(big_decimal(scale, std::move(unscaled))).serialize_nonnull());
+    }
+    default:
+        return approx_count_distinct_hash(value);
+    }
+}
+
+shared_ptr<aggregate_function>
+aggregate_fcts::make_approx_count_distinct_function(data_type input_type) {
+    input_type = input_type->without_reversed().shared_from_this();
+    // The state holds bare HyperLogLog registers, so that the step function
+    // only has to update a single byte of the state, in place.
+    return make_shared<db::functions::aggregate_function>(
+        db::functions::stateless_aggregate_function{
+            .name = function_name::native_function(APPROX_COUNT_DISTINCT_FUNCTION_NAME),
+            .state_type = bytes_type,
+            .result_type = long_type,
+            .argument_types = {input_type},
+            .initial_state = bytes(size_t(1) << approx_count_distinct_precision, int8_t(0)),
+            .aggregation_function = ::make_shared<internal_consuming_scalar_function>(
+                    "approx_count_distinct_step",
+                    bytes_type,
+                    std::vector<data_type>({bytes_type, input_type}),
+                    [input_type] (std::span<bytes_opt> args) -> bytes_opt {
+                        if (args[1]) {
+                            auto& state = *args[0];
+                            hll::HyperLogLog::offer_hashed(
+                                    std::span<uint8_t>(reinterpret_cast<uint8_t*>(state.data()), state.size()),
+                                    approx_count_distinct_precision,
+                                    approx_count_distinct_hash(*input_type, *args[1]));
+                        }
+                        return std::move(args[0]);
+                    }),
+            .state_to_result_function = ::make_shared<internal_scalar_function>(
+                    "approx_count_distinct_finalizer",
+                    long_type,
+                    std::vector<data_type>({bytes_type}),
+                    [] (std::span<const bytes_opt> args) -> bytes_opt {
+                        auto estimate = hll::HyperLogLog::from_registers(hll_registers(*args[0])).estimate();
+                        return data_value(int64_t(std::llround(estimate))).serialize();
+                    }),
+            .state_reduction_function = ::make_shared<internal_scalar_function>(
+                    "approx_count_distinct_reducer",
+                    bytes_type,
+                    std::vector<data_type>({bytes_type, bytes_type}),
+                    [] (std::span<const bytes_opt> args) -> bytes_opt {
+                        auto hll = hll::HyperLogLog::from_registers(hll_registers(*args[0]));
+                        hll.merge(hll::HyperLogLog::from_registers(hll_registers(*args[1])));
+                        return hll_state(hll.registers());
+                    }),
+        });
+}
+
 // Drops the first arg type from the types declaration (which denotes the accumulator)
 // in order to compute the actual type of given user-defined-aggregate (UDA)
 static std::vector<data_type> state_arg_types_to_uda_arg_types(const std::vector<data_type>& arg_types) {
@@ -539,4 +783,10 @@ void cql3::functions::add_agg_functions(declared_t& funcs) {
     declare(make_avg_function<double>());
     declare(make_avg_function<utils::multiprecision_int>());
     declare(make_avg_function<big_decimal>());
+    declare(make_approx_percentile_function<int8_t>());
+    declare(make_approx_percentile_function<int16_t>());
+    declare(make_approx_percentile_function<int32_t>());
+    declare(make_approx_percentile_function<int64_t>());
+    declare(make_approx_percentile_function<float>());
+    declare(make_approx_percentile_function<double>());
 }
@@ -19,6 +19,8 @@ namespace functions {
 namespace aggregate_fcts {
 
 static const sstring COUNT_ROWS_FUNCTION_NAME = "countRows";
+static const sstring APPROX_COUNT_DISTINCT_FUNCTION_NAME = "approx_count_distinct";
+static const sstring APPROX_PERCENTILE_FUNCTION_NAME = "approx_percentile";
 
 /// The function used to count the number of rows of a result set. This function is called when COUNT(*) or COUNT(1)
 /// is specified.
@@ -36,6 +38,10 @@ make_min_function(data_type io_type);
 /// count(col) function for the specified type
 shared_ptr<aggregate_function> make_count_function(data_type input_type);
 
+/// approx_count_distinct(col) function for the specified type. Estimates the
+/// number of distinct non-null values using a HyperLogLog sketch.
+shared_ptr<aggregate_function> make_approx_count_distinct_function(data_type input_type);
+
 }
 }
 }
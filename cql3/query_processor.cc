@@ -23,6 +23,7 @@
 #include "cql3/CqlParser.hpp"
 #include "cql3/statements/batch_statement.hh"
 #include "cql3/statements/modification_statement.hh"
+#include "cql3/statements/select_statement.hh"
 #include "cql3/util.hh"
 #include "cql3/untyped_result_set.hh"
 #include "db/config.hh"
@@ -335,6 +336,16 @@ query_processor::query_processor(service::storage_proxy& proxy, data_dictionary:
                             [] { return prepared_statements_cache::shard_stats().unprivileged_entries_evictions_on_size; },
                             sm::description("Counts a number of evictions of prepared statements from the prepared statements cache after they have been used only once. An increasing counter suggests the user may be preparing a different statement for each request instead of reusing the same prepared statement with parameters.")).set_skip_when_empty(),
 
+                    sm::make_counter(
+                            "unprepared_statements_cache_hits",
+                            _stats.unprepared_statements_cache_hits,
+                            sm::description("Counts unprepared statements which were found in the prepared statements cache, and so weren't parsed.")).set_skip_when_empty(),
+
+                    sm::make_counter(
+                            "unprepared_statements_cache_misses",
+                            _stats.unprepared_statements_cache_misses,
+                            sm::description("Counts unprepared statements which were parsed and inserted into the prepared statements cache.")).set_skip_when_empty(),
+
                     sm::make_gauge(
                             "prepared_cache_size",
                             [this] { return _prepared_cache.size(); },
@@ -367,6 +378,12 @@ query_processor::query_processor(service::storage_proxy& proxy, data_dictionary:
                             _cql_stats.secondary_index_rows_read,
                             sm::description("Counts the total number of rows read during CQL requests performed using secondary indexes.")).set_skip_when_empty(),
 
+                    // secondary_index_covered_reads total count is also included in secondary_index_reads
+                    sm::make_counter(
+                            "secondary_index_covered_reads",
+                            _cql_stats.secondary_index_covered_reads,
+                            sm::description("Counts the total number of CQL read requests using secondary indexes which were answered from the index alone, without reading the base table.")).set_skip_when_empty(),
+
                     // read requests that required ALLOW FILTERING
                     sm::make_counter(
                             "filtered_read_requests",
@@ -416,6 +433,12 @@ query_processor::query_processor(service::storage_proxy& proxy, data_dictionary:
                             _cql_stats.select_parallelized,
                             sm::description("Counts the number of parallelized aggregation SELECT query executions.")).set_skip_when_empty(),
 
+                    sm::make_counter(
+                            "select_parallelized_fallbacks",
+                            _cql_stats.select_parallelized_fallbacks,
+                            sm::description("Counts the number of parallelized GROUP BY SELECT query executions which fell back to the regular, paged algorithm, "
+                                            "because of too many groups to merge or to return in one page.")).set_skip_when_empty(),
+
                     sm::make_counter(
                             "authorized_prepared_statements_cache_evictions",
                             [] { return authorized_prepared_statements_cache::shard_stats().authorized_prepared_statements_cache_evictions; },
@@ -566,27 +589,58 @@ query_processor::execute_maybe_with_guard(service::query_state& query_state, ::s
 }
 
 future<::shared_ptr<result_message>>
-query_processor::execute_direct_without_checking_exception_message(const std::string_view& query_string, service::query_state& query_state, dialect d, query_options& options) {
+query_processor::execute_direct_without_checking_exception_message(const std::string_view& query_string_ref, service::query_state& query_state, dialect d, query_options& options) {
+    // We may defer before parsing the query.
+    sstring query_string(query_string_ref);
     log.trace("execute_direct: \"{}\"", query_string);
-    tracing::trace(query_state.get_trace_state(), "Parsing a statement");
-    auto p = get_statement(query_string, query_state.get_client_state(), d);
-    auto statement = p->statement;
+    auto& client_state = query_state.get_client_state();
+    std::optional<prepared_cache_key_type> key;
+    statements::prepared_statement::checked_weak_ptr cached;
+    if (_db.get_config().cache_unprepared_statements()) {
+        key = compute_unprepared_id(query_string, client_state.get_raw_keyspace(), d);
+        cached = _prepared_cache.find(*key);
+    }
+    std::unique_ptr<prepared_statement> p;
+    if (cached) {
+        ++_stats.unprepared_statements_cache_hits;
+        tracing::trace(query_state.get_trace_state(), "Using a cached statement");
+    } else {
+        tracing::trace(query_state.get_trace_state(), "Parsing a statement");
+        p = get_statement(query_string, client_state, d);
+        // Only cache statements which are likely to be repeated, schema
+        // changes and the like are not worth the cache space.
+        auto& s = *p->statement;
+        if (key && (dynamic_cast<const statements::select_statement*>(&s)
+                || dynamic_cast<const statements::modification_statement*>(&s)
+                || dynamic_cast<const statements::batch_statement*>(&s))) {
+            ++_stats.unprepared_statements_cache_misses;
+            cached = co_await cache_unprepared_statement(*key, std::move(p));
+            if (!cached) {
+                p = get_statement(query_string, client_state, d);
+            }
+        }
+    }
+    // The cached statement may be evicted once we defer, so take what we need
+    // from it before that.
+    const prepared_statement& prepared = cached ? *cached : *p;
+    auto statement = prepared.statement;
     if (statement->get_bound_terms() != options.get_values_count()) {
         const auto msg = format("Invalid amount of bind variables: expected {:d} received {:d}",
                 statement->get_bound_terms(),
                 options.get_values_count());
         throw exceptions::invalid_request_exception(msg);
     }
-    options.prepare(p->bound_names);
+    options.prepare(prepared.bound_names);
+    auto warnings = prepared.warnings;
 
     warn(unimplemented::cause::METRICS);
 #if 0
         if (!queryState.getClientState().isInternal)
             metrics.regularStatementsExecuted.inc();
 #endif
-    auto user = query_state.get_client_state().user();
+    auto user = client_state.user();
     tracing::trace(query_state.get_trace_state(), "Processing a statement for authenticated user: {}", user ? (user->name ? *user->name : "anonymous") : "no user authenticated");
-    return execute_maybe_with_guard(query_state, std::move(statement), options, &query_processor::do_execute_direct, std::move(p->warnings));
+    co_return co_await execute_maybe_with_guard(query_state, std::move(statement), options, &query_processor::do_execute_direct, std::move(warnings));
 }
 
 future<::shared_ptr<result_message>>
@@ -721,6 +775,26 @@ query_processor::get_statement(const std::string_view& query, const service::cli
     return p;
 }
 
+prepared_cache_key_type query_processor::compute_unprepared_id(
+        std::string_view query_string,
+        std::string_view keyspace,
+        dialect d) const {
+    auto target = fmt::format("unprepared:{}:", _unprepared_statements_generation);
+    target += hash_target(query_string, keyspace);
+    return prepared_cache_key_type(md5_hasher::calculate(target), d);
+}
+
+future<prepared_statement::checked_weak_ptr>
+query_processor::cache_unprepared_statement(const prepared_cache_key_type& key, std::unique_ptr<prepared_statement> prepared) {
+    try {
+        co_return co_await _prepared_cache.get(key, [prepared = std::move(prepared)] () mutable {
+            return make_ready_future<std::unique_ptr<prepared_statement>>(std::move(prepared));
+        });
+    } catch (const prepared_statements_cache::statement_is_too_big&) {
+        co_return prepared_statement::checked_weak_ptr();
+    }
+}
+
 std::unique_ptr<raw::parsed_statement>
 query_processor::parse_statement(const std::string_view& query, dialect d) {
     try {
@@ -1095,10 +1169,12 @@ void query_processor::migration_subscriber::on_create_user_type(const sstring& k
 
 void query_processor::migration_subscriber::on_create_function(const sstring& ks_name, const sstring& function_name) {
     log.warn("{} event ignored", __func__);
+    ++_qp->_unprepared_statements_generation;
 }
 
 void query_processor::migration_subscriber::on_create_aggregate(const sstring& ks_name, const sstring& aggregate_name) {
     log.warn("{} event ignored", __func__);
+    ++_qp->_unprepared_statements_generation;
 }
 
 void query_processor::migration_subscriber::on_create_view(const sstring& ks_name, const sstring& view_name) {
@@ -1117,12 +1193,15 @@ void query_processor::migration_subscriber::on_update_column_family(
 }
 
 void query_processor::migration_subscriber::on_update_user_type(const sstring& ks_name, const sstring& type_name) {
+    ++_qp->_unprepared_statements_generation;
 }
 
 void query_processor::migration_subscriber::on_update_function(const sstring& ks_name, const sstring& function_name) {
+    ++_qp->_unprepared_statements_generation;
 }
 
 void query_processor::migration_subscriber::on_update_aggregate(const sstring& ks_name, const sstring& aggregate_name) {
+    ++_qp->_unprepared_statements_generation;
 }
 
 void query_processor::migration_subscriber::on_update_view(
@@ -1145,14 +1224,17 @@ void query_processor::migration_subscriber::on_drop_column_family(const sstring&
 }
 
 void query_processor::migration_subscriber::on_drop_user_type(const sstring& ks_name, const sstring& type_name) {
+    ++_qp->_unprepared_statements_generation;
 }
 
 void query_processor::migration_subscriber::on_drop_function(const sstring& ks_name, const sstring& function_name) {
     log.warn("{} event ignored", __func__);
+    ++_qp->_unprepared_statements_generation;
 }
 
 void query_processor::migration_subscriber::on_drop_aggregate(const sstring& ks_name, const sstring& aggregate_name) {
     log.warn("{} event ignored", __func__);
+    ++_qp->_unprepared_statements_generation;
 }
 
 void query_processor::migration_subscriber::on_drop_view(const sstring& ks_name, const sstring& view_name) {
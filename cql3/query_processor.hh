@@ -115,6 +115,8 @@ class query_processor : public seastar::peering_sharded_service<query_processor>
 
     struct stats {
         uint64_t prepare_invocations = 0;
+        uint64_t unprepared_statements_cache_hits = 0;
+        uint64_t unprepared_statements_cache_misses = 0;
         uint64_t queries_by_cl[size_t(db::consistency_level::MAX_VALUE) + 1] = {};
     } _stats;
 
@@ -124,6 +126,10 @@ class query_processor : public seastar::peering_sharded_service<query_processor>
 
     prepared_statements_cache _prepared_cache;
     authorized_prepared_statements_cache _authorized_prepared_cache;
+    // Part of the cache keys of unprepared statements. Changed when functions
+    // or types change, which, unlike changes of tables, doesn't invalidate
+    // the statements which refer to them.
+    uint64_t _unprepared_statements_generation = 0;
 
     std::function<void(uint32_t)> _auth_prepared_cache_cfg_cb;
     serialized_action _authorized_prepared_cache_config_action;
@@ -453,6 +459,13 @@ class query_processor : public seastar::peering_sharded_service<query_processor>
             const service::client_state& client_state,
             dialect d);
 
+    // Unprepared statements are kept in the prepared statements cache, under
+    // keys which can't clash with the ids of prepared statements.
+    prepared_cache_key_type compute_unprepared_id(std::string_view query_string, std::string_view keyspace, dialect d) const;
+    future<statements::prepared_statement::checked_weak_ptr> cache_unprepared_statement(
+            const prepared_cache_key_type& key,
+            std::unique_ptr<statements::prepared_statement> prepared);
+
     friend class migration_subscriber;
 
     shared_ptr<cql_transport::messages::result_message> bounce_to_shard(unsigned shard, cql3::computed_function_values cached_fn_calls);
@@ -25,16 +25,28 @@ class result_generator {
     friend class untyped_result_set;
     template<typename Visitor>
     class query_result_visitor {
+        // Where the value of a selected column comes from, resolved once
+        // per result rather than for every cell.
+        struct column_source {
+            column_kind kind;
+            bool is_multi_cell;
+            uint32_t component_index;
+        };
         const schema& _schema;
+        std::vector<column_source> _columns;
+        bool _needs_partition_key = false;
+        bool _needs_clustering_key = false;
         std::vector<bytes> _partition_key;
-        std::vector<bytes> _clustering_key;
+        // Views of the components of the current row's clustering key,
+        // valid only while the row is being visited.
+        std::vector<managed_bytes_view> _clustering_key;
         uint64_t _partition_row_count = 0;
         uint64_t _total_row_count = 0;
         Visitor& _visitor;
         const selection::selection& _selection;
     private:
-        void accept_cell_value(const column_definition& def, query::result_row_view::iterator_type& i) {
-            if (def.is_multi_cell()) {
+        void accept_cell_value(const column_source& col, query::result_row_view::iterator_type& i) {
+            if (col.is_multi_cell) {
                 _visitor.accept_value(utils::buffer_view_to_managed_bytes_view(i.next_collection_cell()));
             } else {
                 auto cell = i.next_atomic_cell();
@@ -43,10 +55,23 @@ class result_generator {
         }
     public:
         query_result_visitor(const schema& s, Visitor& visitor, const selection::selection& select)
-            : _schema(s), _visitor(visitor), _selection(select) { }
+            : _schema(s), _visitor(visitor), _selection(select) {
+            _columns.reserve(_selection.get_columns().size());
+            for (auto&& def : _selection.get_columns()) {
+                _columns.push_back(column_source{
+                    .kind = def->kind,
+                    .is_multi_cell = def->is_multi_cell(),
+                    .component_index = uint32_t(def->component_index()),
+                });
+                _needs_partition_key |= def->is_partition_key();
+                _needs_clustering_key |= def->is_clustering_key();
+            }
+        }
 
         void accept_new_partition(const partition_key& key, uint64_t row_count) {
-            _partition_key = key.explode(_schema);
+            if (_needs_partition_key) {
+                _partition_key = key.explode(_schema);
+            }
             accept_new_partition(row_count);
         }
         void accept_new_partition(uint64_t row_count) {
@@ -56,30 +81,36 @@ class result_generator {
 
         void accept_new_row(const clustering_key& key, query::result_row_view static_row,
                             query::result_row_view row) {
-            _clustering_key = key.explode(_schema);
+            _clustering_key.clear();
+            if (_needs_clustering_key) {
+                for (managed_bytes_view component : key.components(_schema)) {
+                    _clustering_key.push_back(component);
+                }
+            }
             accept_new_row(static_row, row);
+            _clustering_key.clear();
         }
         void accept_new_row(query::result_row_view static_row, query::result_row_view row) {
             auto static_row_iterator = static_row.iterator();
             auto row_iterator = row.iterator();
             _visitor.start_row();
-            for (auto&& def : _selection.get_columns()) {
-                switch (def->kind) {
+            for (auto&& col : _columns) {
+                switch (col.kind) {
                 case column_kind::partition_key:
-                    _visitor.accept_value(bytes_view(_partition_key[def->component_index()]));
+                    _visitor.accept_value(bytes_view(_partition_key[col.component_index]));
                     break;
                 case column_kind::clustering_key:
-                    if (_clustering_key.size() > def->component_index()) {
-                        _visitor.accept_value(bytes_view(_clustering_key[def->component_index()]));
+                    if (_clustering_key.size() > col.component_index) {
+                        _visitor.accept_value(_clustering_key[col.component_index]);
                     } else {
                         _visitor.accept_value(std::nullopt);
                     }
                     break;
                 case column_kind::regular_column:
-                    accept_cell_value(*def, row_iterator);
+                    accept_cell_value(col, row_iterator);
                     break;
                 case column_kind::static_column:
-                    accept_cell_value(*def, static_row_iterator);
+                    accept_cell_value(col, static_row_iterator);
                     break;
                 }
             }
@@ -91,11 +122,11 @@ class result_generator {
                 _total_row_count++;
                 _visitor.start_row();
                 auto static_row_iterator = static_row.iterator();
-                for (auto&& def : _selection.get_columns()) {
-                    if (def->is_partition_key()) {
-                        _visitor.accept_value(bytes_view(_partition_key[def->component_index()]));
-                    } else if (def->is_static()) {
-                        accept_cell_value(*def, static_row_iterator);
+                for (auto&& col : _columns) {
+                    if (col.kind == column_kind::partition_key) {
+                        _visitor.accept_value(bytes_view(_partition_key[col.component_index]));
+                    } else if (col.kind == column_kind::static_column) {
+                        accept_cell_value(col, static_row_iterator);
                     } else {
                         _visitor.accept_value(std::nullopt);
                     }
@@ -193,6 +193,27 @@ contains_ttl(const expr::expression& e) {
     return contains_column_mutation_attribute(expr::column_mutation_attribute::attribute_kind::ttl, e);
 }
 
+static
+bool
+is_reducible_selector(const expr::expression& e) {
+    auto fc = expr::as_if<expr::function_call>(&e);
+    if (!fc) {
+        return false;
+    }
+    auto func = std::get<shared_ptr<cql3::functions::function>>(fc->func);
+    if (!func->is_aggregate()) {
+        return false;
+    }
+    auto agg_func = dynamic_pointer_cast<functions::aggregate_function>(std::move(func));
+    if (!agg_func->get_aggregate().state_reduction_function) {
+        return false;
+    }
+    // We only support transforming columns directly for parallel queries,
+    // optionally followed by constants (e.g. the percentile of approx_percentile()).
+    auto first_constant = std::ranges::find_if_not(fc->args, expr::is<expr::column_value>);
+    return std::all_of(first_constant, fc->args.end(), expr::is<expr::constant>);
+}
+
 class selection_with_processing : public selection {
 private:
     std::vector<expr::expression> _selectors;
@@ -257,30 +278,30 @@ class selection_with_processing : public selection {
     }
 
     virtual bool is_reducible() const override {
+        return std::ranges::all_of(_selectors, is_reducible_selector);
+    }
+
+    virtual bool is_reducible_with_group_by(const std::vector<const column_definition*>& group_by_columns) const override {
         return std::ranges::all_of(
                 _selectors,
-               [] (const expr::expression& e) {
-                    auto fc = expr::as_if<expr::function_call>(&e);
-                    if (!fc) {
-                        return false;
-                    }
-                    auto func = std::get<shared_ptr<cql3::functions::function>>(fc->func);
-                    if (!func->is_aggregate()) {
-                        return false;
-                    }
-                    auto agg_func = dynamic_pointer_cast<functions::aggregate_function>(std::move(func));
-                    if (!agg_func->get_aggregate().state_reduction_function) {
-                        return false;
-                    }
-                    // We only support transforming columns directly for parallel queries
-                    if (!std::ranges::all_of(fc->args, expr::is<expr::column_value>)) {
-                        return false;
+                [&] (const expr::expression& e) {
+                    if (auto cv = expr::as_if<expr::column_value>(&e)) {
+                        return std::ranges::find(group_by_columns, cv->col) != group_by_columns.end();
                     }
-                    return true;
+                    return is_reducible_selector(e);
                 }
         );
     }
 
+    virtual std::vector<const column_definition*> get_plain_column_selectors() const override {
+        return _selectors
+                | std::views::transform([] (const expr::expression& e) -> const column_definition* {
+                    auto cv = expr::as_if<expr::column_value>(&e);
+                    return cv ? cv->col : nullptr;
+                })
+                | std::ranges::to<std::vector<const column_definition*>>();
+    }
+
     virtual query::mapreduce_request::reductions_info get_reductions() const override {
         std::vector<query::mapreduce_request::reduction_type> types;
         std::vector<query::mapreduce_request::aggregation_info> infos;
@@ -288,6 +309,10 @@ class selection_with_processing : public selection {
             throw std::runtime_error("Selection doesn't have a reduction");
         };
         for (const auto& e : _selectors) {
+            if (expr::is<expr::column_value>(e)) {
+                // GROUP BY column, taken from the group key rather than reduced.
+                continue;
+            }
             auto fc = expr::as_if<expr::function_call>(&e);
             if (!fc) {
                 bad();
@@ -301,9 +326,17 @@ class selection_with_processing : public selection {
             auto type = (agg_func->name().name == "countRows") ? query::mapreduce_request::reduction_type::count : query::mapreduce_request::reduction_type::aggregate;
 
             std::vector<sstring> column_names;
+            std::vector<query::mapreduce_request::constant_argument> constant_arguments;
             for (auto& arg : fc->args) {
+                if (auto constant = expr::as_if<expr::constant>(&arg)) {
+                    constant_arguments.push_back({
+                        .type_name = constant->type->name(),
+                        .value = raw_value(constant->value).to_bytes_opt(),
+                    });
+                    continue;
+                }
                 auto col = expr::as_if<expr::column_value>(&arg);
-                if (!col) {
+                if (!col || !constant_arguments.empty()) {
                     bad();
                 }
                 column_names.push_back(col->col->name_as_text());
@@ -312,6 +345,7 @@ class selection_with_processing : public selection {
             auto info = query::mapreduce_request::aggregation_info {
                 .name = agg_func->name(),
                 .column_names = std::move(column_names),
+                .constant_arguments = std::move(constant_arguments),
             };
 
             types.push_back(type);
@@ -425,7 +459,7 @@ class selection_with_processing : public selection {
                     .temporaries = _temporaries,
             };
             for (size_t i = 0; i != _sel._inner_loop.size(); ++i) {
-                _temporaries[i] = expr::evaluate(_sel._inner_loop[i], inputs);
+                expr::evaluate_aggregation_step(_sel._inner_loop[i], _temporaries, i, inputs);
             }
             ++_input_row_count;
         }
@@ -720,34 +754,29 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
         return false;
     }
 
-    auto static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
-
-    if (!expr::is_satisfied_by(
-                    _partition_level_filter,
-                    expr::evaluation_inputs{
-                        .partition_key = partition_key,
-                        .clustering_key = clustering_key,
-                        .static_and_regular_columns = static_and_regular_columns,
-                        .selection = &selection,
-                        .options = &_options,
-                    })) {
-        _current_partition_does_not_match = true;
-        return false;
+    if (!_compiled_clustering_row_level_filter) {
+        _compiled_partition_level_filter.emplace(_partition_level_filter, selection, _options);
+        _compiled_clustering_row_level_filter.emplace(_clustering_row_level_filter, selection, _options);
     }
 
-    if (!expr::is_satisfied_by(
-                    _clustering_row_level_filter,
-                    expr::evaluation_inputs{
-                        .partition_key = partition_key,
-                        .clustering_key = clustering_key,
-                        .static_and_regular_columns = static_and_regular_columns,
-                        .selection = &selection,
-                        .options = &_options,
-                    })) {
-        return false;
+    auto static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
+    auto inputs = expr::evaluation_inputs{
+        .partition_key = partition_key,
+        .clustering_key = clustering_key,
+        .static_and_regular_columns = static_and_regular_columns,
+        .selection = &selection,
+        .options = &_options,
+    };
+
+    if (!_current_partition_matches) {
+        if (!_compiled_partition_level_filter->is_satisfied_by(inputs)) {
+            _current_partition_does_not_match = true;
+            return false;
+        }
+        _current_partition_matches = true;
     }
 
-    return true;
+    return _compiled_clustering_row_level_filter->is_satisfied_by(inputs);
 }
 
 bool result_set_builder::restrictions_filter::operator()(const selection& selection,
@@ -771,6 +800,7 @@ bool result_set_builder::restrictions_filter::operator()(const selection& select
 
 void result_set_builder::restrictions_filter::reset(const partition_key* key) {
     _current_partition_does_not_match = false;
+    _current_partition_matches = false;
     _rows_dropped = 0;
     _per_partition_remaining = _per_partition_limit;
     if (_is_first_partition_on_page && _per_partition_limit < std::numeric_limits<decltype(_per_partition_limit)>::max()) {
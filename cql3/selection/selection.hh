@@ -17,6 +17,7 @@
 #include "selector.hh"
 #include "cql3/column_specification.hh"
 #include "cql3/functions/function.hh"
+#include "cql3/expr/compiled_filter.hh"
 #include "exceptions/exceptions.hh"
 #include "unimplemented.hh"
 #include <seastar/core/thread.hh>
@@ -157,8 +158,20 @@ class selection {
 
     virtual bool is_reducible() const {return false;}
 
+    /**
+     * Like is_reducible(), but additionally accepts selectors which are plain
+     * references to one of the given GROUP BY columns.
+     */
+    virtual bool is_reducible_with_group_by(const std::vector<const column_definition*>& group_by_columns) const {return false;}
+
     virtual query::mapreduce_request::reductions_info get_reductions() const {return {{}, {}};}
 
+    /**
+     * For each selector, returns the column it references if the selector is a
+     * plain column reference, or nullptr otherwise.
+     */
+    virtual std::vector<const column_definition*> get_plain_column_selectors() const {return {};}
+
     /**
      * Returns true if the selection is trivial, i.e. there are no function
      * selectors (including casts or aggregates).
@@ -218,7 +231,13 @@ class result_set_builder {
         const query_options& _options;
         const expr::expression& _partition_level_filter;
         const expr::expression& _clustering_row_level_filter;
+        // Compiled on the first filtered row, once the selection is known.
+        mutable std::optional<expr::compiled_filter> _compiled_partition_level_filter;
+        mutable std::optional<expr::compiled_filter> _compiled_clustering_row_level_filter;
         mutable bool _current_partition_does_not_match = false;
+        // The partition-level filter only depends on the partition key and
+        // static columns, so it's evaluated once per partition.
+        mutable bool _current_partition_matches = false;
         mutable uint64_t _rows_dropped = 0;
         mutable uint64_t _remaining;
         schema_ptr _schema;
@@ -15,6 +15,7 @@
 #include "cql3/statements/alter_type_statement.hh"
 #include "exceptions/exceptions.hh"
 #include "index/secondary_index_manager.hh"
+#include "index/target_parser.hh"
 #include "prepared_statement.hh"
 #include "service/migration_manager.hh"
 #include "service/storage_proxy.hh"
@@ -247,6 +248,14 @@ void alter_table_statement::drop_column(const query_options& options, const sche
     if (def->is_primary_key()) {
         throw exceptions::invalid_request_exception(format("Cannot drop PRIMARY KEY part {}", column_name));
     } else {
+        // Columns included in a covering index are stored in the index's
+        // view, like the columns selected by a materialized view.
+        for (const auto& im : schema.indices()) {
+            if (std::ranges::contains(secondary_index::target_parser::get_included_column_names(im), column_name.text())) {
+                throw exceptions::invalid_request_exception(format("Cannot drop column {} from base table {}.{}: it is included in secondary index {}",
+                        column_name, keyspace(), column_family(), im.name()));
+            }
+        }
         // We refuse to drop a column from a base-table if one of its
         // materialized views needs this column. This includes columns
         // selected by one of the views, and in some cases even unselected
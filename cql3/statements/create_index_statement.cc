@@ -36,11 +36,13 @@ namespace statements {
 create_index_statement::create_index_statement(cf_name name,
                                                ::shared_ptr<index_name> index_name,
                                                std::vector<::shared_ptr<index_target::raw>> raw_targets,
+                                               std::vector<::shared_ptr<column_identifier::raw>> raw_included_columns,
                                                ::shared_ptr<index_prop_defs> properties,
                                                bool if_not_exists)
     : schema_altering_statement(name)
     , _index_name(index_name->get_idx())
     , _raw_targets(raw_targets)
+    , _raw_included_columns(std::move(raw_included_columns))
     , _properties(properties)
     , _if_not_exists(if_not_exists)
 {
@@ -174,6 +176,55 @@ std::vector<::shared_ptr<index_target>> create_index_statement::validate_while_e
     return targets;
 }
 
+std::vector<::shared_ptr<column_identifier>> create_index_statement::validate_included_columns(data_dictionary::database db, const schema& schema,
+        const std::vector<::shared_ptr<index_target>>& targets) const {
+    std::vector<::shared_ptr<column_identifier>> included_columns;
+    if (_raw_included_columns.empty()) {
+        return included_columns;
+    }
+    if (!db.features().covering_indexes) {
+        throw exceptions::invalid_request_exception("Cluster does not support INCLUDE columns in secondary indexes yet,"
+                " upgrade the whole cluster first in order to be able to create them");
+    }
+    if (_properties->is_custom) {
+        throw exceptions::invalid_request_exception("INCLUDE columns are not supported for CUSTOM indexes");
+    }
+    // The index view has one row per indexed base row only when the index is
+    // on the value of a regular column. Otherwise (index on a primary key
+    // column, a static column or a collection's elements) the view rows
+    // don't map to base rows, and storing copies of base columns in them
+    // would be meaningless.
+    const auto& target = targets.back();
+    auto* ident = std::get_if<::shared_ptr<column_identifier>>(&target->value);
+    const column_definition* target_cdef = ident ? schema.get_column_definition((*ident)->name()) : nullptr;
+    if (!target_cdef || !target_cdef->is_regular()
+            || (target->type != index_target::target_type::regular_values && target->type != index_target::target_type::full)) {
+        throw exceptions::invalid_request_exception("INCLUDE columns are only supported for indexes on the value of a regular column");
+    }
+    std::unordered_set<sstring> names;
+    for (const auto& raw_column : _raw_included_columns) {
+        auto column = raw_column->prepare_column_identifier(schema);
+        auto cdef = schema.get_column_definition(column->name());
+        if (!cdef) {
+            throw exceptions::invalid_request_exception(format("No column definition found for included column {}", *column));
+        }
+        if (cdef->is_primary_key()) {
+            throw exceptions::invalid_request_exception(format("Primary key column {} is always stored in the index and cannot be included", *column));
+        }
+        if (cdef->is_static()) {
+            throw exceptions::invalid_request_exception(format("Static column {} cannot be included in a secondary index", *column));
+        }
+        if (cdef == target_cdef) {
+            throw exceptions::invalid_request_exception(format("Indexed column {} is always stored in the index and cannot be included", *column));
+        }
+        if (!names.insert(column->text()).second) {
+            throw exceptions::invalid_request_exception(format("Duplicate column {} in INCLUDE list", *column));
+        }
+        included_columns.push_back(std::move(column));
+    }
+    return included_columns;
+}
+
 void create_index_statement::validate_for_local_index(const schema& schema) const {
     if (!_raw_targets.empty()) {
             if (const auto* index_pk = std::get_if<std::vector<::shared_ptr<column_identifier::raw>>>(&_raw_targets.front()->value)) {
@@ -328,6 +379,7 @@ std::optional<create_index_statement::base_schema_with_new_index> create_index_s
     auto targets = validate_while_executing(db);
 
     auto schema = db.find_schema(keyspace(), column_family());
+    auto included_columns = validate_included_columns(db, *schema, targets);
 
     sstring accepted_name = _index_name;
     if (accepted_name.empty()) {
@@ -347,7 +399,7 @@ std::optional<create_index_statement::base_schema_with_new_index> create_index_s
     } else {
         kind = schema->is_compound() ? index_metadata_kind::composites : index_metadata_kind::keys;
     }
-    auto index = make_index_metadata(targets, accepted_name, kind, index_options);
+    auto index = make_index_metadata(targets, accepted_name, kind, index_options, included_columns);
     auto existing_index = schema->find_index_noname(index);
     if (existing_index) {
         if (_if_not_exists) {
@@ -401,11 +453,15 @@ create_index_statement::prepare(data_dictionary::database db, cql_stats& stats)
 index_metadata create_index_statement::make_index_metadata(const std::vector<::shared_ptr<index_target>>& targets,
                                                            const sstring& name,
                                                            index_metadata_kind kind,
-                                                           const index_options_map& options)
+                                                           const index_options_map& options,
+                                                           const std::vector<::shared_ptr<column_identifier>>& included_columns)
 {
     index_options_map new_options = options;
     auto target_option = secondary_index::target_parser::serialize_targets(targets);
     new_options.emplace(index_target::target_option_name, target_option);
+    if (!included_columns.empty()) {
+        new_options.emplace(index_target::included_columns_option_name, secondary_index::target_parser::serialize_included_columns(included_columns));
+    }
 
     const auto& first_target = targets.front()->value;
     return index_metadata{name, new_options, kind, index_metadata::is_local_index(std::holds_alternative<index_target::multiple_columns>(first_target))};
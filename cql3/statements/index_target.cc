@@ -20,6 +20,7 @@ namespace statements {
 using db::index::secondary_index;
 
 const sstring index_target::target_option_name = "target";
+const sstring index_target::included_columns_option_name = "included_columns";
 const sstring index_target::custom_index_option_name = "class_name";
 const boost::regex index_target::target_regex("^(keys|entries|values|full)\\((.+)\\)$");
 
@@ -21,6 +21,9 @@ namespace statements {
 
 struct index_target {
     static const sstring target_option_name;
+    // Name of the index option listing the columns stored in the index
+    // view in addition to the key columns (CREATE INDEX ... INCLUDE (...)).
+    static const sstring included_columns_option_name;
     static const sstring custom_index_option_name;
     static const boost::regex target_regex;
 
@@ -36,6 +36,7 @@
 #include "service/pager/query_pagers.hh"
 #include "service/storage_proxy.hh"
 #include <seastar/core/execution_stage.hh>
+#include <seastar/coroutine/as_future.hh>
 #include "view_info.hh"
 #include "partition_slice_builder.hh"
 #include "cql3/untyped_result_set.hh"
@@ -759,38 +760,94 @@ indexed_table_select_statement::do_execute_base_query(
     auto cmd = prepare_command_for_base_query(qp, options, state, now, bool(paging_state));
     auto timeout = db::timeout_clock::now() + get_timeout(state.get_client_state(), options);
 
+    // The posting list is sorted by token and then by the base primary key,
+    // so rows of the same partition are adjacent. They are all fetched with
+    // a single read, instead of a read per row.
+    struct partition_rows {
+        dht::decorated_key partition;
+        std::vector<query::clustering_range> row_ranges;
+    };
+    std::vector<partition_rows> partitions;
+    {
+        clustering_key_prefix::less_compare ck_less(*_schema);
+        clustering_key_prefix::equality ck_eq(*_schema);
+        auto sort_rows = [&] (partition_rows& p) {
+            auto& ranges = p.row_ranges;
+            // Singular ranges are their own reverse, so sorting them in
+            // the slice's order is all that a reversed slice needs.
+            std::ranges::sort(ranges, [&] (const query::clustering_range& a, const query::clustering_range& b) {
+                return ck_less(a.start()->value(), b.start()->value());
+            });
+            auto dups = std::ranges::unique(ranges, [&] (const query::clustering_range& a, const query::clustering_range& b) {
+                return ck_eq(a.start()->value(), b.start()->value());
+            });
+            ranges.erase(dups.begin(), dups.end());
+            if (cmd->slice.is_reversed()) {
+                std::ranges::reverse(ranges);
+            }
+        };
+        for (auto& key : primary_keys) {
+            if (partitions.empty() || !partitions.back().partition.equal(*_schema, key.partition)) {
+                if (!partitions.empty()) {
+                    sort_rows(partitions.back());
+                }
+                partitions.push_back(partition_rows{std::move(key.partition), {}});
+            }
+            if (key.clustering) {
+                partitions.back().row_ranges.push_back(query::clustering_range::make_singular(std::move(key.clustering)));
+            }
+        }
+        if (!partitions.empty()) {
+            sort_rows(partitions.back());
+        }
+    }
+    auto same_rows = [ck_eq = clustering_key_prefix::equality(*_schema)] (const partition_rows& a, const partition_rows& b) {
+        return std::ranges::equal(a.row_ranges, b.row_ranges, [&] (const query::clustering_range& x, const query::clustering_range& y) {
+            return ck_eq(x.start()->value(), y.start()->value());
+        });
+    };
+
     query::result_merger merger(cmd->get_row_limit(), query::max_partitions);
-    std::vector<primary_key> keys = std::move(primary_keys);
-    std::vector<primary_key>::iterator key_it(keys.begin());
+    auto partition_it = partitions.begin();
     size_t previous_result_size = 0;
     size_t next_iteration_size = 0;
 
     const bool is_paged = bool(paging_state);
-    while (key_it != keys.end()) {
-        // Starting with 1 key, we check if the result was a short read, and if not,
-        // we continue exponentially, asking for 2x more key than before
-        auto already_done = std::distance(keys.begin(), key_it);
+    while (partition_it != partitions.end()) {
+        // Starting with 1 partition, we check if the result was a short read, and if not,
+        // we continue exponentially, asking for 2x more partitions than before
+        auto already_done = std::distance(partitions.begin(), partition_it);
         // If the previous result already provided 1MB worth of data,
         // stop increasing the number of fetched partitions
         if (previous_result_size < query::result_memory_limiter::maximum_result_size) {
             next_iteration_size = already_done + 1;
         }
-        next_iteration_size = std::min<size_t>({next_iteration_size, keys.size() - already_done, max_base_table_query_concurrency});
-        auto key_it_end = key_it + next_iteration_size;
-        auto command = ::make_lw_shared<query::read_command>(*cmd);
+        next_iteration_size = std::min<size_t>({next_iteration_size, partitions.size() - already_done, max_base_table_query_concurrency});
+        auto partition_it_end = partition_it + next_iteration_size;
+
+        // Consecutive partitions whose rows have the same clustering keys are
+        // fetched with a single read of several partitions. At CL=ONE,
+        // storage_proxy sends the partitions owned by the same replica in a
+        // single READ_DATA_MULTI request, see query_singular_batched().
+        std::vector<std::ranges::subrange<std::vector<partition_rows>::iterator>> reads;
+        for (auto it = partition_it; it != partition_it_end;) {
+            auto run_end = std::find_if(it + 1, partition_it_end, [&] (const partition_rows& p) {
+                return !same_rows(p, *it);
+            });
+            reads.emplace_back(it, run_end);
+            it = run_end;
+        }
 
         query::result_merger oneshot_merger(cmd->get_row_limit(), query::max_partitions);
-        coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>> rresult = co_await utils::result_map_reduce(key_it, key_it_end, coroutine::lambda([&] (auto& key)
+        coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>> rresult = co_await utils::result_map_reduce(reads.begin(), reads.end(), coroutine::lambda([&] (const auto& read)
                 -> future<coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>>> {
             auto command = ::make_lw_shared<query::read_command>(*cmd);
-            // for each partition, read just one clustering row (TODO: can
-            // get all needed rows of one partition at once.)
-            command->slice._row_ranges.clear();
-            if (key.clustering) {
-                command->slice._row_ranges.push_back(query::clustering_range::make_singular(key.clustering));
-            }
+            command->slice._row_ranges = read.front().row_ranges;
+            auto ranges = read | std::views::transform([] (const partition_rows& p) {
+                return dht::partition_range::make_singular(p.partition);
+            }) | std::ranges::to<dht::partition_range_vector>();
             coordinator_result<service::storage_proxy::coordinator_query_result> rqr
-                    = co_await qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(key.partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
+                    = co_await qp.proxy().query_result(_schema, command, std::move(ranges), options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
             if (!rqr.has_value()) {
                 co_return std::move(rqr).as_failure();
             }
@@ -805,7 +862,7 @@ indexed_table_select_statement::do_execute_base_query(
         const bool page_limit_reached = is_paged && result->buf().size() >= query::result_memory_limiter::maximum_result_size;
         previous_result_size = result->buf().size();
         merger(std::move(result));
-        key_it = key_it_end;
+        partition_it = partition_it_end;
         if (is_short_read || page_limit_reached) {
             break;
         }
@@ -1042,6 +1099,37 @@ indexed_table_select_statement::indexed_table_select_statement(schema_ptr schema
         _get_partition_ranges_for_posting_list = [this] (const query_options& options) { return get_partition_ranges_for_global_index_posting_list(options); };
         _get_partition_slice_for_posting_list = [this] (const query_options& options) { return get_partition_slice_for_global_index_posting_list(options); };
     }
+    _covering_selection = make_covering_selection();
+}
+
+::shared_ptr<selection::selection> indexed_table_select_statement::make_covering_selection() const {
+    if (!_index.metadata().options().contains(index_target::included_columns_option_name)) {
+        return nullptr;
+    }
+    // The view rows must correspond one to one to the base rows matching the
+    // query, which is only the case for indexes on regular column values
+    // (INCLUDE is not allowed for any other index anyway). Anything which
+    // needs more than returning the view rows as they are read - functions,
+    // filtering, per-partition limits or reordering - goes through the base
+    // table.
+    const column_definition* target = _schema->get_column_definition(to_bytes(_index.target_column()));
+    if (!target || !target->is_regular() || _index.target_type() != index_target::target_type::regular_values) {
+        return nullptr;
+    }
+    if (!_selection->is_trivial() || _selection->is_aggregate() || has_group_by() || _parameters->is_distinct()
+            || _restrictions_need_filtering || _per_partition_limit || _is_reversed || needs_post_query_ordering()) {
+        return nullptr;
+    }
+    std::vector<const column_definition*> view_columns;
+    view_columns.reserve(_selection->get_column_count());
+    for (const column_definition* cdef : _selection->get_columns()) {
+        const column_definition* view_cdef = _view_schema->get_column_definition(cdef->name());
+        if (!view_cdef || view_cdef->is_view_virtual() || view_cdef->is_computed()) {
+            return nullptr;
+        }
+        view_columns.push_back(view_cdef);
+    }
+    return selection::selection::for_columns(_view_schema, std::move(view_columns));
 }
 
 template<typename KeyType>
@@ -1146,6 +1234,11 @@ indexed_table_select_statement::do_execute(query_processor& qp,
 
     _stats.unpaged_select_queries(_ks_sel) += options.get_page_size() <= 0;
 
+    if (_covering_selection) {
+        tracing::trace(state.get_trace_state(), "Index {} covers the query, reading the selected columns from it", _index.metadata().name());
+        co_return co_await execute_covered_query(qp, state, options, now);
+    }
+
     // Secondary index search has two steps: 1. use the index table to find a
     // list of primary keys matching the query. 2. read the rows matching
     // these primary keys from the base table and return the selected columns.
@@ -1194,54 +1287,102 @@ indexed_table_select_statement::do_execute(query_processor& qp,
     if (aggregate) {
         cql3::selection::result_set_builder builder(*_selection, now, &options, *_group_by_cell_indices);
         std::unique_ptr<cql3::query_options> internal_options = std::make_unique<cql3::query_options>(cql3::query_options(options));
-        stop_iteration stop;
         // page size is set to the internal count page size, regardless of the user-provided value
         internal_options.reset(new cql3::query_options(std::move(internal_options), options.get_paging_state(), internal_paging_size));
-        do {
-            auto consume_results = [this, &builder, &options, &internal_options, &state] (foreign_ptr<lw_shared_ptr<query::result>> results, lw_shared_ptr<query::read_command> cmd, lw_shared_ptr<const service::pager::paging_state> paging_state) -> stop_iteration {
-                if (paging_state) {
-                    paging_state = generate_view_paging_state_from_base_query_results(paging_state, results, state, options);
-                }
-                internal_options.reset(new cql3::query_options(std::move(internal_options), paging_state ? make_lw_shared<service::pager::paging_state>(*paging_state) : nullptr));
-                if (_restrictions_need_filtering) {
-                    _stats.filtered_rows_read_total += *results->row_count();
-                    query::result_view::consume(*results, cmd->slice, cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection,
-                            cql3::selection::result_set_builder::restrictions_filter(_restrictions, options, cmd->get_row_limit(), _schema, cmd->slice.partition_row_limit())));
-                } else {
-                    query::result_view::consume(*results, cmd->slice, cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection));
+        // Consumes the base rows of one page of the posting list. Returns
+        // whether the next page should be read, and whether all the base rows
+        // of this page were consumed (i.e. the paging state didn't have to be
+        // moved back because of a short read of the base table).
+        auto consume_results = [this, &builder, &options, &internal_options, &state] (foreign_ptr<lw_shared_ptr<query::result>> results, lw_shared_ptr<query::read_command> cmd, lw_shared_ptr<const service::pager::paging_state> paging_state)
+                -> std::pair<stop_iteration, bool> {
+            bool consumed_whole_page = true;
+            if (paging_state) {
+                auto view_paging_state = generate_view_paging_state_from_base_query_results(paging_state, results, state, options);
+                consumed_whole_page = view_paging_state == paging_state;
+                paging_state = std::move(view_paging_state);
+            }
+            internal_options.reset(new cql3::query_options(std::move(internal_options), paging_state ? make_lw_shared<service::pager::paging_state>(*paging_state) : nullptr));
+            if (_restrictions_need_filtering) {
+                _stats.filtered_rows_read_total += *results->row_count();
+                query::result_view::consume(*results, cmd->slice, cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection,
+                        cql3::selection::result_set_builder::restrictions_filter(_restrictions, options, cmd->get_row_limit(), _schema, cmd->slice.partition_row_limit())));
+            } else {
+                query::result_view::consume(*results, cmd->slice, cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection));
+            }
+            bool has_more_pages = paging_state && paging_state->get_remaining() > 0;
+            return {stop_iteration(!has_more_pages), consumed_whole_page};
+        };
+
+        // Reads the posting list page by page, and the base rows of each page.
+        // The next page of the posting list is read while the base rows of the
+        // current one are fetched. It is used only if all the base rows of the
+        // current page were consumed, otherwise it is read again, starting from
+        // the last consumed row.
+        auto aggregate_pages = [&] <typename Keys> (auto find_keys) -> future<coordinator_result<void>> {
+            using keys_result = coordinator_result<std::tuple<Keys, lw_shared_ptr<const service::pager::paging_state>>>;
+            std::unique_ptr<cql3::query_options> next_options;
+            std::optional<future<keys_result>> next_keys;
+            auto drop_next_keys = [&] () -> future<> {
+                if (next_keys) {
+                    auto f = co_await coroutine::as_future(std::move(*next_keys));
+                    f.ignore_ready_future();
+                    next_keys.reset();
                 }
-                bool has_more_pages = paging_state && paging_state->get_remaining() > 0;
-                return stop_iteration(!has_more_pages);
+                next_options.reset();
             };
-
-            if (whole_partitions || partition_slices) {
-                tracing::trace(state.get_trace_state(), "Consulting index {} for a single slice of keys, aggregation query", _index.metadata().name());
-                auto result_partition_ranges_and_paging_state = co_await find_index_partition_ranges(qp, state, *internal_options);
-                if (result_partition_ranges_and_paging_state.has_error()) {
-                    co_return failed_result_to_result_message(std::move(result_partition_ranges_and_paging_state));
+            stop_iteration stop = stop_iteration::no;
+            do {
+                keys_result keys = next_keys ? co_await std::move(*next_keys) : co_await find_keys(*internal_options);
+                next_keys.reset();
+                next_options.reset();
+                if (keys.has_error()) {
+                    co_return std::move(keys).as_failure();
                 }
-                auto&& [partition_ranges, paging_state] = result_partition_ranges_and_paging_state.assume_value();
-                auto result_results_and_cmd = co_await do_execute_base_query(qp, std::move(partition_ranges), state, *internal_options, now, paging_state);
-                if (result_results_and_cmd.has_error()) {
-                    co_return failed_result_to_result_message(std::move(result_results_and_cmd));
+                auto&& [base_keys, paging_state] = keys.assume_value();
+                if (paging_state && paging_state->get_remaining() > 0) {
+                    next_options = std::make_unique<cql3::query_options>(std::make_unique<cql3::query_options>(*internal_options),
+                            make_lw_shared<service::pager::paging_state>(*paging_state));
+                    next_keys = find_keys(*next_options);
                 }
-                auto&& [results, cmd] = result_results_and_cmd.assume_value();
-                stop = consume_results(std::move(results), std::move(cmd), std::move(paging_state));
-            } else {
-                tracing::trace(state.get_trace_state(), "Consulting index {} for a list of rows containing keys, aggregation query", _index.metadata().name());
-                auto result_primary_keys_paging_state = co_await find_index_clustering_rows(qp, state, *internal_options);
-                if (result_primary_keys_paging_state.has_error()) {
-                    co_return failed_result_to_result_message(std::move(result_primary_keys_paging_state));
+                std::exception_ptr ex;
+                try {
+                    auto base_result = co_await do_execute_base_query(qp, std::move(base_keys), state, *internal_options, now, paging_state);
+                    if (base_result.has_error()) {
+                        co_await drop_next_keys();
+                        co_return std::move(base_result).as_failure();
+                    }
+                    auto&& [results, cmd] = base_result.assume_value();
+                    auto [stop_reading, consumed_whole_page] = consume_results(std::move(results), std::move(cmd), std::move(paging_state));
+                    stop = stop_reading;
+                    if (stop || !consumed_whole_page) {
+                        co_await drop_next_keys();
+                    }
+                } catch (...) {
+                    ex = std::current_exception();
                 }
-                auto&& [primary_keys, paging_state] = result_primary_keys_paging_state.assume_value();
-                auto result_results_cmd = co_await this->do_execute_base_query(qp, std::move(primary_keys), state, *internal_options, now, paging_state);
-                if (result_results_cmd.has_error()) {
-                    co_return failed_result_to_result_message(std::move(result_results_cmd));
+                if (ex) {
+                    co_await drop_next_keys();
+                    std::rethrow_exception(std::move(ex));
                 }
-                auto&& [results, cmd] = result_results_cmd.assume_value();
-                stop = consume_results(std::move(results), std::move(cmd), std::move(paging_state));
-            }
-        } while (!stop);
+            } while (!stop);
+            co_return bo::success();
+        };
+
+        coordinator_result<void> aggregated;
+        if (whole_partitions || partition_slices) {
+            tracing::trace(state.get_trace_state(), "Consulting index {} for a single slice of keys, aggregation query", _index.metadata().name());
+            aggregated = co_await aggregate_pages.operator()<dht::partition_range_vector>([&] (const query_options& o) {
+                return find_index_partition_ranges(qp, state, o);
+            });
+        } else {
+            tracing::trace(state.get_trace_state(), "Consulting index {} for a list of rows containing keys, aggregation query", _index.metadata().name());
+            aggregated = co_await aggregate_pages.operator()<std::vector<primary_key>>([&] (const query_options& o) {
+                return find_index_clustering_rows(qp, state, o);
+            });
+        }
+        if (aggregated.has_error()) {
+            co_return failed_result_to_result_message(std::move(aggregated));
+        }
 
         auto rs = builder.build();
         update_stats_rows_read(rs->size());
@@ -1277,6 +1418,74 @@ indexed_table_select_statement::do_execute(query_processor& qp,
     }
 }
 
+// Reads the rows matching the query straight from the index view, which
+// holds copies of all the selected columns. The view rows are read in the
+// same order, and paged with the same paging state, as the posting list is
+// when the base table is queried, so the results and the paging state are
+// the same as the base table lookup would have produced.
+future<shared_ptr<cql_transport::messages::result_message>>
+indexed_table_select_statement::execute_covered_query(query_processor& qp,
+        service::query_state& state,
+        const query_options& options,
+        gc_clock::time_point now) const
+{
+    ++_stats.secondary_index_covered_reads;
+    auto timeout = db::timeout_clock::now() + get_timeout(state.get_client_state(), options);
+    dht::partition_range_vector partition_ranges = _get_partition_ranges_for_posting_list(options);
+    auto partition_slice = _get_partition_slice_for_posting_list(options);
+    partition_slice.regular_columns = _covering_selection->get_columns()
+            | std::views::filter(std::mem_fn(&column_definition::is_regular))
+            | std::views::transform(std::mem_fn(&column_definition::id))
+            | std::ranges::to<query::column_id_vector>();
+
+    auto cmd = ::make_lw_shared<query::read_command>(
+            _view_schema->id(),
+            _view_schema->version(),
+            partition_slice,
+            qp.proxy().get_max_result_size(partition_slice),
+            query::tombstone_limit(qp.proxy().get_tombstone_limit()),
+            query::row_limit(get_inner_loop_limit(get_limit(options, _limit), false)),
+            query::partition_limit(query::max_partitions),
+            now,
+            tracing::make_trace_info(state.get_trace_state()),
+            query_id::create_null_id(),
+            query::is_first_page::no,
+            options.get_timestamp(state));
+
+    // The covering selection lists the view columns in the order of the
+    // statement's selection, so the view rows can be fed directly to a
+    // builder of the statement's result set.
+    cql3::selection::result_set_builder builder(*_selection, now, &options);
+    lw_shared_ptr<const service::pager::paging_state> paging_state;
+    const int32_t page_size = options.get_page_size();
+    if (page_size <= 0 || !service::pager::query_pagers::may_need_paging(*_view_schema, page_size, *cmd, partition_ranges)) {
+        auto qr = co_await qp.proxy().query_result(_view_schema, cmd, std::move(partition_ranges), options.get_consistency(),
+                {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
+        if (qr.has_error()) {
+            co_return failed_result_to_result_message(std::move(qr));
+        }
+        query::result_view::consume(*qr.value().query_result, cmd->slice,
+                cql3::selection::result_set_builder::visitor(builder, *_view_schema, *_covering_selection));
+    } else {
+        auto p = service::pager::query_pagers::pager(qp.proxy(), _view_schema, _covering_selection,
+                state, options, cmd, std::move(partition_ranges), nullptr);
+        auto page = co_await p->fetch_page_result(builder, page_size, now, timeout);
+        if (page.has_error()) {
+            co_return failed_result_to_result_message(std::move(page));
+        }
+        if (!p->is_exhausted()) {
+            paging_state = p->state();
+        }
+    }
+
+    auto rs = builder.build();
+    if (paging_state) {
+        rs->get_metadata().set_paging_state(std::move(paging_state));
+    }
+    update_stats_rows_read(rs->size());
+    co_return ::make_shared<cql_transport::messages::result_message::rows>(result(std::move(rs)));
+}
+
 dht::partition_range_vector indexed_table_select_statement::get_partition_ranges_for_local_index_posting_list(const query_options& options) const {
     return _restrictions->get_partition_key_ranges(options);
 }
@@ -1342,6 +1551,11 @@ indexed_table_select_statement::read_posting_list(query_processor& qp,
 {
     dht::partition_range_vector partition_ranges = _get_partition_ranges_for_posting_list(options);
     auto partition_slice = _get_partition_slice_for_posting_list(options);
+    if (_index.metadata().options().contains(index_target::included_columns_option_name)) {
+        // The posting list is made of the view's key columns; don't read
+        // the included columns' copies.
+        partition_slice.regular_columns.clear();
+    }
 
     auto cmd = ::make_lw_shared<query::read_command>(
             _view_schema->id(),
@@ -1548,6 +1762,12 @@ class parallelized_select_statement : public select_statement {
         service::query_state& state,
         const query_options& options
     ) const override;
+
+    std::vector<const column_definition*> get_group_by_columns() const;
+
+    // Turns merged groups of a GROUP BY query into the result set the regular,
+    // non-parallelized algorithm would have produced.
+    std::unique_ptr<result_set> build_grouped_result_set(std::vector<std::vector<bytes_opt>> groups, const query_options& options) const;
 };
 
 ::shared_ptr<cql3::statements::select_statement> parallelized_select_statement::prepare(
@@ -1615,6 +1835,13 @@ parallelized_select_statement::do_execute(
     service::query_state& state,
     const query_options& options
 ) const {
+    if (has_group_by() && options.get_paging_state()) {
+        // A page after the first one: the first page didn't fit all the
+        // groups, and was served by the regular, paged algorithm.
+        ++_stats.select_parallelized_fallbacks;
+        return select_statement::do_execute(qp, state, options);
+    }
+
     tracing::add_table_name(state.get_trace_state(), keyspace(), column_family());
 
     auto cl = options.get_consistency();
@@ -1660,6 +1887,20 @@ parallelized_select_statement::do_execute(
     auto timeout = lowres_system_clock::now() + timeout_duration;
     auto reductions = _selection->get_reductions();
 
+    std::optional<std::vector<sstring>> group_by_column_names;
+    std::optional<uint64_t> max_groups;
+    if (has_group_by()) {
+        group_by_column_names = get_group_by_columns()
+                | std::views::transform(std::mem_fn(&column_definition::name_as_text))
+                | std::ranges::to<std::vector<sstring>>();
+        // The groups are returned in a single page, so more groups than fit
+        // in one are served by the regular algorithm. Have the shards give
+        // up as soon as they find that many, instead of scanning everything.
+        if (auto page_size = options.get_page_size(); page_size > 0) {
+            max_groups = page_size;
+        }
+    }
+
     query::mapreduce_request req = {
         .reduction_types = reductions.types,
         .cmd = *command,
@@ -1667,20 +1908,120 @@ parallelized_select_statement::do_execute(
         .cl = options.get_consistency(),
         .timeout = timeout,
         .aggregation_infos = reductions.infos,
+        .group_by_column_names = std::move(group_by_column_names),
+        .max_groups = max_groups,
     };
 
     // dispatch execution of this statement to other nodes
-    return qp.mapreduce(req, state.get_trace_state()).then([this] (query::mapreduce_result res) {
-        auto meta = _selection->get_result_metadata();
-        auto rs = std::make_unique<result_set>(std::move(meta));
-        rs->add_row(res.query_results);
+    return qp.mapreduce(req, state.get_trace_state()).then([this, &qp, &state, &options] (query::mapreduce_result res) {
+        if (res.group_limit_exceeded) {
+            // Too many groups to merge in memory, or to return in a page;
+            // run the regular, paged algorithm instead.
+            tracing::trace(state.get_trace_state(), "Too many groups for parallelized GROUP BY, falling back to paged aggregation");
+            ++_stats.select_parallelized_fallbacks;
+            return select_statement::do_execute(qp, state, options);
+        }
+        std::unique_ptr<result_set> rs;
+        if (res.grouped_query_results) {
+            rs = build_grouped_result_set(std::move(*res.grouped_query_results), options);
+            // The groups are returned in a single page, without a paging
+            // state. The request's max_groups keeps them within a page, this
+            // is a safety net in case they still don't fit.
+            auto page_size = options.get_page_size();
+            if (page_size > 0 && rs->size() > size_t(page_size)) {
+                tracing::trace(state.get_trace_state(), "{} groups don't fit in a page of {} rows, falling back to paged aggregation", rs->size(), page_size);
+                ++_stats.select_parallelized_fallbacks;
+                return select_statement::do_execute(qp, state, options);
+            }
+        } else {
+            auto meta = _selection->get_result_metadata();
+            rs = std::make_unique<result_set>(std::move(meta));
+            rs->add_row(res.query_results);
+        }
         update_stats_rows_read(rs->size());
-        return shared_ptr<cql_transport::messages::result_message>(
+        return make_ready_future<shared_ptr<cql_transport::messages::result_message>>(
             make_shared<cql_transport::messages::result_message::rows>(result(std::move(rs)))
         );
     });
 }
 
+std::vector<const column_definition*> parallelized_select_statement::get_group_by_columns() const {
+    return *_group_by_cell_indices
+            | std::views::transform([this] (size_t idx) { return _selection->get_columns()[idx]; })
+            | std::ranges::to<std::vector<const column_definition*>>();
+}
+
+std::unique_ptr<result_set>
+parallelized_select_statement::build_grouped_result_set(std::vector<std::vector<bytes_opt>> groups, const query_options& options) const {
+    const auto group_by_columns = get_group_by_columns();
+    const size_t group_by_size = group_by_columns.size();
+    const size_t pk_size = _schema->partition_key_size();
+
+    // Groups are merged by hash on the coordinators, so they arrive in no
+    // particular order. Restore ring order of partitions, then clustering
+    // order within a partition. The first pk_size GROUP BY columns are the
+    // partition key (ensured by prepare()).
+    struct group {
+        dht::decorated_key dk;
+        std::vector<bytes_opt> row;
+    };
+    std::vector<group> sorted;
+    sorted.reserve(groups.size());
+    for (auto& row : groups) {
+        auto pk = partition_key::from_exploded(*_schema, row
+                | std::views::take(pk_size)
+                | std::views::transform([] (const bytes_opt& v) { return v.value_or(bytes()); })
+                | std::ranges::to<std::vector<bytes>>());
+        sorted.push_back(group{dht::decorate_key(*_schema, std::move(pk)), std::move(row)});
+    }
+    std::ranges::sort(sorted, [&] (const group& a, const group& b) {
+        if (auto c = a.dk.tri_compare(*_schema, b.dk); c != 0) {
+            return c < 0;
+        }
+        for (size_t i = pk_size; i < group_by_size; i++) {
+            const auto& x = a.row[i];
+            const auto& y = b.row[i];
+            if (!x || !y) {
+                // A missing clustering value (static row only) sorts first.
+                if (bool(x) != bool(y)) {
+                    return !x;
+                }
+                continue;
+            }
+            if (auto c = group_by_columns[i]->type->compare(*x, *y); c != 0) {
+                return c < 0;
+            }
+        }
+        return false;
+    });
+
+    const auto parsed_limit = get_limit(options, _limit);
+    const uint64_t limit = parsed_limit.has_value() ? parsed_limit.value() : query::max_rows;
+
+    // Every selector is either a reference to a GROUP BY column or the next
+    // reduction, in selection order (ensured by is_reducible_with_group_by()).
+    const auto plain_columns = _selection->get_plain_column_selectors();
+    auto rs = std::make_unique<result_set>(_selection->get_result_metadata());
+    for (auto& g : sorted) {
+        if (rs->size() >= limit) {
+            break;
+        }
+        std::vector<managed_bytes_opt> output;
+        output.reserve(plain_columns.size());
+        size_t reduction_idx = group_by_size;
+        for (auto col : plain_columns) {
+            if (col) {
+                auto idx = std::ranges::find(group_by_columns, col) - group_by_columns.begin();
+                output.emplace_back(to_managed_bytes_opt(g.row[idx]));
+            } else {
+                output.emplace_back(to_managed_bytes_opt(g.row[reduction_idx++]));
+            }
+        }
+        rs->add_row(std::move(output));
+    }
+    return rs;
+}
+
 mutation_fragments_select_statement::mutation_fragments_select_statement(
             schema_ptr output_schema,
             schema_ptr underlying_schema,
@@ -2063,17 +2404,55 @@ std::unique_ptr<prepared_statement> select_statement::prepare(data_dictionary::d
                 == locator::replication_strategy_type::local;
     };
 
+    // Aggregates with constant arguments, like approx_percentile(col, 0.99),
+    // need the constants to be sent along with the mapreduce request.
+    auto has_constant_aggregate_arguments = [] (const std::vector<selection::prepared_selector>& prepared_selectors) {
+        return std::ranges::any_of(
+            prepared_selectors | std::views::transform(std::mem_fn(&selection::prepared_selector::expr)),
+            [] (const expr::expression& e) {
+                auto fn_expr = expr::as_if<expr::function_call>(&e);
+                return fn_expr && std::ranges::any_of(fn_expr->args, expr::is<expr::constant>);
+            }
+        );
+    };
+
+    // GROUP BY queries can be parallelized when every selector is either a
+    // reducible aggregate or a GROUP BY column. Groups are merged by key and
+    // then sorted back by partition and clustering key, so the GROUP BY must
+    // list the whole partition key, and options which depend on the order of
+    // the scan itself (ORDER BY, PER PARTITION LIMIT, DISTINCT) aren't supported.
+    auto can_group_by_be_mapreduced = [&] {
+        auto group_by_columns = *group_by_cell_indices
+                | std::views::transform([&] (size_t idx) { return selection->get_columns()[idx]; })
+                | std::ranges::to<std::vector<const column_definition*>>();
+        auto starts_with_partition_key = group_by_columns.size() >= schema->partition_key_size()
+                && std::ranges::equal(
+                        group_by_columns | std::views::take(schema->partition_key_size()),
+                        schema->partition_key_columns(),
+                        [] (const column_definition* a, const column_definition& b) { return a == &b; });
+        return db.features().parallelized_group_by
+            && db.get_config().parallelized_group_by_max_groups() > 0
+            && selection->is_aggregate()
+            && selection->is_reducible_with_group_by(group_by_columns)
+            && starts_with_partition_key
+            && _parameters->orderings().empty()
+            && !_parameters->is_distinct()
+            && !_per_partition_limit;
+    };
+
     // Used to determine if an execution of this statement can be parallelized
     // using `mapreduce_service`.
     auto can_be_mapreduced = [&] {
-        return all_aggregates(prepared_selectors)   // Note: before we levellized aggregation depth
-            && ( // SUPPORTED PARALLELIZATION
-                 // All potential intermediate coordinators must support mapreduceing
-                (db.features().parallelized_aggregation && selection->is_count())
-                || (db.features().uda_native_parallelized_aggregation && selection->is_reducible())
-            )
+        return (group_by_cell_indices->empty()
+                ? all_aggregates(prepared_selectors)   // Note: before we levellized aggregation depth
+                    && ( // SUPPORTED PARALLELIZATION
+                         // All potential intermediate coordinators must support mapreduceing
+                        (db.features().parallelized_aggregation && selection->is_count())
+                        || (db.features().uda_native_parallelized_aggregation && selection->is_reducible())
+                    )
+                : can_group_by_be_mapreduced())
+            && (db.features().parallelized_aggregation_constant_arguments || !has_constant_aggregate_arguments(prepared_selectors))
             && !restrictions->need_filtering()  // No filtering
-            && group_by_cell_indices->empty()   // No GROUP BY
             && db.get_config().enable_parallelized_aggregation()
             && !is_local_table()
             && !( // Do not parallelize the request if it's single partition read
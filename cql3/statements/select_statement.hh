@@ -185,6 +185,9 @@ class indexed_table_select_statement : public select_statement {
     schema_ptr _view_schema;
     noncopyable_function<dht::partition_range_vector(const query_options&)> _get_partition_ranges_for_posting_list;
     noncopyable_function<query::partition_slice(const query_options&)> _get_partition_slice_for_posting_list;
+    // Selection of the index view's copies of the selected columns, set if
+    // the index covers the query (see make_covering_selection()).
+    ::shared_ptr<selection::selection> _covering_selection;
 public:
     static constexpr size_t max_base_table_query_concurrency = 4096;
 
@@ -222,6 +225,14 @@ class indexed_table_select_statement : public select_statement {
     virtual future<::shared_ptr<cql_transport::messages::result_message>> do_execute(query_processor& qp,
             service::query_state& state, const query_options& options) const override;
 
+    // Returns a selection of the index view columns holding the selected
+    // columns if the query can be answered from the index view alone, without
+    // reading the base table, or nullptr otherwise.
+    ::shared_ptr<selection::selection> make_covering_selection() const;
+
+    future<::shared_ptr<cql_transport::messages::result_message>> execute_covered_query(query_processor& qp,
+            service::query_state& state, const query_options& options, gc_clock::time_point now) const;
+
     lw_shared_ptr<const service::pager::paging_state> generate_view_paging_state_from_base_query_results(lw_shared_ptr<const service::pager::paging_state> paging_state,
             const foreign_ptr<lw_shared_ptr<query::result>>& results, service::query_state& state, const query_options& options) const;
 
@@ -266,11 +277,11 @@ class indexed_table_select_statement : public select_statement {
     // Function for fetching the selected columns from a list of clustering rows.
     // It is currently used only in our Secondary Index implementation - ordinary
     // CQL SELECT statements do not have the syntax to request a list of rows.
-    // FIXME: The current implementation is very inefficient - it requests each
-    // row separately (and, incrementally, in parallel). Even multiple rows from a single
-    // partition are requested separately. This last case can be easily improved,
-    // but to implement the general case (multiple rows from multiple partitions)
-    // efficiently, we will need more support from other layers.
+    // All the rows of a partition are requested with a single read, as are
+    // consecutive partitions whose rows have the same clustering keys. The
+    // reads are sent incrementally, in parallel.
+    // FIXME: a slice can't hold different clustering ranges for different
+    // partitions, so partitions with different rows are read separately.
     // Keys are ordered in token order (see #3423)
     future<coordinator_result<std::tuple<foreign_ptr<lw_shared_ptr<query::result>>, lw_shared_ptr<query::read_command>>>>
     do_execute_base_query(
@@ -69,6 +69,7 @@ struct cql_stats {
     int64_t secondary_index_drops = 0;
     int64_t secondary_index_reads = 0;
     int64_t secondary_index_rows_read = 0;
+    int64_t secondary_index_covered_reads = 0;
 
     int64_t filtered_reads = 0;
     int64_t filtered_rows_matched_total = 0;
@@ -79,6 +80,7 @@ struct cql_stats {
     int64_t select_partition_range_scan = 0;
     int64_t select_partition_range_scan_no_bypass_cache = 0;
     int64_t select_parallelized = 0;
+    int64_t select_parallelized_fallbacks = 0;
 
     uint64_t minimum_replication_factor_fail_violations = 0;
     uint64_t minimum_replication_factor_warn_violations = 0;
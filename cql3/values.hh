@@ -242,7 +242,7 @@ class raw_value {
     }
     bytes_opt to_bytes_opt() && {
         return std::visit(overloaded_functor{
-            [](bytes&& bytes_val) { return bytes_opt(bytes_val); },
+            [](bytes&& bytes_val) { return bytes_opt(std::move(bytes_val)); },
             [](managed_bytes&& managed_bytes_val) { return bytes_opt(::to_bytes(managed_bytes_val)); },
             [](null_value&&) -> bytes_opt {
                 return std::nullopt;
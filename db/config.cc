@@ -760,6 +760,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Throttles streaming I/O to the specified total throughput (in MiBs/s) across the entire system. Streaming I/O includes the one performed by repair and both RBNO and legacy topology operations such as adding or removing a node. Setting the value to 0 disables stream throttling.")
     , stream_plan_ranges_fraction(this, "stream_plan_ranges_fraction", liveness::LiveUpdate, value_status::Used, 0.1,
         "Specify the fraction of ranges to stream in a single stream plan. Value is between 0 and 1.")
+    , enable_file_stream(this, "enable_file_stream", liveness::LiveUpdate, value_status::Used, false,
+        "Set true to stream the sstables of migrated tablets as whole files, when possible, instead of streaming their mutations. Experimental.")
     , trickle_fsync(this, "trickle_fsync", value_status::Unused, false,
         "When doing sequential writing, enabling this option tells fsync to force the operating system to flush the dirty buffers at a set interval trickle_fsync_interval_in_kb. Enable this parameter to avoid sudden dirty buffer flushing from impacting read latencies. Recommended to use on SSDs, but not on HDDs.")
     , trickle_fsync_interval_in_kb(this, "trickle_fsync_interval_in_kb", value_status::Unused, 10240,
@@ -834,8 +836,10 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     * @GroupDescription Counter cache helps to reduce counter locks' contention for hot counter cells. In case of RF = 1 a counter cache hit will cause Cassandra to skip the read before write entirely. With RF > 1 a counter cache hit will still help to reduce the duration of the lock hold, helping with hot counter cell updates, but will not allow skipping the read entirely. Only the local (clock, count) tuple of a counter cell is kept in memory, not the whole counter, so it's relatively cheap.
       Note: Reducing the size counter cache may result in not getting the hottest keys loaded on start-up.
     */
-    , counter_cache_size_in_mb(this, "counter_cache_size_in_mb", value_status::Unused, 0,
-        "When no value is specified a minimum of 2.5% of Heap or 50MB. If you perform counter deletes and rely on low gc_grace_seconds, you should disable the counter cache. To disable, set to 0")
+    , counter_cache_size_in_mb(this, "counter_cache_size_in_mb", value_status::Used, 0,
+        "Per-shard memory, in megabytes, for caching the local shards of recently updated counter cells. "
+        "Updates of cached counter cells skip the read of the current counter state. "
+        "0 disables the cache.")
     , counter_cache_save_period(this, "counter_cache_save_period", value_status::Unused, 7200,
         "Duration after which Cassandra should save the counter cache (keys only). Caches are saved to saved_caches_directory.")
     , counter_cache_keys_to_save(this, "counter_cache_keys_to_save", value_status::Unused, 0,
@@ -857,6 +861,9 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , group0_tombstone_gc_refresh_interval_in_ms(this, "group0_tombstone_gc_refresh_interval_in_ms", value_status::Used,
               std::chrono::duration_cast<std::chrono::milliseconds>(60min).count(),
               "The interval in milliseconds at which we update the time point for safe tombstone expiration in group0 tables.")
+    , group0_raft_max_in_flight_append_requests(this, "group0_raft_max_in_flight_append_requests", value_status::Used, 10,
+              "The maximum number of append requests the group0 leader keeps in flight to a follower which is in sync."
+              " Higher values allow more log entries to be replicated per round trip. Must be greater than zero.")
     /**
     * @Group Network timeout settings
     */
@@ -868,12 +875,29 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "The time that the coordinator waits for counter writes to complete.")
     , cas_contention_timeout_in_ms(this, "cas_contention_timeout_in_ms", liveness::LiveUpdate, value_status::Used, 1000,
         "The time that the coordinator continues to retry a CAS (compare and set) operation that contends with other proposals for the same row.")
+    , lwt_background_learn(this, "lwt_background_learn", liveness::LiveUpdate, value_status::Used, false,
+        "Respond to lightweight transactions which do not need to wait for the learn (commit) phase as soon as their proposal is accepted by a quorum, "
+        "and learn it in the background. This applies when the commit consistency level is ANY, and when nothing is written, because the condition "
+        "was not met or the transaction only reads with SERIAL consistency. Saves a round trip on such transactions.")
     , truncate_request_timeout_in_ms(this, "truncate_request_timeout_in_ms", liveness::LiveUpdate, value_status::Used, 60000,
         "The time that the coordinator waits for truncates (remove all data from a table) to complete. The long default value allows for a snapshot to be taken before removing the data. If auto_snapshot is disabled (not recommended), you can reduce this time.")
     , write_request_timeout_in_ms(this, "write_request_timeout_in_ms", liveness::LiveUpdate, value_status::Used, 2000,
         "The time in milliseconds that the coordinator waits for write operations to complete.\n"
         "\n"
         "Related information: About hinted handoff writes")
+    , write_rpc_batching_window_in_us(this, "write_rpc_batching_window_in_us", liveness::LiveUpdate, value_status::Used, 0,
+        "The time in microseconds for which the coordinator collects small writes headed for the same replica, to send them in a single request. "
+        "Every write is still acknowledged on its own. Trades a little write latency for fewer requests and less CPU per write. 0 disables batching.")
+    , enable_shard_aware_rpc_connections(this, "enable_shard_aware_rpc_connections", liveness::LiveUpdate, value_status::Used, false,
+        "Send reads and writes to replicas over connections to the shards which own the data, instead of connections to the nodes, which are accepted on any shard. "
+        "Saves the replicas forwarding the requests to the owning shards, at the cost of more connections: each shard connects to every shard of the other nodes. "
+        "Writes batched by write_rpc_batching_window_in_us are still sent over the connections to the nodes. "
+        "The connections to the shards are made to shard_aware_storage_port, or shard_aware_ssl_storage_port if encrypted.")
+    , shard_aware_storage_port(this, "shard_aware_storage_port", value_status::Used, 17000,
+        "The port for inter-node communication on which a connection is accepted on the shard given by the port it comes from, modulo the number of shards. "
+        "Must be the same on all the nodes, as storage_port. 0 disables it.")
+    , shard_aware_ssl_storage_port(this, "shard_aware_ssl_storage_port", value_status::Used, 17001,
+        "Like shard_aware_storage_port, but for encrypted communication. Unused unless enabled in encryption_options.")
     , request_timeout_in_ms(this, "request_timeout_in_ms", liveness::LiveUpdate, value_status::Used, 10000,
         "The default timeout for other, miscellaneous operations.\n"
         "\n"
@@ -970,6 +994,9 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Idle threads are stopped after 30 seconds.\n")
     , native_transport_max_frame_size_in_mb(this, "native_transport_max_frame_size_in_mb", value_status::Unused, 256,
         "The maximum size of allowed frame. Frame (requests) larger than this are rejected as invalid.")
+    , native_transport_zstd_max_cpu_fraction(this, "native_transport_zstd_max_cpu_fraction", liveness::LiveUpdate, value_status::Used, 0.05,
+        "ZSTD compression of CQL responses (negotiated with the SCYLLA_ZSTD_DICT_COMPRESSION protocol extension) will consume at most this fraction "
+        "of each 20 ms time slice of a shard. When exceeded, the responses are compressed with lz4 until the end of the time slice.")
     /**
     * @Group RPC (remote procedure call) settings
     * @GroupDescription Settings for configuring and tuning client connections.
@@ -984,6 +1011,10 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Enable or disable keepalive on client connections (CQL native, Redis and the maintenance socket).")
     , cache_hit_rate_read_balancing(this, "cache_hit_rate_read_balancing", value_status::Used, true,
         "This boolean controls whether the replicas for read query will be chosen based on cache hit ratio.")
+    , adaptive_replica_selection(this, "adaptive_replica_selection", liveness::LiveUpdate, value_status::Used, false,
+        "When enabled, the replicas of the local datacenter for a single-partition read are ranked by their predicted response time, "
+        "estimated from the latency observed by the coordinator and from the queue length and service time reported by the replicas. "
+        "The best ranked replicas are queried, and the next one is used for speculative retry. This replaces cache_hit_rate_read_balancing for these reads.")
     /**
     * @Group Advanced fault detection settings
     * @GroupDescription Settings to handle poorly performing or failing nodes.
@@ -1141,6 +1172,7 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "The multishard reader has a read-ahead feature to improve latencies of range-scans. This feature can be detrimental when the multishard reader is used under repair, as is the case in repair in mixed-shard clusters."
         " This know allows disabling this read-ahead (default), this can help the performance of mixed-shard repair (including RBNO).")
     , enable_small_table_optimization_for_rbno(this, "enable_small_table_optimization_for_rbno", liveness::LiveUpdate, value_status::Used, true, "Set true to enable small table optimization for repair based node operations")
+    , enable_incremental_repair(this, "enable_incremental_repair", liveness::LiveUpdate, value_status::Used, false, "Set true to make repair of tablet tables incremental: the sstables are marked as repaired after a successful repair, and subsequent repairs only compare the data which isn't repaired yet. Repaired and unrepaired sstables are never compacted together. Only repairs of all replicas of a tablet are incremental.")
     , ring_delay_ms(this, "ring_delay_ms", value_status::Used, 30 * 1000, "Time a node waits to hear from other nodes before joining the ring in milliseconds. Same as -Dcassandra.ring_delay_ms in cassandra.")
     , shadow_round_ms(this, "shadow_round_ms", value_status::Used, 300 * 1000, "The maximum gossip shadow round time. Can be used to reduce the gossip feature check time during node boot up.")
     , fd_max_interval_ms(this, "fd_max_interval_ms", value_status::Used, 2 * 1000, "The maximum failure_detector interval time in milliseconds. Interval larger than the maximum will be ignored. Larger cluster may need to increase the default.")
@@ -1196,6 +1228,14 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , max_memory_for_unlimited_query_hard_limit(this, "max_memory_for_unlimited_query_hard_limit", "max_memory_for_unlimited_query", liveness::LiveUpdate, value_status::Used, (uint64_t(100) << 20),
             "Maximum amount of memory a query, whose memory consumption is not naturally limited, is allowed to consume, e.g. non-paged and reverse queries. "
             "This is the hard limit, queries violating this limit will be aborted.")
+    , query_result_cache_size_in_mb(this, "query_result_cache_size_in_mb", value_status::Used, 0,
+            "Per-shard memory, in megabytes, for caching the results of reads of frequently read partitions. "
+            "Repeated identical reads of such partitions are answered from the cache, until the partition is written to. "
+            "0 disables the cache.")
+    , query_result_cache_max_result_size_in_kb(this, "query_result_cache_max_result_size_in_kb", value_status::Used, 16,
+            "Largest read result, in kilobytes, which can be stored in the query result cache.")
+    , cache_unprepared_statements(this, "cache_unprepared_statements", liveness::LiveUpdate, value_status::Used, true,
+            "Keep the statements of unprepared CQL queries in the prepared statements cache, so that repeated queries with the same text are not parsed and prepared again.")
     , reader_concurrency_semaphore_serialize_limit_multiplier(this, "reader_concurrency_semaphore_serialize_limit_multiplier", liveness::LiveUpdate, value_status::Used, 2,
             "Start serializing reads after their collective memory consumption goes above $normal_limit * $multiplier.")
     , reader_concurrency_semaphore_kill_limit_multiplier(this, "reader_concurrency_semaphore_kill_limit_multiplier", liveness::LiveUpdate, value_status::Used, 4,
@@ -1226,6 +1266,10 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Time period in seconds after which unused schema versions will be evicted from the local schema registry cache. Default is 1 second.")
     , max_concurrent_requests_per_shard(this, "max_concurrent_requests_per_shard", liveness::LiveUpdate, value_status::Used, std::numeric_limits<uint32_t>::max(),
         "Maximum number of concurrent requests a single shard can handle before it starts shedding extra load. By default, no requests will be shed.")
+    , cql_queueing_delay_shedding_ratio(this, "cql_queueing_delay_shedding_ratio", liveness::LiveUpdate, value_status::Used, 0,
+        "Shed CQL requests of interactive workloads as soon as their frame is read, when the estimated queueing delay of their scheduling group exceeds "
+        "this fraction of the request timeout. The delay is estimated from the number of requests of the scheduling group in flight, and the rate "
+        "at which they were recently completed. 0 disables this kind of shedding.")
     , cdc_dont_rewrite_streams(this, "cdc_dont_rewrite_streams", value_status::Used, false,
             "Disable rewriting streams from cdc_streams_descriptions to cdc_streams_descriptions_v2. Should not be necessary, but the procedure is expensive and prone to failures; this config option is left as a backdoor in case some user requires manual intervention.")
     , strict_allow_filtering(this, "strict_allow_filtering", liveness::LiveUpdate, value_status::Used, strict_allow_filtering_default(), "Match Cassandra in requiring ALLOW FILTERING on slow queries. Can be true, false, or warn. When false, Scylla accepts some slow queries even without ALLOW FILTERING that Cassandra rejects. Warn is same as false, but with warning.")
@@ -1247,6 +1291,9 @@ db::config::config(std::shared_ptr<db::extensions> exts)
             "Make the system.config table UPDATEable.")
     , enable_parallelized_aggregation(this, "enable_parallelized_aggregation", liveness::LiveUpdate, value_status::Used, true,
             "Use on a new, parallel algorithm for performing aggregate queries.")
+    , parallelized_group_by_max_groups(this, "parallelized_group_by_max_groups", liveness::LiveUpdate, value_status::Used, 100000,
+            "Maximum number of groups a parallelized GROUP BY aggregation may hold in memory on a single shard or coordinator. "
+            "Queries producing more groups fall back to the regular, paged algorithm. Set to 0 to never parallelize GROUP BY queries.")
     , cql_duplicate_bind_variable_names_refer_to_same_variable(this, "cql_duplicate_bind_variable_names_refer_to_same_variable", liveness::LiveUpdate, value_status::Used, true,
             "A bind variable that appears twice in a CQL query refers to a single variable (if false, no name matching is performed).")
     , alternator_port(this, "alternator_port", value_status::Used, 0, "Alternator API port.")
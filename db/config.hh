@@ -243,6 +243,7 @@ class config final : public utils::config_file {
     named_value<uint32_t> inter_dc_stream_throughput_outbound_megabits_per_sec;
     named_value<uint32_t> stream_io_throughput_mb_per_sec;
     named_value<double> stream_plan_ranges_fraction;
+    named_value<bool> enable_file_stream;
     named_value<bool> trickle_fsync;
     named_value<uint32_t> trickle_fsync_interval_in_kb;
     named_value<bool> auto_bootstrap;
@@ -270,12 +271,18 @@ class config final : public utils::config_file {
     named_value<uint64_t> query_tombstone_page_limit;
     named_value<uint64_t> query_page_size_in_bytes;
     named_value<uint32_t> group0_tombstone_gc_refresh_interval_in_ms;
+    named_value<uint32_t> group0_raft_max_in_flight_append_requests;
     named_value<uint32_t> range_request_timeout_in_ms;
     named_value<uint32_t> read_request_timeout_in_ms;
     named_value<uint32_t> counter_write_request_timeout_in_ms;
     named_value<uint32_t> cas_contention_timeout_in_ms;
+    named_value<bool> lwt_background_learn;
     named_value<uint32_t> truncate_request_timeout_in_ms;
     named_value<uint32_t> write_request_timeout_in_ms;
+    named_value<uint32_t> write_rpc_batching_window_in_us;
+    named_value<bool> enable_shard_aware_rpc_connections;
+    named_value<uint16_t> shard_aware_storage_port;
+    named_value<uint16_t> shard_aware_ssl_storage_port;
     named_value<uint32_t> request_timeout_in_ms;
     named_value<bool> cross_node_timeout;
     named_value<uint32_t> internode_send_buff_size_in_bytes;
@@ -305,11 +312,13 @@ class config final : public utils::config_file {
     named_value<uint16_t> native_shard_aware_transport_port_ssl;
     named_value<uint32_t> native_transport_max_threads;
     named_value<uint32_t> native_transport_max_frame_size_in_mb;
+    named_value<float> native_transport_zstd_max_cpu_fraction;
     named_value<sstring> broadcast_rpc_address;
     named_value<uint16_t> rpc_port;
     named_value<bool> start_rpc;
     named_value<bool> rpc_keepalive;
     named_value<bool> cache_hit_rate_read_balancing;
+    named_value<bool> adaptive_replica_selection;
     named_value<double> dynamic_snitch_badness_threshold;
     named_value<uint32_t> dynamic_snitch_reset_interval_in_ms;
     named_value<uint32_t> dynamic_snitch_update_interval_in_ms;
@@ -360,6 +369,7 @@ class config final : public utils::config_file {
     named_value<uint64_t> repair_multishard_reader_buffer_hint_size;
     named_value<uint64_t> repair_multishard_reader_enable_read_ahead;
     named_value<bool> enable_small_table_optimization_for_rbno;
+    named_value<bool> enable_incremental_repair;
     named_value<uint32_t> ring_delay_ms;
     named_value<uint32_t> shadow_round_ms;
     named_value<uint32_t> fd_max_interval_ms;
@@ -400,6 +410,9 @@ class config final : public utils::config_file {
     named_value<uint32_t> max_clustering_key_restrictions_per_query;
     named_value<uint64_t> max_memory_for_unlimited_query_soft_limit;
     named_value<uint64_t> max_memory_for_unlimited_query_hard_limit;
+    named_value<uint32_t> query_result_cache_size_in_mb;
+    named_value<uint32_t> query_result_cache_max_result_size_in_kb;
+    named_value<bool> cache_unprepared_statements;
     named_value<uint32_t> reader_concurrency_semaphore_serialize_limit_multiplier;
     named_value<uint32_t> reader_concurrency_semaphore_kill_limit_multiplier;
     named_value<uint32_t> reader_concurrency_semaphore_cpu_concurrency;
@@ -416,11 +429,13 @@ class config final : public utils::config_file {
     named_value<unsigned> user_defined_function_contiguous_allocation_limit_bytes;
     named_value<uint32_t> schema_registry_grace_period;
     named_value<uint32_t> max_concurrent_requests_per_shard;
+    named_value<float> cql_queueing_delay_shedding_ratio;
     named_value<bool> cdc_dont_rewrite_streams;
     named_value<tri_mode_restriction> strict_allow_filtering;
     named_value<tri_mode_restriction> strict_is_not_null_in_views;
     named_value<bool> enable_cql_config_updates;
     named_value<bool> enable_parallelized_aggregation;
+    named_value<uint32_t> parallelized_group_by_max_groups;
     named_value<bool> cql_duplicate_bind_variable_names_refer_to_same_variable;
 
     named_value<uint16_t> alternator_port;
@@ -26,6 +26,14 @@ class scalar_function : public virtual function {
      * @throws InvalidRequestException if this function cannot not be applied to the parameter
      */
     virtual bytes_opt execute(std::span<const bytes_opt> parameters) = 0;
+
+    /**
+     * Like execute(), but the function may consume its parameters, e.g. to
+     * update a large aggregation state in place instead of copying it.
+     */
+    virtual bytes_opt execute_consuming(std::span<bytes_opt> parameters) {
+        return execute(parameters);
+    }
 };
 
 
@@ -736,6 +736,9 @@ class clients_table : public streaming_virtual_table {
             .with_column("ssl_protocol", utf8_type)
             .with_column("username", utf8_type)
             .with_column("scheduling_group", utf8_type)
+            .with_column("compression", utf8_type)
+            .with_column("uncompressed_bytes_sent", long_type)
+            .with_column("compressed_bytes_sent", long_type)
             .with_hash_version()
             .build();
     }
@@ -845,6 +848,15 @@ class clients_table : public streaming_virtual_table {
                 if (cd.scheduling_group_name) {
                     set_cell(cr.cells(), "scheduling_group", *cd.scheduling_group_name);
                 }
+                if (cd.compression) {
+                    set_cell(cr.cells(), "compression", *cd.compression);
+                }
+                if (cd.uncompressed_bytes_sent) {
+                    set_cell(cr.cells(), "uncompressed_bytes_sent", *cd.uncompressed_bytes_sent);
+                }
+                if (cd.compressed_bytes_sent) {
+                    set_cell(cr.cells(), "compressed_bytes_sent", *cd.compressed_bytes_sent);
+                }
                 co_await result.emit_row(std::move(cr));
             }
             co_await result.emit_partition_end();
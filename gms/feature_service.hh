@@ -112,8 +112,26 @@ class feature_service final : public peering_sharded_service<feature_service> {
     gms::feature keyspace_storage_options { *this, "KEYSPACE_STORAGE_OPTIONS"sv };
     gms::feature typed_errors_in_read_rpc { *this, "TYPED_ERRORS_IN_READ_RPC"sv };
     gms::feature uda_native_parallelized_aggregation { *this, "UDA_NATIVE_PARALLELIZED_AGGREGATION"sv };
+    gms::feature parallelized_group_by { *this, "PARALLELIZED_GROUP_BY"sv };
+    gms::feature parallelized_aggregation_constant_arguments { *this, "PARALLELIZED_AGGREGATION_CONSTANT_ARGUMENTS"sv };
     gms::feature aggregate_storage_options { *this, "AGGREGATE_STORAGE_OPTIONS"sv };
     gms::feature collection_indexing { *this, "COLLECTION_INDEXING"sv };
+    gms::feature covering_indexes { *this, "COVERING_INDEXES"sv };
+    // Replicas understand the READ_DATA_MULTI verb, which reads several
+    // singular partition ranges in one request.
+    gms::feature batched_singular_reads { *this, "BATCHED_SINGULAR_READS"sv };
+    // Replicas understand the MUTATION_BATCH verb, which carries several
+    // writes of a coordinator, each acknowledged on its own.
+    gms::feature batched_mutations { *this, "BATCHED_MUTATIONS"sv };
+    // Nodes listen on the shard-aware storage ports.
+    gms::feature shard_aware_storage_port { *this, "SHARD_AWARE_STORAGE_PORT"sv };
+    // Nodes understand the TABLET_STREAM_FILES and STREAM_BLOB verbs, used
+    // to stream the sstables of a migrated tablet as files.
+    gms::feature file_stream { *this, "FILE_STREAM"sv };
+    // Nodes understand the incremental repair parameters of the
+    // REPAIR_ROW_LEVEL_START and REPAIR_ROW_LEVEL_STOP verbs, and keep
+    // repaired and unrepaired sstables apart in compaction.
+    gms::feature incremental_repair { *this, "INCREMENTAL_REPAIR"sv };
     gms::feature large_collection_detection { *this, "LARGE_COLLECTION_DETECTION"sv };
     gms::feature range_tombstone_and_dead_rows_detection { *this, "RANGE_TOMBSTONE_AND_DEAD_ROWS_DETECTION"sv };
     gms::feature truncate_as_topology_operation { *this, "TRUNCATE_AS_TOPOLOGY_OPERATION"sv };
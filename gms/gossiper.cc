@@ -379,7 +379,7 @@ future<> gossiper::do_send_ack2_msg(msg_addr from, utils::chunked_vector<gossip_
             : g_digest.get_max_version();
         auto local_ep_state_ptr = get_state_for_version_bigger_than(addr, version);
         if (local_ep_state_ptr) {
-            delta_ep_state_map.emplace(addr, *local_ep_state_ptr);
+            delta_ep_state_map.emplace(addr, std::move(*local_ep_state_ptr));
         }
     }
     gms::gossip_digest_ack2 ack2_msg(std::move(delta_ep_state_map));
@@ -583,6 +583,7 @@ future<> gossiper::do_apply_state_locally(gms::inet_address node, endpoint_state
     // If there is a generation tie, attempt to break it by heartbeat version.
     auto permit = co_await lock_endpoint(node, null_permit_id);
     auto es = get_endpoint_state_ptr(node);
+    bool found_by_address = bool(es);
     if (!es && _topo_sm) {
         // Even if there is no endpoint for the given IP the message can still belong to existing endpoint that
         // was restarted with different IP, so lets try to locate the endpoint by host id as well. Do it in raft
@@ -595,7 +596,7 @@ future<> gossiper::do_apply_state_locally(gms::inet_address node, endpoint_state
         }
     }
     if (es) {
-        endpoint_state local_state = *es;
+        const endpoint_state& local_state = *es;
         auto local_generation = local_state.get_heart_beat_state().get_generation();
         auto remote_generation = remote_state.get_heart_beat_state().get_generation();
         logger.trace("{} local generation {}, remote generation {}", node, local_generation, remote_generation);
@@ -612,8 +613,20 @@ future<> gossiper::do_apply_state_locally(gms::inet_address node, endpoint_state
             auto local_max_version = get_max_endpoint_state_version(local_state);
             auto remote_max_version = get_max_endpoint_state_version(remote_state);
             if (remote_max_version > local_max_version) {
-                // apply states, but do not notify since there is no major change
-                co_await apply_new_states(node, std::move(local_state), remote_state, permit.id(), shadow_round);
+                if (!shadow_round && found_by_address && !has_newer_application_states(local_state, remote_state)) {
+                    // Only the heart beat advanced, which is the case for most of the
+                    // endpoints in every gossip round. There is nothing to notify
+                    // about, and the heart beat state is valid only on shard 0,
+                    // so update it in place instead of copying the whole state
+                    // and replicating it to all shards.
+                    logger.trace("Updating heartbeat state version to {} from {} for {}",
+                            remote_state.get_heart_beat_state().get_heart_beat_version(),
+                            local_state.get_heart_beat_state().get_heart_beat_version(), node);
+                    update_heart_beat_state(es, remote_state.get_heart_beat_state());
+                } else {
+                    // apply states, but do not notify since there is no major change
+                    co_await apply_new_states(node, local_state, remote_state, permit.id(), shadow_round);
+                }
             } else {
                 logger.debug("Ignoring remote version {} <= {} for {}", remote_max_version, local_max_version, node);
             }
@@ -1510,6 +1523,20 @@ void gossiper::update_timestamp(const endpoint_state_ptr& eps) noexcept {
     const_cast<endpoint_state&>(*eps).update_timestamp();
 }
 
+void gossiper::update_heart_beat_state(const endpoint_state_ptr& eps, heart_beat_state hbs) noexcept {
+    const_cast<endpoint_state&>(*eps).set_heart_beat_state_and_update_timestamp(hbs);
+}
+
+bool gossiper::has_newer_application_states(const endpoint_state& local_state, const endpoint_state& remote_state) noexcept {
+    for (const auto& [key, remote_value] : remote_state.get_application_state_map()) {
+        const versioned_value* local_value = local_state.get_application_state_ptr(key);
+        if (!local_value || remote_value.version() > local_value->version()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 const endpoint_state& gossiper::get_endpoint_state(inet_address ep) const {
     auto it = _endpoint_state_map.find(ep);
     if (it == _endpoint_state_map.end()) {
@@ -1967,7 +1994,7 @@ void gossiper::send_all(gossip_digest& g_digest,
     logger.trace("send_all(): ep={}, version > {}", ep, max_remote_version);
     auto local_ep_state_ptr = get_state_for_version_bigger_than(ep, max_remote_version);
     if (local_ep_state_ptr) {
-        delta_ep_state_map[ep] = *local_ep_state_ptr;
+        delta_ep_state_map[ep] = std::move(*local_ep_state_ptr);
     }
 }
 
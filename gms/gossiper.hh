@@ -427,8 +427,8 @@ class gossiper : public seastar::async_sharded_service<gossiper>, public seastar
 
     // Gets a shared pointer to the endpoint_state, if exists.
     // Otherwise, returns a null ptr.
-    // The endpoint_state is immutable (except for its update_timestamp), guaranteed not to change while
-    // the endpoint_state_ptr is held.
+    // The endpoint_state is immutable (except for its update_timestamp and heart_beat_state,
+    // which are valid only on shard 0), guaranteed not to change while the endpoint_state_ptr is held.
     endpoint_state_ptr get_endpoint_state_ptr(inet_address ep) const noexcept;
     endpoint_state_ptr get_endpoint_state_ptr(locator::host_id ep) const noexcept;
 
@@ -488,8 +488,14 @@ class gossiper : public seastar::async_sharded_service<gossiper>, public seastar
     endpoint_state& my_endpoint_state();
 
     // Use with care, as the endpoint_state_ptr in the endpoint_state_map is considered
-    // immutable, with one exception - the update_timestamp.
+    // immutable, with two exceptions - the update_timestamp and the heart_beat_state.
+    // Both are valid only on shard 0, so they are not replicated to other shards.
     void update_timestamp(const endpoint_state_ptr& eps) noexcept;
+    // Must be called on shard 0, under lock_endpoint.
+    void update_heart_beat_state(const endpoint_state_ptr& eps, heart_beat_state hbs) noexcept;
+    // Returns true if remote_state has an application state which is missing
+    // in local_state, or has a greater version there.
+    static bool has_newer_application_states(const endpoint_state& local_state, const endpoint_state& remote_state) noexcept;
     const endpoint_state& get_endpoint_state(inet_address ep) const;
 
     void update_timestamp_for_nodes(const std::map<inet_address, endpoint_state>& map);
@@ -462,6 +462,7 @@ class RpcVerb(ASTBase):
             static future<> unregister_my_verb(netw::messaging_service* ms);
             static future<> send_my_verb(netw::messaging_service* ms, netw::msg_addr id, args...);
             static future<> send_my_verb(netw::messaging_service* ms, locator::host_id id, args...);
+            static future<> send_my_verb(netw::messaging_service* ms, netw::host_shard id, args...);
 
     Each method accepts a pointer to an instance of messaging_service
     object, which contains the underlying seastar RPC protocol
@@ -1616,6 +1617,7 @@ def generate_rpc_verbs_declarations(hout, module_name):
 static future<> unregister_{name}(netw::messaging_service* ms);
 static {verb.send_function_return_type()} send_{name}({verb.send_function_signature_params_list(include_placeholder_names=False, dst_type="netw::msg_addr")});
 static {verb.send_function_return_type()} send_{name}({verb.send_function_signature_params_list(include_placeholder_names=False, dst_type="locator::host_id")});
+static {verb.send_function_return_type()} send_{name}({verb.send_function_signature_params_list(include_placeholder_names=False, dst_type="netw::host_shard")});
 '''))
 
     fprintln(hout, reindent(4, 'static future<> unregister(netw::messaging_service* ms);'))
@@ -1641,6 +1643,10 @@ future<> {module_name}_rpc_verbs::unregister_{name}(netw::messaging_service* ms)
 
 {verb.send_function_return_type()} {module_name}_rpc_verbs::send_{name}({verb.send_function_signature_params_list(include_placeholder_names=True, dst_type="locator::host_id")}) {{
     {verb.send_function_invocation()}
+}}
+
+{verb.send_function_return_type()} {module_name}_rpc_verbs::send_{name}({verb.send_function_signature_params_list(include_placeholder_names=True, dst_type="netw::host_shard")}) {{
+    {verb.send_function_invocation()}
 }}''')
 
     fprintln(cout, f'''
@@ -21,9 +21,14 @@ class function_name {
 }
 namespace query {
 struct mapreduce_request {
+    struct constant_argument {
+        sstring type_name;
+        bytes_opt value;
+    };
     struct aggregation_info {
         db::functions::function_name name;
         std::vector<sstring> column_names;
+        std::vector<query::mapreduce_request::constant_argument> constant_arguments [[version 2025.1]];
     };
     enum class reduction_type : uint8_t {
         count,
@@ -39,10 +44,14 @@ struct mapreduce_request {
     lowres_system_clock::time_point timeout;
 
     std::optional<std::vector<query::mapreduce_request::aggregation_info>> aggregation_infos [[version 5.1]];
+    std::optional<std::vector<sstring>> group_by_column_names [[version 2025.1]];
+    std::optional<uint64_t> max_groups [[version 2025.1]];
 };
 
 struct mapreduce_result {
     std::vector<bytes_opt> query_results;
+    std::optional<std::vector<std::vector<bytes_opt>>> grouped_query_results [[version 2025.1]];
+    bool group_limit_exceeded [[version 2025.1]];
 };
 
 verb mapreduce_request(query::mapreduce_request req [[ref]], std::optional<tracing::trace_info> trace_info [[ref]]) -> query::mapreduce_result;
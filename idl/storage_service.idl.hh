@@ -22,8 +22,16 @@ struct table_load_stats final {
     int64_t split_ready_seq_number;
 };
 
+struct tablet_load_stats final {
+    uint64_t reads;
+    uint64_t writes;
+    uint64_t read_bytes;
+    uint64_t write_bytes;
+};
+
 struct load_stats final {
     std::unordered_map<::table_id, locator::table_load_stats> tables;
+    std::unordered_map<locator::global_tablet_id, locator::tablet_load_stats> tablets [[version 2025.1]];
 };
 
 }
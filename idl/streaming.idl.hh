@@ -11,6 +11,7 @@
 #include "idl/uuid.idl.hh"
 
 #include "streaming/stream_fwd.hh"
+#include "streaming/stream_blob.hh"
 
 namespace service {
 
@@ -68,8 +69,54 @@ enum class stream_mutation_fragments_cmd : uint8_t {
     end_of_stream,
 };
 
+enum class stream_blob_cmd : uint8_t {
+    ok,
+    error,
+    component,
+    data,
+    end_of_component,
+    end_of_stream,
+};
+
+struct stream_blob_cmd_data {
+    streaming::stream_blob_cmd cmd;
+    sstring component;
+    temporary_buffer<char> data;
+    uint32_t checksum;
+};
+
+struct stream_blob_meta {
+    streaming::plan_id ops_id;
+    table_id table;
+    sstring version;
+    sstring format;
+    std::vector<sstring> components;
+    uint32_t dst_shard;
+    service::session_id session;
+};
+
+struct tablet_stream_files_request {
+    streaming::plan_id ops_id;
+    table_id table;
+    dht::token_range range;
+    uint32_t src_shard;
+    uint32_t dst_shard;
+    service::session_id session;
+};
+
+enum class tablet_stream_files_status : uint8_t {
+    ok,
+    unsupported,
+};
+
+struct tablet_stream_files_response {
+    streaming::tablet_stream_files_status status;
+    uint64_t stream_bytes;
+};
+
 verb [[with_client_info]] prepare_message (streaming::prepare_message msg, streaming::plan_id plan_id, sstring description, streaming::stream_reason reason [[version 3.1.0]], service::session_id session [[version 6.0.0]]) -> streaming::prepare_message;
 verb [[with_client_info]] prepare_done_message (streaming::plan_id plan_id, unsigned dst_cpu_id);
 verb [[with_client_info]] stream_mutation_done (streaming::plan_id plan_id, dht::token_range_vector ranges, table_id cf_id, unsigned dst_cpu_id);
 verb [[with_client_info]] complete_message (streaming::plan_id plan_id, unsigned dst_cpu_id, bool failed [[version 2.1.0]]);
+verb [[with_client_info, cancellable]] tablet_stream_files (streaming::tablet_stream_files_request req) -> streaming::tablet_stream_files_response;
 }
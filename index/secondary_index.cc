@@ -155,4 +155,41 @@ sstring target_parser::serialize_targets(const std::vector<::shared_ptr<cql3::st
     return rjson::print(json_map);
 }
 
+sstring target_parser::serialize_included_columns(const std::vector<::shared_ptr<cql3::column_identifier>>& columns) {
+    rjson::value json_array = rjson::empty_array();
+    for (const auto& column : columns) {
+        rjson::push_back(json_array, rjson::from_string(column->text()));
+    }
+    return rjson::print(json_array);
+}
+
+std::vector<sstring> target_parser::get_included_column_names(const index_metadata& im) {
+    auto it = im.options().find(cql3::statements::index_target::included_columns_option_name);
+    if (it == im.options().end()) {
+        return {};
+    }
+    std::optional<rjson::value> json_value = rjson::try_parse(it->second);
+    if (!json_value || !json_value->IsArray()) {
+        throw exceptions::configuration_exception(format("Unable to parse included columns for index {} ({})", im.name(), it->second));
+    }
+    std::vector<sstring> names;
+    names.reserve(json_value->Size());
+    for (const rjson::value& v : json_value->GetArray()) {
+        names.emplace_back(rjson::to_string_view(v));
+    }
+    return names;
+}
+
+std::vector<const column_definition*> target_parser::parse_included_columns(schema_ptr schema, const index_metadata& im) {
+    std::vector<const column_definition*> columns;
+    for (const auto& name : get_included_column_names(im)) {
+        const column_definition* cdef = schema->get_column_definition(utf8_type->decompose(name));
+        if (!cdef) {
+            throw exceptions::configuration_exception(format("Included column {} of index {} not found", name, im.name()));
+        }
+        columns.push_back(cdef);
+    }
+    return columns;
+}
+
 }
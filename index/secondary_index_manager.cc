@@ -294,6 +294,12 @@ view_ptr secondary_index_manager::create_view_for_index(const index_metadata& im
         }
     }
 
+    // Columns listed in INCLUDE (...) are stored in the view as regular
+    // columns, so queries selecting only them can be answered from the view.
+    for (const column_definition* col : target_parser::parse_included_columns(schema, im)) {
+        builder.with_column(col->name(), col->type);
+    }
+
     if (index_target->is_primary_key()) {
         for (auto& def : schema->regular_columns()) {
             db::view::create_virtual_column(builder, def.name(), def.type);
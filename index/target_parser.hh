@@ -30,6 +30,14 @@ struct target_parser {
     static sstring get_target_column_name_from_string(const sstring& targets);
 
     static sstring serialize_targets(const std::vector<::shared_ptr<cql3::statements::index_target>>& targets);
+
+    // Included columns are stored as a JSON array of column names, under the
+    // index_target::included_columns_option_name option.
+    static sstring serialize_included_columns(const std::vector<::shared_ptr<cql3::column_identifier>>& columns);
+
+    static std::vector<sstring> get_included_column_names(const index_metadata& im);
+
+    static std::vector<const column_definition*> parse_included_columns(schema_ptr schema, const index_metadata& im);
 };
 
 }
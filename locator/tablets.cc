@@ -660,10 +660,21 @@ table_load_stats& table_load_stats::operator+=(const table_load_stats& s) noexce
     return *this;
 }
 
+tablet_load_stats& tablet_load_stats::operator+=(const tablet_load_stats& s) noexcept {
+    reads += s.reads;
+    writes += s.writes;
+    read_bytes += s.read_bytes;
+    write_bytes += s.write_bytes;
+    return *this;
+}
+
 load_stats& load_stats::operator+=(const load_stats& s) {
     for (auto& [id, stats] : s.tables) {
         tables[id] += stats;
     }
+    for (auto& [id, stats] : s.tablets) {
+        tablets[id] += stats;
+    }
     return *this;
 }
 
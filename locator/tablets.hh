@@ -350,8 +350,33 @@ struct table_load_stats {
     }
 };
 
+// Rates of the requests served by a tablet replica, per second.
+struct tablet_load_stats {
+    uint64_t reads = 0;
+    uint64_t writes = 0;
+    uint64_t read_bytes = 0;
+    uint64_t write_bytes = 0;
+
+    // The number of bytes transferred which costs about as much as serving a single request.
+    static constexpr uint64_t bytes_per_request = 4096;
+
+    // The load put on the shard owning the replica, in requests per second,
+    // which the load balancer tries to equalize across shards.
+    double load() const noexcept {
+        return double(reads + writes) + double(read_bytes + write_bytes) / bytes_per_request;
+    }
+
+    tablet_load_stats& operator+=(const tablet_load_stats& s) noexcept;
+    friend tablet_load_stats operator+(tablet_load_stats a, const tablet_load_stats& b) {
+        return a += b;
+    }
+};
+
 struct load_stats {
     std::unordered_map<table_id, table_load_stats> tables;
+    // Reported by each replica for its tablets. The coordinator averages them
+    // over the replicas of the tablet.
+    std::unordered_map<global_tablet_id, tablet_load_stats> tablets;
 
     load_stats& operator+=(const load_stats& s);
     friend load_stats operator+(load_stats a, const load_stats& b) {
@@ -1513,6 +1513,8 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
             mscfg.broadcast_address = broadcast_addr;
             mscfg.port = cfg->storage_port();
             mscfg.ssl_port = cfg->ssl_storage_port();
+            mscfg.shard_aware_port = cfg->shard_aware_storage_port();
+            mscfg.shard_aware_ssl_port = cfg->shard_aware_ssl_storage_port();
             mscfg.listen_on_broadcast_address = cfg->listen_on_broadcast_address();
             mscfg.rpc_memory_limit = std::max<size_t>(0.08 * memory::stats().total_memory(), mscfg.rpc_memory_limit);
             if (snitch.local()->prefer_local()) {
@@ -41,6 +41,7 @@
 #include "repair/repair.hh"
 #include "streaming/stream_reason.hh"
 #include "streaming/stream_mutation_fragments_cmd.hh"
+#include "streaming/stream_blob.hh"
 #include "cache_temperature.hh"
 #include "raft/raft.hh"
 #include "service/raft/group0_fwd.hh"
@@ -127,6 +128,7 @@
 #include "idl/storage_service.dist.impl.hh"
 #include "idl/join_node.dist.impl.hh"
 #include "gms/feature_service.hh"
+#include "utils/hash.hh"
 
 namespace netw {
 
@@ -217,6 +219,10 @@ size_t msg_addr::hash::operator()(const msg_addr& id) const noexcept {
     return std::hash<bytes_view>()(id.addr.bytes());
 }
 
+size_t host_shard::hash::operator()(const host_shard& id) const noexcept {
+    return utils::hash_combine(std::hash<locator::host_id>()(id.host), std::hash<uint32_t>()(id.shard));
+}
+
 messaging_service::shard_info::shard_info(shared_ptr<rpc_protocol_client_wrapper>&& client, bool topo_ignored, inet_address ip)
     : rpc_client(std::move(client))
     , topology_ignored(topo_ignored), endpoint(ip)
@@ -350,6 +356,54 @@ sstring messaging_service::client_metrics_domain(unsigned idx, inet_address addr
     return ret;
 }
 
+// The servers on the shard-aware ports accept connections on the shard given
+// by the port they come from, modulo the number of shards (see
+// load_balancing_algorithm::port in do_start_listen()), so a connection to a
+// given shard is made from a port picked accordingly, as the shard-aware CQL
+// drivers do. Every shard picks ports from its own part of the range, so that
+// shards don't try to use the same ones.
+std::optional<uint16_t> messaging_service::shard_aware_port(unsigned local_shard, unsigned local_shard_count,
+        unsigned dst_shard, unsigned dst_shard_count, unsigned seq) {
+    unsigned range = (shard_aware_max_port - shard_aware_min_port + 1) / local_shard_count;
+    if (dst_shard >= dst_shard_count || range < dst_shard_count) {
+        return std::nullopt;
+    }
+    unsigned begin = shard_aware_min_port + range * local_shard;
+    // The first port of the range which leads to dst_shard, and the number
+    // of such ports in the range.
+    unsigned first = begin + (dst_shard + dst_shard_count - begin % dst_shard_count) % dst_shard_count;
+    unsigned ports = (begin + range - first + dst_shard_count - 1) / dst_shard_count;
+    return first + (seq % ports) * dst_shard_count;
+}
+
+// Returns std::nullopt if the number of shards of the node isn't known.
+std::optional<uint16_t> messaging_service::shard_aware_local_port(locator::host_id id, uint32_t dst_shard) {
+    if (!_token_metadata) {
+        return std::nullopt;
+    }
+    auto* node = _token_metadata->get()->get_topology().find_node(id);
+    unsigned shard_count = node ? node->get_shard_count() : 0;
+    // A port may be in use, e.g. by a connection which was closed recently,
+    // or by another socket. Connecting from it fails and the client is
+    // dropped, so the next client uses the next port. No message is sent over
+    // the connection before it is connected, see get_rpc_client().
+    return shard_aware_port(this_shard_id(), smp::count, dst_shard, shard_count, _next_shard_aware_port++);
+}
+
+bool messaging_service::is_shard_client_established(unsigned idx, host_shard id) const {
+    const auto& clients = _clients_with_host_shard[idx];
+    auto it = clients.find(id);
+    return it != clients.end() && it->second.established;
+}
+
+void messaging_service::mark_shard_client_established(unsigned idx, host_shard id, const rpc_protocol_client_wrapper* client) {
+    auto& clients = _clients_with_host_shard[idx];
+    // The client may have been replaced meanwhile.
+    if (auto it = clients.find(id); it != clients.end() && it->second.rpc_client.get() == client) {
+        it->second.established = true;
+    }
+}
+
 future<> messaging_service::ban_host(locator::host_id id) {
     return container().invoke_on_all([id] (messaging_service& ms) {
         if (ms._banned_hosts.contains(id) || ms.is_shutting_down()) {
@@ -390,7 +444,7 @@ void messaging_service::do_start_listen() {
         });
     };
     if (!_server[0] && _cfg.encrypt != encrypt_what::all && _cfg.port) {
-        auto listen = [&] (const gms::inet_address& a, rpc::streaming_domain_type sdomain) {
+        auto listen = [&] (const gms::inet_address& a, uint16_t port, rpc::streaming_domain_type sdomain) {
             so.streaming_domain = sdomain;
             so.filter_connection = {};
             switch (_cfg.encrypt) {
@@ -411,22 +465,28 @@ void messaging_service::do_start_listen() {
                     };
                     break;
             }
-            auto addr = socket_address{a, _cfg.port};
+            auto addr = socket_address{a, port};
             return std::unique_ptr<rpc_protocol_server_wrapper>(new rpc_protocol_server_wrapper(_rpc->protocol(),
                     so, addr, limits));
         };
-        _server[0] = listen(_cfg.ip, rpc::streaming_domain_type(0x55AA));
+        _server[0] = listen(_cfg.ip, _cfg.port, rpc::streaming_domain_type(0x55AA));
         if (listen_to_bc) {
-            _server[1] = listen(broadcast_address, rpc::streaming_domain_type(0x66BB));
+            _server[1] = listen(broadcast_address, _cfg.port, rpc::streaming_domain_type(0x66BB));
+        }
+        if (_cfg.shard_aware_port) {
+            _server[2] = listen(_cfg.ip, _cfg.shard_aware_port, rpc::streaming_domain_type(0x99EE));
+            if (listen_to_bc) {
+                _server[3] = listen(broadcast_address, _cfg.shard_aware_port, rpc::streaming_domain_type(0xAAFF));
+            }
         }
     }
 
     if (!_server_tls[0] && _cfg.ssl_port) {
-        auto listen = [&] (const gms::inet_address& a, rpc::streaming_domain_type sdomain) {
+        auto listen = [&] (const gms::inet_address& a, uint16_t port, rpc::streaming_domain_type sdomain) {
             so.filter_connection = {};
             so.streaming_domain = sdomain;
             return std::unique_ptr<rpc_protocol_server_wrapper>(
-                    [this, &so, &a, limits] () -> std::unique_ptr<rpc_protocol_server_wrapper>{
+                    [this, &so, &a, port, limits] () -> std::unique_ptr<rpc_protocol_server_wrapper>{
                 // TODO: the condition to skip this if cfg.port == 0 is mainly to appease dtest.
                 // remove once we've adjusted those tests.
                 if (_cfg.encrypt == encrypt_what::none && (!_credentials || _cfg.port == 0)) {
@@ -438,14 +498,20 @@ void messaging_service::do_start_listen() {
                 listen_options lo;
                 lo.reuse_address = true;
                 lo.lba =  server_socket::load_balancing_algorithm::port;
-                auto addr = socket_address{a, _cfg.ssl_port};
+                auto addr = socket_address{a, port};
                 return std::make_unique<rpc_protocol_server_wrapper>(_rpc->protocol(),
                         so, seastar::tls::listen(_credentials, addr, lo), limits);
             }());
         };
-        _server_tls[0] = listen(_cfg.ip, rpc::streaming_domain_type(0x77CC));
+        _server_tls[0] = listen(_cfg.ip, _cfg.ssl_port, rpc::streaming_domain_type(0x77CC));
         if (listen_to_bc) {
-            _server_tls[1] = listen(broadcast_address, rpc::streaming_domain_type(0x88DD));
+            _server_tls[1] = listen(broadcast_address, _cfg.ssl_port, rpc::streaming_domain_type(0x88DD));
+        }
+        if (_cfg.shard_aware_ssl_port) {
+            _server_tls[2] = listen(_cfg.ip, _cfg.shard_aware_ssl_port, rpc::streaming_domain_type(0xBB11));
+            if (listen_to_bc) {
+                _server_tls[3] = listen(broadcast_address, _cfg.shard_aware_ssl_port, rpc::streaming_domain_type(0xCC22));
+            }
         }
     }
     // Do this on just cpu 0, to avoid duplicate logs.
@@ -462,6 +528,18 @@ void messaging_service::do_start_listen() {
         if (_server[1]) {
             mlogger.info("Starting Messaging Service on broadcast address {} port {}", broadcast_address, _cfg.port);
         }
+        if (_server_tls[2]) {
+            mlogger.info("Starting Encrypted Messaging Service on SSL address {} shard-aware port {}", _cfg.ip, _cfg.shard_aware_ssl_port);
+        }
+        if (_server_tls[3]) {
+            mlogger.info("Starting Encrypted Messaging Service on SSL broadcast address {} shard-aware port {}", broadcast_address, _cfg.shard_aware_ssl_port);
+        }
+        if (_server[2]) {
+            mlogger.info("Starting Messaging Service on address {} shard-aware port {}", _cfg.ip, _cfg.shard_aware_port);
+        }
+        if (_server[3]) {
+            mlogger.info("Starting Messaging Service on broadcast address {} shard-aware port {}", broadcast_address, _cfg.shard_aware_port);
+        }
     }
 }
 
@@ -472,6 +550,7 @@ messaging_service::messaging_service(config cfg, scheduling_config scfg, std::sh
     , _credentials_builder(credentials ? std::make_unique<seastar::tls::credentials_builder>(*credentials) : nullptr)
     , _clients(PER_SHARD_CONNECTION_COUNT + scfg.statement_tenants.size() * PER_TENANT_CONNECTION_COUNT)
     , _clients_with_host_id(PER_SHARD_CONNECTION_COUNT + scfg.statement_tenants.size() * PER_TENANT_CONNECTION_COUNT)
+    , _clients_with_host_shard(PER_SHARD_CONNECTION_COUNT + scfg.statement_tenants.size() * PER_TENANT_CONNECTION_COUNT)
     , _scheduling_config(scfg)
     , _scheduling_info_for_connection_index(initial_scheduling_info())
     , _feature_service(feature_service)
@@ -526,7 +605,7 @@ msg_addr messaging_service::get_source(const rpc::client_info& cinfo) {
 
 messaging_service::~messaging_service() = default;
 
-static future<> do_with_servers(std::string_view what, std::array<std::unique_ptr<messaging_service::rpc_protocol_server_wrapper>, 2>& servers, auto method) {
+static future<> do_with_servers(std::string_view what, std::array<std::unique_ptr<messaging_service::rpc_protocol_server_wrapper>, 4>& servers, auto method) {
     mlogger.info("{} server", what);
     co_await coroutine::parallel_for_each(
             servers | std::views::filter([] (auto& ptr) { return bool(ptr); }) | std::views::transform([] (auto& ptr) -> messaging_service::rpc_protocol_server_wrapper& { return *ptr; }),
@@ -568,7 +647,8 @@ future<> messaging_service::stop_client() {
     };
     co_await coroutine::all(
         [&] { return stop_clients(_clients); },
-        [&] { return stop_clients(_clients_with_host_id); }
+        [&] { return stop_clients(_clients_with_host_id); },
+        [&] { return stop_clients(_clients_with_host_shard); }
     );
 }
 
@@ -684,7 +764,9 @@ static constexpr unsigned do_get_rpc_client_idx(messaging_verb verb) {
         return 1;
     case messaging_verb::CLIENT_ID:
     case messaging_verb::MUTATION:
+    case messaging_verb::MUTATION_BATCH:
     case messaging_verb::READ_DATA:
+    case messaging_verb::READ_DATA_MULTI:
     case messaging_verb::READ_MUTATION_DATA:
     case messaging_verb::READ_DIGEST:
     case messaging_verb::DEFINITIONS_UPDATE:
@@ -999,7 +1081,7 @@ gms::inet_address messaging_service::get_public_endpoint_for(const gms::inet_add
     return i != _preferred_to_endpoint.end() ? i->second : ip;
 }
 
-shared_ptr<messaging_service::rpc_protocol_client_wrapper> messaging_service::get_rpc_client(messaging_verb verb, msg_addr id, std::optional<locator::host_id> host_id) {
+shared_ptr<messaging_service::rpc_protocol_client_wrapper> messaging_service::get_rpc_client(messaging_verb verb, msg_addr id, std::optional<locator::host_id> host_id, std::optional<uint32_t> dst_shard) {
     SCYLLA_ASSERT(!_shutting_down);
     if (_cfg.maintenance_mode) {
         on_internal_error(mlogger, "This node is in maintenance mode, it shouldn't contact other nodes");
@@ -1021,11 +1103,30 @@ shared_ptr<messaging_service::rpc_protocol_client_wrapper> messaging_service::ge
         return nullptr;
     };
 
+    // The connection to a shard is made if the local port which leads to it
+    // can be picked. The message is sent over the connection to the node until
+    // the connection to the shard is connected, so that a connection which
+    // fails to connect, e.g. because the port is taken, loses no messages.
+    std::optional<uint16_t> local_port;
+    if (host_id && dst_shard) {
+        auto shard_id = host_shard{*host_id, *dst_shard};
+        if (auto client = find_existing(_clients_with_host_shard, shard_id)) {
+            if (is_shard_client_established(idx, shard_id)) {
+                return client;
+            }
+        } else if (_cfg.shard_aware_port && (_cfg.encrypt == encrypt_what::none || _cfg.shard_aware_ssl_port)) {
+            local_port = shard_aware_local_port(*host_id, *dst_shard);
+        }
+        if (!local_port) {
+            return get_rpc_client(verb, id, host_id);
+        }
+    }
+
     shared_ptr<rpc_protocol_client_wrapper> client;
-    if (host_id) {
-        client = find_existing(_clients_with_host_id, *host_id);
-    } else {
+    if (!host_id) {
         client = find_existing(_clients, id);
+    } else if (!local_port) {
+        client = find_existing(_clients_with_host_id, *host_id);
     }
 
     if (client) {
@@ -1035,7 +1136,7 @@ shared_ptr<messaging_service::rpc_protocol_client_wrapper> messaging_service::ge
     auto my_host_id = _cfg.id;
     auto broadcast_address = _cfg.broadcast_address;
     bool listen_to_bc = _cfg.listen_on_broadcast_address && _cfg.ip != broadcast_address;
-    auto laddr = socket_address(listen_to_bc ? broadcast_address : _cfg.ip, 0);
+    auto laddr = socket_address(listen_to_bc ? broadcast_address : _cfg.ip, local_port.value_or(0));
 
     std::optional<bool> topology_status;
     auto has_topology = [&] {
@@ -1103,7 +1204,9 @@ shared_ptr<messaging_service::rpc_protocol_client_wrapper> messaging_service::ge
     }();
 
     auto addr = get_preferred_ip(id.addr);
-    auto remote_addr = socket_address(addr, must_encrypt ? _cfg.ssl_port : _cfg.port);
+    auto remote_addr = socket_address(addr, local_port
+            ? (must_encrypt ? _cfg.shard_aware_ssl_port : _cfg.shard_aware_port)
+            : (must_encrypt ? _cfg.ssl_port : _cfg.port));
 
     rpc::client_options opts;
     // send keepalive messages each minute if connection is idle, drop connection after 10 failures
@@ -1131,7 +1234,12 @@ shared_ptr<messaging_service::rpc_protocol_client_wrapper> messaging_service::ge
     // are independent of topology, so there's no point in dropping it later after we learn
     // the topology (so we always set `topology_ignored` to `false` in that case).
     bool topology_ignored = idx != TOPOLOGY_INDEPENDENT_IDX && topology_status.has_value() && *topology_status == false;
-    if (host_id) {
+    if (local_port) {
+        auto res = _clients_with_host_shard[idx].emplace(host_shard{*host_id, *dst_shard}, shard_info(std::move(client), topology_ignored, id.addr));
+        SCYLLA_ASSERT(res.second);
+        auto it = res.first;
+        client = it->second.rpc_client;
+    } else if (host_id) {
         auto res = _clients_with_host_id[idx].emplace(*host_id, shard_info(std::move(client), topology_ignored, id.addr));
         SCYLLA_ASSERT(res.second);
         auto it = res.first;
@@ -1144,19 +1252,29 @@ shared_ptr<messaging_service::rpc_protocol_client_wrapper> messaging_service::ge
     }
     uint32_t src_cpu_id = this_shard_id();
     // No reply is received, nothing to wait for.
-    (void)_rpc->make_client<
+    auto f = _rpc->make_client<
             rpc::no_wait_type(gms::inet_address, uint32_t, uint64_t, utils::UUID, std::optional<utils::UUID>)>(messaging_verb::CLIENT_ID)(
                 *client, broadcast_address, src_cpu_id,
-                query::result_memory_limiter::maximum_result_size, my_host_id.uuid(), host_id ? std::optional{host_id->uuid()} : std::nullopt)
-            .handle_exception([ms = shared_from_this(), remote_addr, verb] (std::exception_ptr ep) {
+                query::result_memory_limiter::maximum_result_size, my_host_id.uuid(), host_id ? std::optional{host_id->uuid()} : std::nullopt);
+    if (local_port) {
+        // The client id is sent once the connection is connected.
+        f = f.then([ms = shared_from_this(), idx, id = host_shard{*host_id, *dst_shard}, client = client.get()] {
+            ms->mark_shard_client_established(idx, id, client);
+        });
+    }
+    (void)f.handle_exception([ms = shared_from_this(), remote_addr, verb] (std::exception_ptr ep) {
         mlogger.debug("Failed to send client id to {} for verb {}: {}", remote_addr, std::underlying_type_t<messaging_verb>(verb), ep);
     });
+    if (local_port) {
+        return get_rpc_client(verb, id, host_id);
+    }
     return client;
 }
 
 template <typename Fn, typename Map>
 requires (std::is_invocable_r_v<bool, Fn, const messaging_service::shard_info&> &&
-        (std::is_same_v<typename Map::key_type, msg_addr> || std::is_same_v<typename Map::key_type, locator::host_id>))
+        (std::is_same_v<typename Map::key_type, msg_addr> || std::is_same_v<typename Map::key_type, locator::host_id>
+         || std::is_same_v<typename Map::key_type, host_shard>))
 void messaging_service::find_and_remove_client(Map& clients, typename Map::key_type id, Fn&& filter) {
     if (_shutting_down) {
         // if messaging service is in a processed of been stopped no need to
@@ -1173,6 +1291,9 @@ void messaging_service::find_and_remove_client(Map& clients, typename Map::key_t
         std::optional<locator::host_id> hid;
         if constexpr (std::is_same_v<typename Map::key_type, msg_addr>) {
             addr = id.addr;
+        } else if constexpr (std::is_same_v<typename Map::key_type, host_shard>) {
+            addr = it->second.endpoint;
+            hid = id.host;
         } else {
             addr = it->second.endpoint;
             hid = id;
@@ -1201,20 +1322,31 @@ void messaging_service::remove_error_rpc_client(messaging_verb verb, locator::ho
     find_and_remove_client(_clients_with_host_id[get_rpc_client_idx(verb)], id, [] (const auto& s) { return s.rpc_client->error(); });
 }
 
-// Removes client to id.addr in both _client and _clients_with_host_id
+// The message may have been sent over the connection to the node, if the
+// connection to the shard couldn't be made, see get_rpc_client().
+void messaging_service::remove_error_rpc_client(messaging_verb verb, host_shard id) {
+    find_and_remove_client(_clients_with_host_shard[get_rpc_client_idx(verb)], id, [] (const auto& s) { return s.rpc_client->error(); });
+    remove_error_rpc_client(verb, id.host);
+}
+
+// Removes client to id.addr in _client, _clients_with_host_id and _clients_with_host_shard
 // FIXME: make removing from _clients_with_host_id more efficient
 void messaging_service::remove_rpc_client(msg_addr id) {
     for (auto& c : _clients) {
         find_and_remove_client(c, id, [] (const auto&) { return true; });
     }
-    for (auto& c : _clients_with_host_id) {
-        for (auto it = c.begin(); it != c.end();) {
-            auto& [hid, si] = *it++;
-            if (id.addr == si.endpoint) {
-                find_and_remove_client(c, hid, [] (const auto&) { return true; });
+    auto remove_by_endpoint = [&] (auto& clients) {
+        for (auto& c : clients) {
+            for (auto it = c.begin(); it != c.end();) {
+                auto& [key, si] = *it++;
+                if (id.addr == si.endpoint) {
+                    find_and_remove_client(c, key, [] (const auto&) { return true; });
+                }
             }
         }
-    }
+    };
+    remove_by_endpoint(_clients_with_host_id);
+    remove_by_endpoint(_clients_with_host_shard);
 }
 
 void messaging_service::remove_rpc_client_with_ignored_topology(msg_addr id, locator::host_id hid) {
@@ -1234,6 +1366,19 @@ void messaging_service::remove_rpc_client_with_ignored_topology(msg_addr id, loc
             return s.topology_ignored;
         });
     }
+    for (auto& c : _clients_with_host_shard) {
+        for (auto it = c.begin(); it != c.end();) {
+            auto key = (it++)->first;
+            if (key.host == hid) {
+                find_and_remove_client(c, key, [key] (const auto& s) {
+                    if (s.topology_ignored) {
+                        mlogger.info("Dropping connection to {} because it was created without topology information", key);
+                    }
+                    return s.topology_ignored;
+                });
+            }
+        }
+    }
 }
 
 std::unique_ptr<messaging_service::rpc_protocol_wrapper>& messaging_service::rpc() {
@@ -1269,6 +1414,40 @@ future<> messaging_service::unregister_stream_mutation_fragments() {
     return unregister_handler(messaging_verb::STREAM_MUTATION_FRAGMENTS);
 }
 
+rpc::sink<streaming::stream_blob_cmd_data> messaging_service::make_sink_for_stream_blob(rpc::source<streaming::stream_blob_cmd_data>& source) {
+    return source.make_sink<netw::serializer, streaming::stream_blob_cmd_data>();
+}
+
+future<std::tuple<rpc::sink<streaming::stream_blob_cmd_data>, rpc::source<streaming::stream_blob_cmd_data>>>
+messaging_service::make_sink_and_source_for_stream_blob(streaming::stream_blob_meta meta, locator::host_id id) {
+    using value_type = std::tuple<rpc::sink<streaming::stream_blob_cmd_data>, rpc::source<streaming::stream_blob_cmd_data>>;
+    if (is_shutting_down()) {
+        co_await coroutine::return_exception(rpc::closed_error());
+    }
+    auto rpc_client = get_rpc_client(messaging_verb::STREAM_BLOB, addr_for_host_id(id), id);
+    auto sink = co_await rpc_client->make_stream_sink<netw::serializer, streaming::stream_blob_cmd_data>();
+    auto rpc_handler = rpc()->make_client<rpc::source<streaming::stream_blob_cmd_data> (streaming::stream_blob_meta, rpc::sink<streaming::stream_blob_cmd_data>)>(messaging_verb::STREAM_BLOB);
+    auto source_fut = co_await coroutine::as_future(rpc_handler(*rpc_client, std::move(meta), sink));
+    if (source_fut.failed()) {
+        auto ex = source_fut.get_exception();
+        try {
+            co_await sink.close();
+        } catch (...) {
+            std::throw_with_nested(std::move(ex));
+        }
+        co_return coroutine::exception(std::move(ex));
+    }
+    co_return value_type(std::move(sink), std::move(source_fut.get()));
+}
+
+void messaging_service::register_stream_blob(std::function<future<rpc::sink<streaming::stream_blob_cmd_data>> (const rpc::client_info& cinfo, streaming::stream_blob_meta meta, rpc::source<streaming::stream_blob_cmd_data> source)>&& func) {
+    register_handler(this, messaging_verb::STREAM_BLOB, std::move(func));
+}
+
+future<> messaging_service::unregister_stream_blob() {
+    return unregister_handler(messaging_verb::STREAM_BLOB);
+}
+
 template<class SinkType, class SourceType>
 future<std::tuple<rpc::sink<SinkType>, rpc::source<SourceType>>>
 do_make_sink_source(messaging_verb verb, uint32_t repair_meta_id, shard_id dst_shard_id, shared_ptr<messaging_service::rpc_protocol_client_wrapper> rpc_client, std::unique_ptr<messaging_service::rpc_protocol_wrapper>& rpc) {
@@ -1362,10 +1541,12 @@ unsigned messaging_service::add_statement_tenant(sstring tenant_name, scheduling
     auto undo = defer([&] {
         _clients.resize(idx);
         _clients_with_host_id.resize(idx);
+        _clients_with_host_shard.resize(idx);
         _scheduling_info_for_connection_index.resize(scheduling_info_for_connection_index_size);
     });
     _clients.resize(_clients.size() + PER_TENANT_CONNECTION_COUNT);
     _clients_with_host_id.resize(_clients_with_host_id.size() + PER_TENANT_CONNECTION_COUNT);
+    _clients_with_host_shard.resize(_clients_with_host_shard.size() + PER_TENANT_CONNECTION_COUNT);
     // this functions as a way to delete an obsolete tenant with the same name but keeping _clients
     // indexing and _scheduling_info_for_connection_index indexing in sync.
     sstring first_cookie = sstring(_connection_types_prefix[0]) + tenant_name;
@@ -37,6 +37,8 @@
 namespace streaming {
     class prepare_message;
     enum class stream_mutation_fragments_cmd : uint8_t;
+    struct stream_blob_cmd_data;
+    struct stream_blob_meta;
 }
 
 namespace gms {
@@ -208,7 +210,9 @@ enum class messaging_verb : int32_t {
     TASKS_GET_CHILDREN = 74,
     TABLET_REPAIR = 75,
     TRUNCATE_WITH_TABLETS = 76,
-    LAST = 77,
+    READ_DATA_MULTI = 77,
+    MUTATION_BATCH = 78,
+    LAST = 79,
 };
 
 } // namespace netw
@@ -252,6 +256,7 @@ class messaging_service : public seastar::async_sharded_service<messaging_servic
     using inet_address = gms::inet_address;
     using clients_map = std::unordered_map<msg_addr, shard_info, msg_addr::hash>;
     using clients_map_host_id = std::unordered_map<locator::host_id, shard_info>;
+    using clients_map_host_shard = std::unordered_map<host_shard, shard_info, host_shard::hash>;
 
     // This should change only if serialization format changes
     static constexpr int32_t current_version = 0;
@@ -261,6 +266,8 @@ class messaging_service : public seastar::async_sharded_service<messaging_servic
         shared_ptr<rpc_protocol_client_wrapper> rpc_client;
         const bool topology_ignored;
         const inet_address endpoint;
+        // Set once a connection to a shard is connected, see get_rpc_client().
+        bool established = false;
         rpc::stats get_stats() const;
     };
 
@@ -297,6 +304,10 @@ class messaging_service : public seastar::async_sharded_service<messaging_servic
         gms::inet_address broadcast_address;    // This node's address, as told to other nodes
         uint16_t port;
         uint16_t ssl_port = 0;
+        // The ports on which connections are accepted on the shard given by
+        // the port they come from, see get_rpc_client(). 0 disables them.
+        uint16_t shard_aware_port = 0;
+        uint16_t shard_aware_ssl_port = 0;
         encrypt_what encrypt = encrypt_what::none;
         compress_what compress = compress_what::none;
         bool enable_advanced_rpc_compression = false;
@@ -342,12 +353,17 @@ class messaging_service : public seastar::async_sharded_service<messaging_servic
     // map: Node broadcast address -> Node internal IP, and the reversed mapping, for communication within the same data center
     std::unordered_map<gms::inet_address, gms::inet_address> _preferred_ip_cache, _preferred_to_endpoint;
     std::unique_ptr<rpc_protocol_wrapper> _rpc;
-    std::array<std::unique_ptr<rpc_protocol_server_wrapper>, 2> _server;
+    // The servers on the listen and the broadcast address, followed by the
+    // servers on the same addresses and the shard-aware port.
+    std::array<std::unique_ptr<rpc_protocol_server_wrapper>, 4> _server;
     ::shared_ptr<seastar::tls::server_credentials> _credentials;
     std::unique_ptr<seastar::tls::credentials_builder> _credentials_builder;
-    std::array<std::unique_ptr<rpc_protocol_server_wrapper>, 2> _server_tls;
+    std::array<std::unique_ptr<rpc_protocol_server_wrapper>, 4> _server_tls;
     std::vector<clients_map> _clients;
     std::vector<clients_map_host_id> _clients_with_host_id;
+    // Connections to given shards of nodes, see get_rpc_client().
+    std::vector<clients_map_host_shard> _clients_with_host_shard;
+    unsigned _next_shard_aware_port = 0;
     uint64_t _dropped_messages[static_cast<int32_t>(messaging_verb::LAST)] = {};
     bool _shutting_down = false;
     connection_drop_signal_t _connection_dropped;
@@ -411,6 +427,13 @@ class messaging_service : public seastar::async_sharded_service<messaging_servic
     rpc::sink<int32_t> make_sink_for_stream_mutation_fragments(rpc::source<frozen_mutation_fragment, rpc::optional<streaming::stream_mutation_fragments_cmd>>& source);
     future<std::tuple<rpc::sink<frozen_mutation_fragment, streaming::stream_mutation_fragments_cmd>, rpc::source<int32_t>>> make_sink_and_source_for_stream_mutation_fragments(table_schema_version schema_id, streaming::plan_id plan_id, table_id cf_id, uint64_t estimated_partitions, streaming::stream_reason reason, service::session_id session, locator::host_id id);
 
+    // Wrapper for STREAM_BLOB
+    // The sender sends the components of an sstable, the receiver responds with stream_blob_cmd::ok once the sstable was added, see streaming/stream_blob.hh.
+    void register_stream_blob(std::function<future<rpc::sink<streaming::stream_blob_cmd_data>> (const rpc::client_info& cinfo, streaming::stream_blob_meta meta, rpc::source<streaming::stream_blob_cmd_data> source)>&& func);
+    future<> unregister_stream_blob();
+    rpc::sink<streaming::stream_blob_cmd_data> make_sink_for_stream_blob(rpc::source<streaming::stream_blob_cmd_data>& source);
+    future<std::tuple<rpc::sink<streaming::stream_blob_cmd_data>, rpc::source<streaming::stream_blob_cmd_data>>> make_sink_and_source_for_stream_blob(streaming::stream_blob_meta meta, locator::host_id id);
+
     // Wrapper for REPAIR_GET_ROW_DIFF_WITH_RPC_STREAM
     future<std::tuple<rpc::sink<repair_hash_with_cmd>, rpc::source<repair_row_on_wire_with_cmd>>> make_sink_and_source_for_repair_get_row_diff_with_rpc_stream(uint32_t repair_meta_id, shard_id dst_cpu_id, locator::host_id id);
     rpc::sink<repair_row_on_wire_with_cmd> make_sink_for_repair_get_row_diff_with_rpc_stream(rpc::source<repair_hash_with_cmd>& source);
@@ -446,7 +469,8 @@ class messaging_service : public seastar::async_sharded_service<messaging_servic
 private:
     template <typename Fn, typename Map>
     requires (std::is_invocable_r_v<bool, Fn, const shard_info&> &&
-            (std::is_same_v<typename Map::key_type, msg_addr> || std::is_same_v<typename Map::key_type, locator::host_id>))
+            (std::is_same_v<typename Map::key_type, msg_addr> || std::is_same_v<typename Map::key_type, locator::host_id>
+             || std::is_same_v<typename Map::key_type, host_shard>))
     void find_and_remove_client(Map& clients, typename Map::key_type id, Fn&& filter);
 
     void do_start_listen();
@@ -458,12 +482,30 @@ class messaging_service : public seastar::async_sharded_service<messaging_servic
     bool is_host_banned(locator::host_id);
 
     sstring client_metrics_domain(unsigned idx, inet_address addr, std::optional<locator::host_id> id) const;
+    std::optional<uint16_t> shard_aware_local_port(locator::host_id id, uint32_t dst_shard);
+    bool is_shard_client_established(unsigned idx, host_shard id) const;
+    void mark_shard_client_established(unsigned idx, host_shard id, const rpc_protocol_client_wrapper* client);
 
 public:
+    // Local ports from which connections to given shards of nodes are made.
+    static constexpr uint16_t shard_aware_min_port = 49152;
+    static constexpr uint16_t shard_aware_max_port = 65535;
+    // The local port from which local_shard connects to shard dst_shard of a
+    // node with dst_shard_count shards. Every local shard uses its own part of
+    // the port range, and `seq` picks one of the suitable ports in it.
+    // Returns std::nullopt if there are no suitable ports.
+    static std::optional<uint16_t> shard_aware_port(unsigned local_shard, unsigned local_shard_count,
+            unsigned dst_shard, unsigned dst_shard_count, unsigned seq);
+
     // Return rpc::protocol::client for a shard which is a ip + cpuid pair.
-    shared_ptr<rpc_protocol_client_wrapper> get_rpc_client(messaging_verb verb, msg_addr id, std::optional<locator::host_id> host_id);
+    // If dst_shard is given, the client connected to that shard of host_id
+    // is returned, so that the messages are received on the shard which will
+    // handle them. Until that connection is established, or if it can't be
+    // made, the client connected to the node is returned.
+    shared_ptr<rpc_protocol_client_wrapper> get_rpc_client(messaging_verb verb, msg_addr id, std::optional<locator::host_id> host_id, std::optional<uint32_t> dst_shard = std::nullopt);
     void remove_error_rpc_client(messaging_verb verb, msg_addr id);
     void remove_error_rpc_client(messaging_verb verb, locator::host_id id);
+    void remove_error_rpc_client(messaging_verb verb, host_shard id);
     void remove_rpc_client_with_ignored_topology(msg_addr id, locator::host_id hid);
     void remove_rpc_client(msg_addr id);
     connection_drop_registration_t when_connection_drops(connection_drop_slot_t& slot) {
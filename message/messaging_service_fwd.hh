@@ -18,6 +18,7 @@ namespace gms { class inet_address; }
 namespace netw {
 
 struct msg_addr;
+struct host_shard;
 enum class messaging_verb;
 class messaging_service;
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "gms/inet_address.hh"
+#include "locator/host_id.hh"
 #include <cstdint>
 
 namespace netw {
@@ -26,6 +27,17 @@ struct msg_addr {
     msg_addr(gms::inet_address ip, uint32_t cpu) noexcept : addr(ip), cpu_id(cpu) { }
 };
 
+// A shard of a node. Messages sent to a host_shard go over a connection
+// which the node accepts on that shard, see messaging_service::get_rpc_client().
+struct host_shard {
+    locator::host_id host;
+    uint32_t shard;
+    bool operator==(const host_shard&) const = default;
+    struct hash {
+        size_t operator()(const host_shard& id) const noexcept;
+    };
+};
+
 }
 
 template <>
@@ -36,3 +48,12 @@ struct fmt::formatter<netw::msg_addr> {
         return fmt::format_to(ctx.out(), "{}:{}", addr.addr, addr.cpu_id);
     }
 };
+
+template <>
+struct fmt::formatter<netw::host_shard> {
+    constexpr auto parse(format_parse_context& ctx) { return ctx.begin(); }
+    template <typename FormatContext>
+    auto format(const netw::host_shard& id, FormatContext& ctx) const {
+        return fmt::format_to(ctx.out(), "{}:{}", id.host, id.shard);
+    }
+};
@@ -123,18 +123,23 @@ void register_handler(messaging_service *ms, messaging_verb verb, Func &&func) {
 
 // Send a message for verb
 template <typename MsgIn, typename... MsgOut>
-auto send_message(messaging_service* ms, messaging_verb verb, std::optional<locator::host_id> host_id, msg_addr id, MsgOut&&... msg) {
+auto send_message(messaging_service* ms, messaging_verb verb, std::optional<locator::host_id> host_id, std::optional<uint32_t> dst_shard, msg_addr id, MsgOut&&... msg) {
     auto rpc_handler = ms->rpc()->make_client<MsgIn(MsgOut...)>(verb);
     using futurator = futurize<std::invoke_result_t<decltype(rpc_handler), rpc_protocol::client&, MsgOut...>>;
     if (ms->is_shutting_down()) {
         return futurator::make_exception_future(rpc::closed_error());
     }
-    auto rpc_client_ptr = ms->get_rpc_client(verb, id, host_id);
+    auto rpc_client_ptr = ms->get_rpc_client(verb, id, host_id, dst_shard);
     auto& rpc_client = *rpc_client_ptr;
-    return rpc_handler(rpc_client, std::forward<MsgOut>(msg)...).handle_exception([ms = ms->shared_from_this(), id, host_id, verb, rpc_client_ptr = std::move(rpc_client_ptr)] (std::exception_ptr&& eptr) {
+    return rpc_handler(rpc_client, std::forward<MsgOut>(msg)...).handle_exception([ms = ms->shared_from_this(), id, host_id, dst_shard, verb, rpc_client_ptr = std::move(rpc_client_ptr)] (std::exception_ptr&& eptr) {
         ms->increment_dropped_messages(verb);
         if (try_catch<rpc::closed_error>(eptr)) {
-            // This is a transport error
+            // This is a transport error. The message may have been sent over
+            // the connection to the node instead of the one to the shard,
+            // see get_rpc_client().
+            if (host_id && dst_shard) {
+                ms->remove_error_rpc_client(verb, host_shard{*host_id, *dst_shard});
+            }
             if (host_id) {
                 ms->remove_error_rpc_client(verb, *host_id);
             } else {
@@ -150,29 +155,40 @@ auto send_message(messaging_service* ms, messaging_verb verb, std::optional<loca
 
 template <typename MsgIn, typename... MsgOut>
 auto send_message(messaging_service* ms, messaging_verb verb, msg_addr id, MsgOut&&... msg) {
-    return send_message<MsgIn, MsgOut...>(ms, verb, std::nullopt, id, std::forward<MsgOut>(msg)...);
+    return send_message<MsgIn, MsgOut...>(ms, verb, std::nullopt, std::nullopt, id, std::forward<MsgOut>(msg)...);
 }
 
 // Send a message for verb
 template <typename MsgIn, typename... MsgOut>
 auto send_message(messaging_service* ms, messaging_verb verb, locator::host_id hid, MsgOut&&... msg) {
-    return send_message<MsgIn, MsgOut...>(ms, verb, std::optional{hid}, ms->addr_for_host_id(hid), std::forward<MsgOut>(msg)...);
+    return send_message<MsgIn, MsgOut...>(ms, verb, std::optional{hid}, std::nullopt, ms->addr_for_host_id(hid), std::forward<MsgOut>(msg)...);
+}
+
+// Send a message for verb to the given shard of the node
+template <typename MsgIn, typename... MsgOut>
+auto send_message(messaging_service* ms, messaging_verb verb, host_shard id, MsgOut&&... msg) {
+    return send_message<MsgIn, MsgOut...>(ms, verb, std::optional{id.host}, std::optional{id.shard}, ms->addr_for_host_id(id.host), std::forward<MsgOut>(msg)...);
 }
 
 // TODO: Remove duplicated code in send_message
 template <typename MsgIn, typename Timeout, typename... MsgOut>
-auto send_message_timeout(messaging_service* ms, messaging_verb verb, std::optional<locator::host_id> host_id, msg_addr id, Timeout timeout, MsgOut&&... msg) {
+auto send_message_timeout(messaging_service* ms, messaging_verb verb, std::optional<locator::host_id> host_id, std::optional<uint32_t> dst_shard, msg_addr id, Timeout timeout, MsgOut&&... msg) {
     auto rpc_handler = ms->rpc()->make_client<MsgIn(MsgOut...)>(verb);
     using futurator = futurize<std::invoke_result_t<decltype(rpc_handler), rpc_protocol::client&, MsgOut...>>;
     if (ms->is_shutting_down()) {
         return futurator::make_exception_future(rpc::closed_error());
     }
-    auto rpc_client_ptr = ms->get_rpc_client(verb, id, host_id);
+    auto rpc_client_ptr = ms->get_rpc_client(verb, id, host_id, dst_shard);
     auto& rpc_client = *rpc_client_ptr;
-    return rpc_handler(rpc_client, timeout, std::forward<MsgOut>(msg)...).handle_exception([ms = ms->shared_from_this(), id, host_id, verb, rpc_client_ptr = std::move(rpc_client_ptr)] (std::exception_ptr&& eptr) {
+    return rpc_handler(rpc_client, timeout, std::forward<MsgOut>(msg)...).handle_exception([ms = ms->shared_from_this(), id, host_id, dst_shard, verb, rpc_client_ptr = std::move(rpc_client_ptr)] (std::exception_ptr&& eptr) {
         ms->increment_dropped_messages(verb);
         if (try_catch<rpc::closed_error>(eptr)) {
-            // This is a transport error
+            // This is a transport error. The message may have been sent over
+            // the connection to the node instead of the one to the shard,
+            // see get_rpc_client().
+            if (host_id && dst_shard) {
+                ms->remove_error_rpc_client(verb, host_shard{*host_id, *dst_shard});
+            }
             if (host_id) {
                 ms->remove_error_rpc_client(verb, *host_id);
             } else {
@@ -188,27 +204,33 @@ auto send_message_timeout(messaging_service* ms, messaging_verb verb, std::optio
 
 template <typename MsgIn, typename Timeout, typename... MsgOut>
 auto send_message_timeout(messaging_service* ms, messaging_verb verb, msg_addr id, Timeout timeout, MsgOut&&... msg) {
-    return send_message_timeout<MsgIn, Timeout, MsgOut...>(ms, verb, std::nullopt, id, timeout, std::forward<MsgOut>(msg)...);
+    return send_message_timeout<MsgIn, Timeout, MsgOut...>(ms, verb, std::nullopt, std::nullopt, id, timeout, std::forward<MsgOut>(msg)...);
 }
 
 
 // Send a message for verb
 template <typename MsgIn, typename... MsgOut>
 auto send_message_timeout(messaging_service* ms, messaging_verb verb, locator::host_id hid, MsgOut&&... msg) {
-    return send_message_timeout<MsgIn, MsgOut...>(ms, verb, std::optional{hid}, ms->addr_for_host_id(hid), std::forward<MsgOut>(msg)...);
+    return send_message_timeout<MsgIn, MsgOut...>(ms, verb, std::optional{hid}, std::nullopt, ms->addr_for_host_id(hid), std::forward<MsgOut>(msg)...);
+}
+
+// Send a message for verb to the given shard of the node
+template <typename MsgIn, typename... MsgOut>
+auto send_message_timeout(messaging_service* ms, messaging_verb verb, host_shard id, MsgOut&&... msg) {
+    return send_message_timeout<MsgIn, MsgOut...>(ms, verb, std::optional{id.host}, std::optional{id.shard}, ms->addr_for_host_id(id.host), std::forward<MsgOut>(msg)...);
 }
 
 // Requesting abort on the provided abort_source drops the message from the outgoing queue (if it's still there)
 // and causes the returned future to resolve exceptionally with `abort_requested_exception`.
 // TODO: Remove duplicated code in send_message
 template <typename MsgIn, typename... MsgOut>
-auto send_message_cancellable(messaging_service* ms, messaging_verb verb, std::optional<locator::host_id> host_id, msg_addr id, abort_source& as, MsgOut&&... msg) {
+auto send_message_cancellable(messaging_service* ms, messaging_verb verb, std::optional<locator::host_id> host_id, std::optional<uint32_t> dst_shard, msg_addr id, abort_source& as, MsgOut&&... msg) {
     auto rpc_handler = ms->rpc()->make_client<MsgIn(MsgOut...)>(verb);
     using futurator = futurize<std::invoke_result_t<decltype(rpc_handler), rpc_protocol::client&, MsgOut...>>;
     if (ms->is_shutting_down()) {
         return futurator::make_exception_future(rpc::closed_error());
     }
-    auto rpc_client_ptr = ms->get_rpc_client(verb, id, host_id);
+    auto rpc_client_ptr = ms->get_rpc_client(verb, id, host_id, dst_shard);
     auto& rpc_client = *rpc_client_ptr;
 
     auto c = std::make_unique<seastar::rpc::cancellable>();
@@ -220,10 +242,15 @@ auto send_message_cancellable(messaging_service* ms, messaging_verb verb, std::o
         return futurator::make_exception_future(abort_requested_exception{});
     }
 
-    return rpc_handler(rpc_client, c_ref, std::forward<MsgOut>(msg)...).handle_exception([ms = ms->shared_from_this(), id, host_id, verb, rpc_client_ptr = std::move(rpc_client_ptr), sub = std::move(sub)] (std::exception_ptr&& eptr) {
+    return rpc_handler(rpc_client, c_ref, std::forward<MsgOut>(msg)...).handle_exception([ms = ms->shared_from_this(), id, host_id, dst_shard, verb, rpc_client_ptr = std::move(rpc_client_ptr), sub = std::move(sub)] (std::exception_ptr&& eptr) {
         ms->increment_dropped_messages(verb);
         if (try_catch<rpc::closed_error>(eptr)) {
-            // This is a transport error
+            // This is a transport error. The message may have been sent over
+            // the connection to the node instead of the one to the shard,
+            // see get_rpc_client().
+            if (host_id && dst_shard) {
+                ms->remove_error_rpc_client(verb, host_shard{*host_id, *dst_shard});
+            }
             if (host_id) {
                 ms->remove_error_rpc_client(verb, *host_id);
             } else {
@@ -242,12 +269,17 @@ auto send_message_cancellable(messaging_service* ms, messaging_verb verb, std::o
 
 template <typename MsgIn, typename... MsgOut>
 auto send_message_cancellable(messaging_service* ms, messaging_verb verb, msg_addr id, abort_source& as, MsgOut&&... msg) {
-    return send_message_cancellable<MsgIn, MsgOut...>(ms, verb, std::nullopt, id, as, std::forward<MsgOut>(msg)...);
+    return send_message_cancellable<MsgIn, MsgOut...>(ms, verb, std::nullopt, std::nullopt, id, as, std::forward<MsgOut>(msg)...);
 }
 
 template <typename MsgIn, typename... MsgOut>
 auto send_message_cancellable(messaging_service* ms, messaging_verb verb, locator::host_id id, abort_source& as, MsgOut&&... msg) {
-    return send_message_cancellable<MsgIn, MsgOut...>(ms, verb, std::optional{id}, ms->addr_for_host_id(id), as, std::forward<MsgOut>(msg)...);
+    return send_message_cancellable<MsgIn, MsgOut...>(ms, verb, std::optional{id}, std::nullopt, ms->addr_for_host_id(id), as, std::forward<MsgOut>(msg)...);
+}
+
+template <typename MsgIn, typename... MsgOut>
+auto send_message_cancellable(messaging_service* ms, messaging_verb verb, host_shard id, abort_source& as, MsgOut&&... msg) {
+    return send_message_cancellable<MsgIn, MsgOut...>(ms, verb, std::optional{id.host}, std::optional{id.shard}, ms->addr_for_host_id(id.host), as, std::forward<MsgOut>(msg)...);
 }
 
 // Send one way message for verb
@@ -273,4 +305,16 @@ auto send_message_oneway_timeout(messaging_service* ms, messaging_verb verb, loc
     return send_message_timeout<rpc::no_wait_type>(ms, std::move(verb), std::move(id), timeout, std::forward<MsgOut>(msg)...);
 }
 
+// Send one way message for verb to the given shard of the node
+template <typename... MsgOut>
+auto send_message_oneway(messaging_service* ms, messaging_verb verb, host_shard id, MsgOut&&... msg) {
+    return send_message<rpc::no_wait_type>(ms, std::move(verb), std::move(id), std::forward<MsgOut>(msg)...);
+}
+
+// Send one way message for verb to the given shard of the node
+template <typename Timeout, typename... MsgOut>
+auto send_message_oneway_timeout(messaging_service* ms, messaging_verb verb, host_shard id, Timeout timeout, MsgOut&&... msg) {
+    return send_message_timeout<rpc::no_wait_type>(ms, std::move(verb), std::move(id), timeout, std::forward<MsgOut>(msg)...);
+}
+
 } // namespace netw
@@ -474,9 +474,16 @@ struct mapreduce_request {
         count,
         aggregate
     };
+    // A constant trailing argument of an aggregate, e.g. the percentile
+    // in approx_percentile(col, 0.99).
+    struct constant_argument {
+        sstring type_name;
+        bytes_opt value;
+    };
     struct aggregation_info {
         db::functions::function_name name;
         std::vector<sstring> column_names;
+        std::vector<constant_argument> constant_arguments;
     };
     struct reductions_info {
         // Used by selector_factries to prepare reductions information
@@ -492,15 +499,35 @@ struct mapreduce_request {
     db::consistency_level cl;
     lowres_system_clock::time_point timeout;
     std::optional<std::vector<aggregation_info>> aggregation_infos;
+    // Names of GROUP BY columns, in GROUP BY order. When set, every shard
+    // produces one row of partial aggregation states per group, prefixed
+    // with the group's key (see mapreduce_result::grouped_query_results).
+    std::optional<std::vector<sstring>> group_by_column_names;
+    // The number of groups above which the grouped result isn't wanted, on
+    // top of the parallelized_group_by_max_groups limit, e.g. the page size
+    // of the query. The execution gives up as soon as it's exceeded.
+    std::optional<uint64_t> max_groups;
+
+    bool is_grouped() const {
+        return group_by_column_names && !group_by_column_names->empty();
+    }
 };
 
 std::ostream& operator<<(std::ostream& out, const mapreduce_request& r);
 std::ostream& operator<<(std::ostream& out, const mapreduce_request::reduction_type& r);
+std::ostream& operator<<(std::ostream& out, const mapreduce_request::constant_argument& a);
 std::ostream& operator<<(std::ostream& out, const mapreduce_request::aggregation_info& a);
 
 struct mapreduce_result {
     // vector storing query result for each selected column
     std::vector<bytes_opt> query_results;
+    // For grouped requests: one row per group, holding the values of GROUP BY
+    // columns followed by the (partial) result of each reduction.
+    std::optional<std::vector<std::vector<bytes_opt>>> grouped_query_results;
+    // Set when the number of groups exceeded the configured bound on some
+    // shard or coordinator. The partial results are then dropped and the
+    // caller is expected to fall back to a paged, non-parallelized query.
+    bool group_limit_exceeded = false;
 
     struct printer {
         const std::vector<::shared_ptr<db::functions::aggregate_function>> functions;
@@ -517,5 +544,6 @@ template <> struct fmt::formatter<query::partition_slice> : fmt::ostream_formatt
 template <> struct fmt::formatter<query::read_command> : fmt::ostream_formatter {};
 template <> struct fmt::formatter<query::mapreduce_request> : fmt::ostream_formatter {};
 template <> struct fmt::formatter<query::mapreduce_request::reduction_type> : fmt::ostream_formatter {};
+template <> struct fmt::formatter<query::mapreduce_request::constant_argument> : fmt::ostream_formatter {};
 template <> struct fmt::formatter<query::mapreduce_request::aggregation_info> : fmt::ostream_formatter {};
 template <> struct fmt::formatter<query::mapreduce_result::printer> : fmt::ostream_formatter {};
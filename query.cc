@@ -83,9 +83,18 @@ std::ostream& operator<<(std::ostream& out, const mapreduce_request::reduction_t
     return out << "}";
 }
 
+std::ostream& operator<<(std::ostream& out, const mapreduce_request::constant_argument& a) {
+    fmt::print(out, "{}:{}", a.type_name, a.value ? to_hex(*a.value) : sstring("null"));
+    return out;
+}
+
 std::ostream& operator<<(std::ostream& out, const mapreduce_request::aggregation_info& a) {
-    fmt::print(out, "aggregation_info{{, name={}, column_names=[{}]}}",
+    fmt::print(out, "aggregation_info{{, name={}, column_names=[{}]",
                a.name, fmt::join(a.column_names, ","));;
+    if (!a.constant_arguments.empty()) {
+        fmt::print(out, ", constant_arguments=[{}]", fmt::join(a.constant_arguments, ","));
+    }
+    out << "}";
     return out;
 }
 
@@ -97,6 +106,13 @@ std::ostream& operator<<(std::ostream& out, const mapreduce_request& r) {
         fmt::print(out, ", aggregation_infos=[{}]",
                    fmt::join(r.aggregation_infos.value(), ","));
     }
+    if (r.group_by_column_names) {
+        fmt::print(out, ", group_by=[{}]",
+                   fmt::join(r.group_by_column_names.value(), ","));
+    }
+    if (r.max_groups) {
+        fmt::print(out, ", max_groups={}", *r.max_groups);
+    }
     fmt::print(out, "cmd={}, pr={}, cl={}, timeout(ms)={}}}",
                r.cmd, r.pr, r.cl, ms);
     return out;
@@ -392,6 +408,12 @@ foreign_ptr<lw_shared_ptr<query::result>> result_merger::get() {
 }
 
 std::ostream& operator<<(std::ostream& out, const query::mapreduce_result::printer& p) {
+    if (p.res.group_limit_exceeded) {
+        return out << "[group limit exceeded]";
+    }
+    if (p.res.grouped_query_results) {
+        return out << "[" << p.res.grouped_query_results->size() << " groups]";
+    }
     if (p.functions.size() != p.res.query_results.size()) {
         return out << "[malformed mapreduce_result (" << p.res.query_results.size()
             << " results, " << p.functions.size() << " aggregates)]";
@@ -527,7 +527,7 @@ void fsm::tick_leader() {
                 progress.probe_sent = false;
                 break;
             case follower_progress::state::PIPELINE:
-                if (progress.in_flight == follower_progress::max_in_flight) {
+                if (progress.in_flight == _config.max_in_flight_append_requests) {
                     progress.in_flight--; // allow one more packet to be sent
                 }
                 break;
@@ -881,7 +881,7 @@ void fsm::replicate_to(follower_progress& progress, bool allow_empty) {
     logger.trace("replicate_to[{}->{}]: called next={} match={}",
         _my_id, progress.id, progress.next_idx, progress.match_idx);
 
-    while (progress.can_send_to()) {
+    while (progress.can_send_to(_config.max_in_flight_append_requests)) {
         index_t next_idx = progress.next_idx;
         if (progress.next_idx > _log.last_idx()) {
             next_idx = index_t(0);
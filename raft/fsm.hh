@@ -58,6 +58,10 @@ struct fsm_config {
     size_t max_log_size;
     // If set to true will enable prevoting stage during election
     bool enable_prevoting;
+    // Max number of un-acked append entries requests sent to a
+    // follower in pipeline mode. Entries added while the limit
+    // is reached are batched into the next request.
+    size_t max_in_flight_append_requests = 10;
 };
 
 class fsm;
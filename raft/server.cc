@@ -347,6 +347,9 @@ server_impl::server_impl(server_id uuid, std::unique_ptr<rpc> rpc,
                     _persistence(std::move(persistence)), _failure_detector(failure_detector),
                     _id(uuid), _config(config) {
     set_rpc_server(_rpc.get());
+    if (_config.max_in_flight_append_requests == 0) {
+        throw config_error(fmt::format("[{}] max_in_flight_append_requests must be greater than zero", _id));
+    }
     if (_config.snapshot_threshold_log_size > _config.max_log_size) {
         throw config_error(fmt::format("[{}] snapshot_threshold_log_size ({}) must not be greater than max_log_size ({})",
             _id, _config.snapshot_threshold_log_size, _config.max_log_size));
@@ -382,7 +385,8 @@ future<> server_impl::start() {
                                  fsm_config {
                                      .append_request_threshold = _config.append_request_threshold,
                                      .max_log_size = _config.max_log_size,
-                                     .enable_prevoting = _config.enable_prevoting
+                                     .enable_prevoting = _config.enable_prevoting,
+                                     .max_in_flight_append_requests = _config.max_in_flight_append_requests,
                                  },
                                  _events);
 
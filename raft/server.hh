@@ -38,6 +38,12 @@ class server {
         size_t snapshot_trailing_size = 1 * 1024 * 1024;
         // max size of appended entries in bytes
         size_t append_request_threshold = 100000;
+        // Max number of append entries requests the leader keeps in
+        // flight to a follower which is known to be in sync.
+        // Together with append_request_threshold it bounds the amount
+        // of data sent to a follower ahead of its replies.
+        // Must be greater than zero.
+        size_t max_in_flight_append_requests = 10;
         // Limit in bytes on the size of in-memory part of the log after
         // which requests are stopped to be admitted until the log
         // is shrunk back by a snapshot.
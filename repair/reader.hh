@@ -42,7 +42,8 @@ class repair_reader {
         read_strategy strategy,
         const dht::sharder& remote_sharder,
         unsigned remote_shard,
-        gc_clock::time_point compaction_time);
+        gc_clock::time_point compaction_time,
+        bool unrepaired_only);
 
 public:
     repair_reader(
@@ -55,7 +56,10 @@ class repair_reader {
         unsigned remote_shard,
         uint64_t seed,
         read_strategy strategy,
-        gc_clock::time_point compaction_time);
+        gc_clock::time_point compaction_time,
+        // Read only the memtables and the sstables which aren't repaired
+        // yet, for incremental repair. Only supported with read_strategy::local.
+        bool unrepaired_only = false);
 
     future<mutation_fragment_opt>
     read_mutation_fragment();
@@ -218,6 +218,9 @@ enum class repair_stream_cmd : uint8_t {
     end_of_current_rows,
     get_full_row_hashes,
     put_rows_done,
+    // A batch of rows, serialized and compressed, see
+    // row_level_diff_detect_algorithm::send_full_set_rpc_stream_compressed.
+    compressed_row_data,
 };
 
 struct repair_hash_with_cmd {
@@ -228,11 +231,16 @@ struct repair_hash_with_cmd {
 struct repair_row_on_wire_with_cmd {
     repair_stream_cmd cmd;
     repair_row_on_wire row;
+    // Set with repair_stream_cmd::compressed_row_data, instead of row.
+    bytes compressed_rows;
 };
 
 enum class row_level_diff_detect_algorithm : uint8_t {
     send_full_set,
     send_full_set_rpc_stream,
+    // Like send_full_set_rpc_stream, but the rows are sent over the RPC
+    // streams in compressed batches rather than a partition at a time.
+    send_full_set_rpc_stream_compressed,
 };
 
 std::string_view format_as(row_level_diff_detect_algorithm);
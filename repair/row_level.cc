@@ -35,6 +35,8 @@
 #include <random>
 #include <optional>
 #include <boost/intrusive/list.hpp>
+#include <lz4.h>
+#include <seastar/core/byteorder.hh>
 #include "gms/i_endpoint_state_change_subscriber.hh"
 #include "gms/gossiper.hh"
 #include "repair/row_level.hh"
@@ -50,6 +52,8 @@
 #include "service/storage_proxy.hh"
 #include "db/batchlog_manager.hh"
 #include "idl/repair.dist.hh"
+#include "idl/repair.dist.impl.hh"
+#include "serializer_impl.hh"
 #include "readers/empty_v2.hh"
 #include "readers/evictable.hh"
 #include "readers/queue.hh"
@@ -188,6 +192,8 @@ struct row_level_repair_metrics {
     uint64_t row_from_disk_bytes{0};
     uint64_t tx_hashes_nr{0};
     uint64_t rx_hashes_nr{0};
+    uint64_t tx_row_compressed_bytes{0};
+    uint64_t rx_row_compressed_bytes{0};
     row_level_repair_metrics() {
         namespace sm = seastar::metrics;
         _metrics.add_group("repair", {
@@ -207,6 +213,10 @@ struct row_level_repair_metrics {
                             sm::description("Total number of rows read from disk on this shard.")),
             sm::make_counter("row_from_disk_bytes", row_from_disk_bytes,
                             sm::description("Total bytes of rows read from disk on this shard.")),
+            sm::make_counter("tx_row_compressed_bytes", tx_row_compressed_bytes,
+                            sm::description("Total bytes of compressed row batches sent on this shard.")),
+            sm::make_counter("rx_row_compressed_bytes", rx_row_compressed_bytes,
+                            sm::description("Total bytes of compressed row batches received on this shard.")),
         });
     }
 };
@@ -217,6 +227,7 @@ static const std::vector<row_level_diff_detect_algorithm>& suportted_diff_detect
     static std::vector<row_level_diff_detect_algorithm> _algorithms = {
         row_level_diff_detect_algorithm::send_full_set,
         row_level_diff_detect_algorithm::send_full_set_rpc_stream,
+        row_level_diff_detect_algorithm::send_full_set_rpc_stream_compressed,
     };
     return _algorithms;
 };
@@ -252,6 +263,96 @@ static bool is_rpc_stream_supported(row_level_diff_detect_algorithm algo) {
     return algo != row_level_diff_detect_algorithm::send_full_set;
 }
 
+// An upper bound of what the serialization adds to a partition key or a
+// mutation fragment, accounted for in the size of a batch.
+static constexpr size_t serialized_rows_overhead = 16;
+
+static bytes compress_rows(const repair_rows_on_wire& rows) {
+    auto in = ser::serialize_to_buffer<bytes>(rows);
+    bytes out(bytes::initialized_later(), sizeof(uint32_t) + LZ4_COMPRESSBOUND(in.size()));
+    write_le<uint32_t>(reinterpret_cast<char*>(out.data()), in.size());
+    auto len = LZ4_compress_default(reinterpret_cast<const char*>(in.data()), reinterpret_cast<char*>(out.data()) + sizeof(uint32_t),
+            in.size(), out.size() - sizeof(uint32_t));
+    if (len == 0) {
+        throw std::runtime_error("Failed to compress repair rows");
+    }
+    out.resize(sizeof(uint32_t) + len);
+    return out;
+}
+
+repair_rows_on_wire decompress_rows(const bytes& in) {
+    if (in.size() < sizeof(uint32_t)) {
+        throw std::runtime_error(format("Malformed compressed repair rows, size={}", in.size()));
+    }
+    auto size = read_le<uint32_t>(reinterpret_cast<const char*>(in.data()));
+    if (size > max_compressed_rows_batch_size) {
+        throw std::runtime_error(format("Malformed compressed repair rows, uncompressed size={}", size));
+    }
+    bytes out(bytes::initialized_later(), size);
+    auto len = LZ4_decompress_safe(reinterpret_cast<const char*>(in.data()) + sizeof(uint32_t), reinterpret_cast<char*>(out.data()),
+            in.size() - sizeof(uint32_t), out.size());
+    if (len < 0 || size_t(len) != out.size()) {
+        throw std::runtime_error("Failed to decompress repair rows");
+    }
+    _metrics.rx_row_compressed_bytes += in.size();
+    return ser::deserialize_from_buffer(out, std::type_identity<repair_rows_on_wire>());
+}
+
+future<> send_rows_on_wire(noncopyable_function<future<> (const repair_row_on_wire_with_cmd&)> sink, repair_rows_on_wire rows, bool compress) {
+    repair_rows_on_wire batch;
+    size_t batch_size = 0;
+    auto send_batch = [&] () -> future<> {
+        if (batch.empty()) {
+            co_return;
+        }
+        auto cmd = repair_row_on_wire_with_cmd{repair_stream_cmd::compressed_row_data, repair_row_on_wire(), compress_rows(batch)};
+        _metrics.tx_row_compressed_bytes += cmd.compressed_rows.size();
+        co_await utils::clear_gently(batch);
+        batch.clear();
+        batch_size = 0;
+        co_await sink(cmd);
+    };
+    for (repair_row_on_wire& row : rows) {
+        if (!compress) {
+            auto cmd = repair_row_on_wire_with_cmd{repair_stream_cmd::row_data, std::move(row)};
+            co_await sink(cmd);
+            co_await cmd.row.clear_gently();
+            continue;
+        }
+        // The partition may be split between batches.
+        bool new_partition = true;
+        auto& mfs = row.get_mutation_fragments();
+        while (!mfs.empty()) {
+            auto mf = std::move(mfs.front());
+            mfs.pop_front();
+            auto mf_size = mf.representation().size();
+            if (mf_size >= compressed_rows_batch_size) {
+                co_await send_batch();
+                new_partition = true;
+                co_await sink(repair_row_on_wire_with_cmd{repair_stream_cmd::row_data, repair_row_on_wire(row.get_key(), {std::move(mf)})});
+                continue;
+            }
+            if (new_partition || batch.empty()) {
+                batch.push_back(repair_row_on_wire(row.get_key(), {}));
+                batch_size += row.get_key().representation().size() + serialized_rows_overhead;
+                new_partition = false;
+            }
+            batch.back().push_mutation_fragment(std::move(mf));
+            batch_size += mf_size + serialized_rows_overhead;
+            if (batch_size >= compressed_rows_batch_size) {
+                co_await send_batch();
+            }
+            co_await coroutine::maybe_yield();
+        }
+    }
+    co_await send_batch();
+    co_await sink(repair_row_on_wire_with_cmd{repair_stream_cmd::end_of_current_rows, repair_row_on_wire()});
+}
+
+static auto rows_sink(rpc::sink<repair_row_on_wire_with_cmd>& sink) {
+    return [&sink] (const repair_row_on_wire_with_cmd& cmd) { return sink(cmd); };
+}
+
 static uint64_t get_random_seed() {
     static thread_local std::default_random_engine random_engine{std::random_device{}()};
     static thread_local std::uniform_int_distribution<uint64_t> random_dist{};
@@ -265,16 +366,28 @@ repair_hash repair_hasher::do_hash_for_mf(const decorated_key_with_hash& dk_with
     return repair_hash(h.finalize_uint64());
 }
 
+static const sstables::sstable_predicate& unrepaired_sstable_predicate() {
+    static const sstables::sstable_predicate predicate = [] (const sstables::sstable& sst) {
+        return !sst.is_repaired();
+    };
+    return predicate;
+}
+
 mutation_reader repair_reader::make_reader(
     seastar::sharded<replica::database>& db,
     replica::column_family& cf,
     read_strategy strategy,
     const dht::sharder& remote_sharder,
     unsigned remote_shard,
-    gc_clock::time_point compaction_time) {
+    gc_clock::time_point compaction_time,
+    bool unrepaired_only) {
+    if (unrepaired_only && strategy != read_strategy::local) {
+        on_internal_error(rlogger, format("make_reader: reading only unrepaired data is not supported with read_strategy {}", strategy));
+    }
     switch (strategy) {
         case read_strategy::local: {
-            auto ms = mutation_source([&cf, compaction_time] (
+            auto& predicate = unrepaired_only ? unrepaired_sstable_predicate() : sstables::default_sstable_predicate();
+            auto ms = mutation_source([&cf, compaction_time, &predicate] (
                 schema_ptr s,
                 reader_permit permit,
                 const dht::partition_range& pr,
@@ -282,7 +395,7 @@ mutation_reader repair_reader::make_reader(
                 tracing::trace_state_ptr,
                 streamed_mutation::forwarding,
                 mutation_reader::forwarding fwd_mr) {
-                return cf.make_streaming_reader(std::move(s), std::move(permit), pr, ps, fwd_mr, compaction_time);
+                return cf.make_streaming_reader(std::move(s), std::move(permit), pr, ps, fwd_mr, compaction_time, predicate);
             });
             mutation_reader rd(nullptr);
             std::tie(rd, _reader_handle) = make_manually_paused_evictable_reader_v2(
@@ -334,14 +447,15 @@ repair_reader::repair_reader(
     unsigned remote_shard,
     uint64_t seed,
     read_strategy strategy,
-    gc_clock::time_point compaction_time)
+    gc_clock::time_point compaction_time,
+    bool unrepaired_only)
     : _schema(s)
     , _permit(std::move(permit))
     , _range(dht::to_partition_range(range))
     , _sharder(remote_sharder, range, remote_shard)
     , _seed(seed)
     , _local_read_op(strategy == read_strategy::local ? std::optional(cf.read_in_progress()) : std::nullopt)
-    , _reader(make_reader(db, cf, strategy, remote_sharder, remote_shard, compaction_time))
+    , _reader(make_reader(db, cf, strategy, remote_sharder, remote_shard, compaction_time, unrepaired_only))
 { }
 
 future<mutation_fragment_opt>
@@ -605,6 +719,7 @@ future<std::list<repair_row>> to_repair_rows_list(repair_rows_on_wire rows, sche
             dht::decorated_key dk = dht::decorate_key(*s, x.get_key());
             if (!(dk_ptr && dk_ptr->dk.equal(*s, dk))) {
                 dk_ptr = make_lw_shared<const decorated_key_with_hash>(*s, dk, seed);
+                last_mf = {};
             }
             auto& mutation_fragments = x.get_mutation_fragments();
             if (is_master) {
@@ -624,7 +739,6 @@ future<std::list<repair_row>> to_repair_rows_list(repair_rows_on_wire rows, sche
                     co_await coroutine::maybe_yield();
                 }
             } else {
-                last_mf = {};
                 for (auto fmfit = mutation_fragments.begin(); fmfit != mutation_fragments.end(); fmfit = mutation_fragments.erase(fmfit)) {
                     auto fmf = std::move(*fmfit);
 
@@ -725,6 +839,12 @@ class repair_meta {
     repair_hasher _repair_hasher;
     gc_clock::time_point _compaction_time;
     bool _is_tablet;
+    // Incremental repair reads only the data which isn't repaired yet, and
+    // marks the sstables it read as repaired once the repair succeeds.
+    bool _incremental;
+    // The unrepaired sstables which are fully contained in _range, as of
+    // the creation of the reader.
+    std::vector<sstables::shared_sstable> _sstables_to_mark_repaired;
     reader_concurrency_semaphore::inactive_read_handle _fake_inactive_read_handle;
     std::unique_ptr<const locator::token_metadata> _small_table_optimization_tm;
     seastar::semaphore _small_table_optimization_tm_sem{1};
@@ -765,6 +885,9 @@ class repair_meta {
     bool use_rpc_stream() const {
         return is_rpc_stream_supported(_algo);
     }
+    bool compress_rows_on_wire() const {
+        return _algo == row_level_diff_detect_algorithm::send_full_set_rpc_stream_compressed;
+    }
 
 public:
     // master constructor
@@ -785,7 +908,8 @@ class repair_meta {
             size_t nr_peer_nodes,
             std::vector<std::optional<shard_id>> all_live_peer_shards,
             row_level_repair* row_level_repair_ptr,
-            gc_clock::time_point compaction_time)
+            gc_clock::time_point compaction_time,
+            bool incremental)
             : _rs(rs)
             , _db(rs.get_db())
             , _messaging(rs.get_messaging())
@@ -826,6 +950,8 @@ class repair_meta {
             , _repair_hasher(_seed, _schema)
             , _compaction_time(compaction_time)
             , _is_tablet(cf.uses_tablets())
+            // Only tablets are always read locally, see read_rows_from_disk().
+            , _incremental(incremental && _is_tablet)
             {
             if (master) {
                 add_to_repair_meta_for_masters(*this);
@@ -861,9 +987,10 @@ class repair_meta {
             streaming::stream_reason reason,
             shard_config master_node_shard_config,
             host_id_vector_replica_set all_live_peer_nodes,
-            gc_clock::time_point compaction_time)
+            gc_clock::time_point compaction_time,
+            bool incremental)
         : repair_meta(rs, cf, std::move(s), std::move(permit), std::move(range), algo, max_row_buf_size, seed, master, repair_meta_id, reason,
-                std::move(master_node_shard_config), std::move(all_live_peer_nodes), 1, {std::nullopt}, nullptr, compaction_time)
+                std::move(master_node_shard_config), std::move(all_live_peer_nodes), 1, {std::nullopt}, nullptr, compaction_time, incremental)
     {
     }
 
@@ -958,6 +1085,43 @@ class repair_meta {
         return _repair_reader ? _repair_reader->close() : make_ready_future<>();
     }
 
+    // Marks the sstables read by an incremental repair as repaired. Must be
+    // called only after the repair succeeded and the meta was stopped, so
+    // that all the rows read were synced with the peers.
+    //
+    // The sstables are registered as compacting while they are marked, so
+    // that compaction doesn't pick them while their statistics change.
+    // Sstables which were compacted away in the meantime, or are being
+    // compacted, are skipped: the data they had lives in unrepaired sstables
+    // and will be read again by the next repair. Failures are not fatal for
+    // the same reason, an sstable which failed to be marked stays unrepaired.
+    future<> mark_sstables_repaired() noexcept {
+        if (!_incremental || _sstables_to_mark_repaired.empty()) {
+            co_return;
+        }
+        auto sstables = std::exchange(_sstables_to_mark_repaired, {});
+        try {
+            auto& cf = _db.local().find_column_family(_schema->id());
+            // 0 means not repaired.
+            auto repaired_at = std::max<uint64_t>(1, std::chrono::duration_cast<std::chrono::milliseconds>(_compaction_time.time_since_epoch()).count());
+            size_t marked = 0;
+            co_await cf.get_compaction_manager().run_with_sstables_compacting(std::move(sstables),
+                    [&] (const std::vector<sstables::shared_sstable>& compacting) -> future<> {
+                for (auto& sst : compacting) {
+                    // Checked for each sstable, since marking one defers.
+                    if (cf.get_sstables()->contains(sst) && !sst->is_repaired()) {
+                        co_await sst->mutate_repaired_at(repaired_at);
+                        ++marked;
+                    }
+                }
+            });
+            rlogger.debug("repair_meta: meta_id={}, marked {} sstables as repaired at {}",
+                    _repair_meta_id, marked, repaired_at);
+        } catch (...) {
+            rlogger.warn("repair_meta: meta_id={}, failed to mark sstables as repaired: {}", _repair_meta_id, std::current_exception());
+        }
+    }
+
 private:
     future<uint64_t> do_estimate_partitions_on_all_shards(const dht::token_range& range) {
         return estimate_partitions(_db, _schema->ks_name(), _schema->cf_name(), range);
@@ -1075,8 +1239,22 @@ class repair_meta {
             // We are about to create a real evictable reader, so drop the fake
             // reader (evicted or not), we don't need it anymore.
             _db.local().get_reader_concurrency_semaphore().unregister_inactive_read(std::move(_fake_inactive_read_handle));
+            auto& cf = _db.local().find_column_family(_schema->id());
+            if (_incremental) {
+                // Sstables only ever leave the sstable set, so the ones which
+                // are still there when the repair finishes were read fully,
+                // even if the reader is evicted and recreated in between.
+                auto sstables = cf.get_sstables();
+                for (auto& sst : *sstables) {
+                    if (!sst->is_repaired()
+                            && _range.contains(sst->get_first_decorated_key().token(), dht::token_comparator())
+                            && _range.contains(sst->get_last_decorated_key().token(), dht::token_comparator())) {
+                        _sstables_to_mark_repaired.push_back(sst);
+                    }
+                }
+            }
             _repair_reader.emplace(_db,
-                _db.local().find_column_family(_schema->id()),
+                cf,
                 _schema,
                 _permit,
                 _range,
@@ -1130,7 +1308,8 @@ class repair_meta {
                         read_strategy);
                     return read_strategy;
                 }),
-                _compaction_time);
+                _compaction_time,
+                _incremental);
         }
         try {
             while (cur_size < _max_row_buf_size) {
@@ -1545,7 +1724,7 @@ class repair_meta {
             co_await ser::repair_rpc_verbs::send_repair_row_level_start(&_messaging, remote_node,
                 _repair_meta_id, ks_name, cf_name, std::move(range), _algo, _max_row_buf_size, _seed,
                 _master_node_shard_config.shard, _master_node_shard_config.shard_count, _master_node_shard_config.ignore_msb,
-                remote_partitioner_name, std::move(schema_version), reason, compaction_time, dst_cpu_id);
+                remote_partitioner_name, std::move(schema_version), reason, compaction_time, dst_cpu_id, _incremental);
         if (resp && resp->status == repair_row_level_start_status::no_such_column_family) {
             throw replica::no_such_column_family(ks_name, cf_name);
         } else {
@@ -1558,11 +1737,11 @@ class repair_meta {
     repair_row_level_start_handler(repair_service& repair, locator::host_id from_id, uint32_t src_cpu_id, uint32_t repair_meta_id, sstring ks_name, sstring cf_name,
             dht::token_range range, row_level_diff_detect_algorithm algo, uint64_t max_row_buf_size,
             uint64_t seed, shard_config master_node_shard_config, table_schema_version schema_version, streaming::stream_reason reason,
-            gc_clock::time_point compaction_time, abort_source& as) {
-        rlogger.debug(">>> Started Row Level Repair (Follower): local={}, peers={}, repair_meta_id={}, keyspace={}, cf={}, schema_version={}, range={}, seed={}, max_row_buf_siz={}",
-                repair.my_host_id(), from_id, repair_meta_id, ks_name, cf_name, schema_version, range, seed, max_row_buf_size);
+            gc_clock::time_point compaction_time, bool incremental, abort_source& as) {
+        rlogger.debug(">>> Started Row Level Repair (Follower): local={}, peers={}, repair_meta_id={}, keyspace={}, cf={}, schema_version={}, range={}, seed={}, max_row_buf_siz={}, incremental={}",
+                repair.my_host_id(), from_id, repair_meta_id, ks_name, cf_name, schema_version, range, seed, max_row_buf_size, incremental);
         try {
-            co_await repair.insert_repair_meta(from_id, src_cpu_id, repair_meta_id, std::move(range), algo, max_row_buf_size, seed, std::move(master_node_shard_config), std::move(schema_version), reason, compaction_time, as);
+            co_await repair.insert_repair_meta(from_id, src_cpu_id, repair_meta_id, std::move(range), algo, max_row_buf_size, seed, std::move(master_node_shard_config), std::move(schema_version), reason, compaction_time, incremental, as);
             co_return repair_row_level_start_response{repair_row_level_start_status::ok};
         } catch (replica::no_such_column_family&) {
             co_return repair_row_level_start_response{repair_row_level_start_status::no_such_column_family};
@@ -1570,23 +1749,31 @@ class repair_meta {
     }
 
     // RPC API
-    future<> repair_row_level_stop(locator::host_id remote_node, sstring ks_name, sstring cf_name, dht::token_range range, shard_id dst_cpu_id) {
+    // mark_repaired is set if the repair succeeded, for incremental repair.
+    future<> repair_row_level_stop(locator::host_id remote_node, sstring ks_name, sstring cf_name, dht::token_range range, shard_id dst_cpu_id, bool mark_repaired) {
         if (remote_node == myhostid()) {
-            co_return co_await stop();
+            co_await stop();
+            if (mark_repaired) {
+                co_await mark_sstables_repaired();
+            }
+            co_return;
         }
         stats().rpc_call_nr++;
         co_return co_await ser::repair_rpc_verbs::send_repair_row_level_stop(&_messaging, remote_node,
-                _repair_meta_id, std::move(ks_name), std::move(cf_name), std::move(range), dst_cpu_id);
+                _repair_meta_id, std::move(ks_name), std::move(cf_name), std::move(range), dst_cpu_id, mark_repaired);
     }
 
     // RPC handler
     static future<>
-    repair_row_level_stop_handler(repair_service& rs, locator::host_id from, uint32_t repair_meta_id, sstring ks_name, sstring cf_name, dht::token_range range) {
-        rlogger.debug("<<< Finished Row Level Repair (Follower): local={}, peers={}, repair_meta_id={}, keyspace={}, cf={}, range={}",
-                rs.my_host_id(), from, repair_meta_id, ks_name, cf_name, range);
+    repair_row_level_stop_handler(repair_service& rs, locator::host_id from, uint32_t repair_meta_id, sstring ks_name, sstring cf_name, dht::token_range range, bool mark_repaired) {
+        rlogger.debug("<<< Finished Row Level Repair (Follower): local={}, peers={}, repair_meta_id={}, keyspace={}, cf={}, range={}, mark_repaired={}",
+                rs.my_host_id(), from, repair_meta_id, ks_name, cf_name, range, mark_repaired);
         auto rm = rs.get_repair_meta(from, repair_meta_id);
         rm->set_repair_state_for_local_node(repair_state::row_level_stop_started);
         co_await rs.remove_repair_meta(from, repair_meta_id, std::move(ks_name), std::move(cf_name), std::move(range));
+        if (mark_repaired) {
+            co_await rm->mark_sstables_repaired();
+        }
         rm->set_repair_state_for_local_node(repair_state::row_level_stop_finished);
     }
 
@@ -1702,6 +1889,9 @@ class repair_meta {
                 if (row.cmd == repair_stream_cmd::row_data) {
                     rlogger.trace("get_row_diff: Got repair_row_on_wire with data");
                     current_rows.push_back(std::move(row.row));
+                } else if (row.cmd == repair_stream_cmd::compressed_row_data) {
+                    rlogger.trace("get_row_diff: Got repair_row_on_wire with compressed data");
+                    current_rows.splice(current_rows.end(), decompress_rows(row.compressed_rows));
                 } else if (row.cmd == repair_stream_cmd::end_of_current_rows) {
                     rlogger.trace("get_row_diff: Got repair_row_on_wire with nullopt");
                     apply_rows_on_master_in_thread(std::move(current_rows), remote_node, update_working_row_buf::yes, update_hash_set, node_idx);
@@ -1833,12 +2023,8 @@ class repair_meta {
             locator::host_id remote_node) {
         std::exception_ptr ep;
         try {
-            for (repair_row_on_wire& row : rows) {
-                rlogger.trace("put_row_diff: send row");
-                co_await sink(repair_row_on_wire_with_cmd{repair_stream_cmd::row_data, std::move(row)});
-            }
-            rlogger.trace("put_row_diff: send empty row");
-            co_await sink(repair_row_on_wire_with_cmd{repair_stream_cmd::end_of_current_rows, repair_row_on_wire()});
+            rlogger.trace("put_row_diff: send rows");
+            co_await send_rows_on_wire(rows_sink(sink), std::move(rows), compress_rows_on_wire());
             rlogger.trace("put_row_diff: send done");
             co_await sink.flush();
         } catch (...) {
@@ -2030,8 +2216,10 @@ static future<> repair_get_row_diff_with_rpc_stream_process_op_slow_path(
         bool needs_all_rows = hash_cmd.cmd == repair_stream_cmd::needs_all_rows;
         _metrics.rx_hashes_nr += current_set_diff.size();
         auto fp = make_foreign(std::make_unique<repair_hash_set>(std::move(current_set_diff)));
+        bool compress = false;
         repair_rows_on_wire rows_on_wire  = co_await repair.invoke_on(dst_cpu_id, [&] (repair_service& local_repair) -> future<repair_rows_on_wire> {
             auto rm = local_repair.get_repair_meta(from, repair_meta_id);
+            compress = rm->compress_rows_on_wire();
             rm->set_repair_state_for_local_node(repair_state::get_row_diff_with_rpc_stream_started);
             if (fp.get_owner_shard() == this_shard_id()) {
                 repair_rows_on_wire rows = co_await rm->get_row_diff_handler(std::move(*fp), repair_meta::needs_all_rows_t(needs_all_rows));
@@ -2043,16 +2231,7 @@ static future<> repair_get_row_diff_with_rpc_stream_process_op_slow_path(
                 co_return rows;
             }
         });
-        if (rows_on_wire.empty()) {
-            co_await sink(repair_row_on_wire_with_cmd{repair_stream_cmd::end_of_current_rows, repair_row_on_wire()});
-        } else {
-            for (repair_row_on_wire& row : rows_on_wire) {
-                auto cmd = repair_row_on_wire_with_cmd{repair_stream_cmd::row_data, std::move(row)};
-                co_await sink(cmd);
-                co_await cmd.row.clear_gently();
-            }
-            co_await sink(repair_row_on_wire_with_cmd{repair_stream_cmd::end_of_current_rows, repair_row_on_wire()});
-        }
+        co_await send_rows_on_wire(rows_sink(sink), std::move(rows_on_wire), compress);
         co_await sink.flush();
         co_return;
     } else {
@@ -2076,6 +2255,10 @@ static future<> repair_put_row_diff_with_rpc_stream_process_op(
         rlogger.trace("Got repair_rows_on_wire from peer={}, got row_data", from);
         current_rows.push_back(std::move(row.row));
         co_return;
+    } else if (row.cmd == repair_stream_cmd::compressed_row_data) {
+        rlogger.trace("Got repair_rows_on_wire from peer={}, got compressed_row_data", from);
+        current_rows.splice(current_rows.end(), decompress_rows(row.compressed_rows));
+        co_return;
     } else if (row.cmd == repair_stream_cmd::end_of_current_rows) {
         rlogger.trace("Got repair_rows_on_wire from peer={}, got end_of_current_rows", from);
         auto fp = make_foreign(std::make_unique<repair_rows_on_wire>(std::move(current_rows)));
@@ -2513,12 +2696,14 @@ future<> repair_service::init_ms_handlers() {
     ser::repair_rpc_verbs::register_repair_row_level_start(&ms, [this] (const rpc::client_info& cinfo, uint32_t repair_meta_id, sstring ks_name,
             sstring cf_name, dht::token_range range, row_level_diff_detect_algorithm algo, uint64_t max_row_buf_size, uint64_t seed,
             unsigned remote_shard, unsigned remote_shard_count, unsigned remote_ignore_msb, sstring remote_partitioner_name, table_schema_version schema_version,
-            rpc::optional<streaming::stream_reason> reason, rpc::optional<gc_clock::time_point> compaction_time, rpc::optional<shard_id> dst_cpu_id_opt) {
+            rpc::optional<streaming::stream_reason> reason, rpc::optional<gc_clock::time_point> compaction_time, rpc::optional<shard_id> dst_cpu_id_opt,
+            rpc::optional<bool> incremental_opt) {
         auto src_cpu_id = cinfo.retrieve_auxiliary<uint32_t>("src_cpu_id");
         auto shard = get_dst_shard_id(src_cpu_id, dst_cpu_id_opt);
         auto from_id = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
+        bool incremental = incremental_opt.value_or(false);
         return container().invoke_on(shard, [from_id, src_cpu_id, repair_meta_id, ks_name, cf_name,
-                range, algo, max_row_buf_size, seed, remote_shard, remote_shard_count, remote_ignore_msb, schema_version, reason, compaction_time, this] (repair_service& local_repair) mutable {
+                range, algo, max_row_buf_size, seed, remote_shard, remote_shard_count, remote_ignore_msb, schema_version, reason, compaction_time, incremental, this] (repair_service& local_repair) mutable {
             if (!local_repair._view_builder.local_is_initialized()) {
                 return make_exception_future<repair_row_level_start_response>(std::runtime_error(format("Node {} is not fully initialized for repair, try again later",
                         local_repair.my_host_id())));
@@ -2528,17 +2713,18 @@ future<> repair_service::init_ms_handlers() {
             return repair_meta::repair_row_level_start_handler(local_repair, from_id, src_cpu_id, repair_meta_id, std::move(ks_name),
                     std::move(cf_name), std::move(range), algo, max_row_buf_size, seed,
                     shard_config{remote_shard, remote_shard_count, remote_ignore_msb},
-                    schema_version, r, ct, _repair_module->abort_source());
+                    schema_version, r, ct, incremental, _repair_module->abort_source());
         });
     });
     ser::repair_rpc_verbs::register_repair_row_level_stop(&ms, [this] (const rpc::client_info& cinfo, uint32_t repair_meta_id,
-            sstring ks_name, sstring cf_name, dht::token_range range, rpc::optional<shard_id> dst_cpu_id_opt) {
+            sstring ks_name, sstring cf_name, dht::token_range range, rpc::optional<shard_id> dst_cpu_id_opt, rpc::optional<bool> mark_repaired_opt) {
         auto src_cpu_id = cinfo.retrieve_auxiliary<uint32_t>("src_cpu_id");
         auto shard = get_dst_shard_id(src_cpu_id, dst_cpu_id_opt);
         auto from = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
-        return container().invoke_on(shard, [from, repair_meta_id, ks_name, cf_name, range] (repair_service& local_repair) mutable {
+        bool mark_repaired = mark_repaired_opt.value_or(false);
+        return container().invoke_on(shard, [from, repair_meta_id, ks_name, cf_name, range, mark_repaired] (repair_service& local_repair) mutable {
             return repair_meta::repair_row_level_stop_handler(local_repair, from, repair_meta_id,
-                    std::move(ks_name), std::move(cf_name), std::move(range));
+                    std::move(ks_name), std::move(cf_name), std::move(range), mark_repaired);
         });
     });
     ser::repair_rpc_verbs::register_repair_get_estimated_partitions(&ms, [this] (const rpc::client_info& cinfo, uint32_t repair_meta_id, rpc::optional<shard_id> dst_cpu_id_opt) {
@@ -3046,6 +3232,14 @@ class row_level_repair {
 
             auto compaction_time = gc_clock::now();
 
+            // Marking the data as repaired is correct only if all the replicas
+            // took part in the repair, since repaired data isn't compared again.
+            bool incremental = _is_tablet
+                    && _shard_task.reason() == streaming::stream_reason::repair
+                    && _shard_task.total_rf == _all_live_peer_nodes.size() + 1
+                    && _shard_task.db.local().get_config().enable_incremental_repair()
+                    && _shard_task.db.local().features().incremental_repair;
+
             repair_meta master(_shard_task.rs,
                     _shard_task.db.local().find_column_family(_table_id),
                     s,
@@ -3062,7 +3256,8 @@ class row_level_repair {
                     _all_live_peer_nodes.size(),
                     _all_live_peer_shards,
                     this,
-                    compaction_time);
+                    compaction_time,
+                    incremental);
             auto auto_stop_master = defer([&master] {
                 try {
                     master.stop().get();
@@ -3072,8 +3267,8 @@ class row_level_repair {
                 }
             });
 
-            rlogger.debug(">>> Started Row Level Repair (Master): local={}, peers={}, repair_meta_id={}, keyspace={}, cf={}, schema_version={}, range={}, seed={}, max_row_buf_size={}",
-                    master.myhostid(), _all_live_peer_nodes, master.repair_meta_id(), _shard_task.get_keyspace(), _cf_name, schema_version, _range, _seed, max_row_buf_size);
+            rlogger.debug(">>> Started Row Level Repair (Master): local={}, peers={}, repair_meta_id={}, keyspace={}, cf={}, schema_version={}, range={}, seed={}, max_row_buf_size={}, incremental={}",
+                    master.myhostid(), _all_live_peer_nodes, master.repair_meta_id(), _shard_task.get_keyspace(), _cf_name, schema_version, _range, _seed, max_row_buf_size, incremental);
 
             std::exception_ptr ex = nullptr;
             std::vector<repair_node_state> nodes_to_stop;
@@ -3150,7 +3345,7 @@ class row_level_repair {
             parallel_for_each(nodes_to_stop, coroutine::lambda([&] (repair_node_state& ns) -> future<> {
                 auto node = ns.node;
                 master.set_repair_state(repair_state::row_level_stop_started, node);
-                co_await master.repair_row_level_stop(node, _shard_task.get_keyspace(), _cf_name, _range, ns.shard);
+                co_await master.repair_row_level_stop(node, _shard_task.get_keyspace(), _cf_name, _range, ns.shard, incremental && !_failed);
                 master.set_repair_state(repair_state::row_level_stop_finished, node);
             })).get();
 
@@ -3389,6 +3584,7 @@ repair_service::insert_repair_meta(
         table_schema_version schema_version,
         streaming::stream_reason reason,
         gc_clock::time_point compaction_time,
+        bool incremental,
         abort_source& as) {
     schema_ptr s = co_await get_migration_manager().get_schema_for_write(schema_version, from_id, src_cpu_id, get_messaging(), as);
     auto& db = get_db();
@@ -3407,7 +3603,8 @@ repair_service::insert_repair_meta(
             reason,
             std::move(master_node_shard_config),
             host_id_vector_replica_set{from_id},
-            compaction_time);
+            compaction_time,
+            incremental);
     rm->set_repair_state_for_local_node(repair_state::row_level_start_started);
     bool insertion = repair_meta_map().emplace(id, rm).second;
     if (!insertion) {
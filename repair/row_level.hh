@@ -17,6 +17,7 @@
 #include "locator/abstract_replication_strategy.hh"
 #include <seastar/core/distributed.hh>
 #include <seastar/util/bool_class.hh>
+#include <seastar/util/noncopyable_function.hh>
 #include "utils/user_provided_param.hh"
 #include "locator/tablet_metadata_guard.hh"
 
@@ -242,6 +243,7 @@ class repair_service : public seastar::peering_sharded_service<repair_service> {
             table_schema_version schema_version,
             streaming::stream_reason reason,
             gc_clock::time_point compaction_time,
+            bool incremental,
             abort_source& as);
 
     future<>
@@ -276,4 +278,23 @@ future<> repair_cf_range_row_level(repair::shard_repair_task_impl& shard_task,
 future<std::list<repair_row>> to_repair_rows_list(repair_rows_on_wire rows,
         schema_ptr s, uint64_t seed, repair_master is_master,
         reader_permit permit, repair_hasher hasher);
+
+// With send_full_set_rpc_stream_compressed, the rows are sent over the RPC
+// streams in batches of about this size, serialized and compressed with LZ4.
+// Compressing a batch takes advantage of what its rows have in common, e.g.
+// the partition key and the clustering key prefixes, which is lost when each
+// partition is sent (and compressed by the connection, if at all) on its own.
+constexpr size_t compressed_rows_batch_size = 64 * 1024;
+// The largest batch, once decompressed. A batch is sent once it exceeds
+// compressed_rows_batch_size, so it's less than compressed_rows_batch_size
+// plus a mutation fragment and a partition key, both smaller than that.
+constexpr size_t max_compressed_rows_batch_size = 4 * compressed_rows_batch_size;
+
+// Sends the rows to `sink`, followed by end_of_current_rows. With `compress`,
+// the rows are sent in compressed batches, except for mutation fragments too
+// large to be batched, which are sent on their own.
+future<> send_rows_on_wire(noncopyable_function<future<> (const repair_row_on_wire_with_cmd&)> sink, repair_rows_on_wire rows, bool compress);
+// Reads the rows of a batch sent with repair_stream_cmd::compressed_row_data.
+repair_rows_on_wire decompress_rows(const bytes& in);
+
 void flush_rows(schema_ptr s, std::list<repair_row>& rows, lw_shared_ptr<repair_writer>& writer, locator::effective_replication_map_ptr erm = {}, bool small_table_optimization = false, repair_meta* rm = nullptr);
@@ -8,6 +8,7 @@
 
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/rwlock.hh>
 
 #include "database_fwd.hh"
@@ -214,6 +215,13 @@ class storage_group {
     std::vector<compaction_group_ptr> _merging_groups;
     std::vector<compaction_group_ptr> _split_ready_groups;
     seastar::gate _async_gate;
+
+    // Running totals of the requests served by this tablet replica.
+    locator::tablet_load_stats _requests;
+    // The totals when the rates were last computed, see load_stats().
+    mutable locator::tablet_load_stats _sampled_requests;
+    mutable seastar::lowres_clock::time_point _sampled_at = seastar::lowres_clock::now();
+    mutable locator::tablet_load_stats _rates;
 private:
     bool splitting_mode() const {
         return !_split_ready_groups.empty();
@@ -241,6 +249,20 @@ class storage_group {
 
     uint64_t live_disk_space_used() const noexcept;
 
+    void account_read(uint64_t bytes) noexcept {
+        _requests.reads++;
+        _requests.read_bytes += bytes;
+    }
+    void account_write(uint64_t bytes) noexcept {
+        _requests.writes++;
+        _requests.write_bytes += bytes;
+    }
+    // Returns the rates of the requests served since the rates were last
+    // computed, which is done at most once per load_sample_interval, so the
+    // rates don't depend on how often they are asked for.
+    locator::tablet_load_stats load_stats() const noexcept;
+    static constexpr auto load_sample_interval = std::chrono::seconds(10);
+
     void for_each_compaction_group(std::function<void(const compaction_group_ptr&)> action) const noexcept;
     utils::small_vector<compaction_group_ptr, 3> compaction_groups() noexcept;
     utils::small_vector<const_compaction_group_ptr, 3> compaction_groups() const noexcept;
@@ -367,6 +389,11 @@ class storage_group_manager {
     virtual storage_group& storage_group_for_token(dht::token) const = 0;
 
     virtual locator::table_load_stats table_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)> tablet_filter) const noexcept = 0;
+    virtual void tablet_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)> tablet_filter,
+                                   std::unordered_map<locator::global_tablet_id, locator::tablet_load_stats>& stats) const = 0;
+    // Returns the storage group of the tablet owning the token, to which requests for the token
+    // are accounted. Returns nullptr if the table doesn't use tablets or the tablet has no storage here.
+    virtual storage_group* maybe_storage_group_for_token(dht::token) const noexcept = 0;
     virtual bool all_storage_groups_split() = 0;
     virtual future<> split_all_storage_groups(tasks::task_info tablet_split_task_info) = 0;
     virtual future<> maybe_split_compaction_group_of(size_t idx) = 0;
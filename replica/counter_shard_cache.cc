@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include "replica/counter_shard_cache.hh"
+
+#include <boost/container_hash/hash.hpp>
+
+#include "mutation/frozen_mutation.hh"
+
+namespace replica {
+
+// Approximations, the point is to bound the memory used by the cache.
+size_t counter_shard_cache::memory_usage_of(const partition_id& id) {
+    return sizeof(partitions_type::value_type) + id.key.size();
+}
+
+size_t counter_shard_cache::memory_usage_of(const cell_id& id) {
+    return sizeof(std::pair<const cell_id, local_shard>) + 2 * sizeof(void*) + (id.clustering_key ? id.clustering_key->size() : 0);
+}
+
+size_t counter_shard_cache::partition_id_hash::operator()(const partition_id& id) const noexcept {
+    size_t h = std::hash<table_id>()(id.table);
+    boost::hash_combine(h, std::hash<bytes_view>()(id.key));
+    return h;
+}
+
+size_t counter_shard_cache::cell_id_hash::operator()(const cell_id& id) const noexcept {
+    size_t h = std::hash<column_id>()(id.column);
+    if (id.clustering_key) {
+        boost::hash_combine(h, std::hash<bytes_view>()(*id.clustering_key));
+    }
+    return h;
+}
+
+counter_shard_cache::counter_shard_cache(size_t max_memory)
+    : _max_memory(max_memory)
+{ }
+
+void counter_shard_cache::erase(partitions_type::iterator it) {
+    _stats.memory_usage -= it->second.memory_usage;
+    --_stats.population;
+    _partitions.erase(it);
+}
+
+void counter_shard_cache::evict() {
+    while (_stats.memory_usage > _max_memory && !_lru.empty()) {
+        auto& e = _lru.front();
+        _lru.pop_front();
+        erase(_partitions.find(*e.id));
+        ++_stats.evictions;
+    }
+}
+
+void counter_shard_cache::touch(partition_entry& e) {
+    e.lru_link.unlink();
+    _lru.push_back(e);
+}
+
+// Calls func(cell_id, kind, atomic_cell_view) for the live cells of m.
+template <typename Func>
+static void for_each_live_cell(const mutation& m, Func&& func) {
+    const auto& s = *m.schema();
+    auto for_each_in_row = [&] (std::optional<bytes> ck, column_kind kind, const auto& cells) {
+        cells.for_each_cell([&] (column_id id, const atomic_cell_or_collection& ac_o_c) {
+            auto acv = ac_o_c.as_atomic_cell(s.column_at(kind, id));
+            if (acv.is_live()) {
+                func(ck, id, kind, acv);
+            }
+        });
+    };
+    for_each_in_row(std::nullopt, column_kind::static_column, m.partition().static_row());
+    for (const auto& cr : m.partition().clustered_rows()) {
+        for_each_in_row(to_bytes(cr.key().representation()), column_kind::regular_column, cr.row().cells());
+    }
+}
+
+std::optional<mutation> counter_shard_cache::lookup(const mutation& m, counter_id local_id, uint64_t& generation) {
+    ++_stats.lookups;
+    auto [it, inserted] = _partitions.try_emplace(partition_id{m.schema()->id(), to_bytes(m.key().representation())});
+    auto& e = it->second;
+    if (inserted) {
+        e.id = &it->first;
+        e.generation = _next_generation++;
+        e.schema_version = m.schema()->version();
+        e.memory_usage = memory_usage_of(it->first);
+        _stats.memory_usage += e.memory_usage;
+        ++_stats.population;
+    } else if (e.schema_version != m.schema()->version()) {
+        // The cells will be cached again by this update, with the new schema.
+        _stats.memory_usage -= e.memory_usage - memory_usage_of(it->first);
+        e.memory_usage = memory_usage_of(it->first);
+        e.cells.clear();
+        e.schema_version = m.schema()->version();
+    }
+    touch(e);
+    generation = e.generation;
+
+    mutation current(m.schema(), m.decorated_key());
+    bool hit = true;
+    for_each_live_cell(m, [&] (const std::optional<bytes>& ck, column_id id, column_kind kind, atomic_cell_view acv) {
+        if (!hit) {
+            return;
+        }
+        auto cell = e.cells.find(cell_id{ck, id});
+        if (cell == e.cells.end()) {
+            hit = false;
+            return;
+        }
+        auto& cdef = m.schema()->column_at(kind, id);
+        auto cs = counter_shard(local_id, cell->second.value, cell->second.logical_clock);
+        auto ac = counter_cell_builder::from_single_shard(acv.timestamp(), cs);
+        if (kind == column_kind::static_column) {
+            current.set_static_cell(cdef, std::move(ac));
+        } else {
+            current.set_clustered_cell(clustering_key::from_bytes(*ck), cdef, std::move(ac));
+        }
+    });
+    if (inserted) {
+        evict();
+    }
+    if (!hit) {
+        return std::nullopt;
+    }
+    ++_stats.hits;
+    return current;
+}
+
+void counter_shard_cache::insert(const mutation& m, counter_id local_id, uint64_t generation) {
+    auto it = _partitions.find(partition_id{m.schema()->id(), to_bytes(m.key().representation())});
+    if (it == _partitions.end() || it->second.generation != generation || it->second.schema_version != m.schema()->version()) {
+        return;
+    }
+    auto& e = it->second;
+    for_each_live_cell(m, [&] (const std::optional<bytes>& ck, column_id id, column_kind, atomic_cell_view acv) {
+        auto cs = counter_cell_view(acv).get_shard(local_id);
+        if (!cs) {
+            return;
+        }
+        auto [cell, inserted] = e.cells.try_emplace(cell_id{ck, id});
+        if (inserted) {
+            e.memory_usage += memory_usage_of(cell->first);
+            _stats.memory_usage += memory_usage_of(cell->first);
+        }
+        cell->second = local_shard{cs->value(), cs->logical_clock()};
+    });
+    touch(e);
+    evict();
+}
+
+void counter_shard_cache::invalidate(table_id table, const partition_key& key) {
+    if (_partitions.empty()) {
+        return;
+    }
+    auto it = _partitions.find(partition_id{table, to_bytes(key.representation())});
+    if (it == _partitions.end()) {
+        return;
+    }
+    // Updates which looked the partition up before will see a different
+    // generation, so they won't insert the shards they computed.
+    ++_stats.invalidations;
+    erase(it);
+}
+
+void counter_shard_cache::invalidate(table_id table) {
+    for (auto it = _partitions.begin(); it != _partitions.end();) {
+        if (it->first.table == table) {
+            ++_stats.invalidations;
+            erase(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+static bool deletes_data(const mutation& m) {
+    const auto& s = *m.schema();
+    const auto& p = m.partition();
+    if (p.partition_tombstone() || !p.row_tombstones().empty()) {
+        return true;
+    }
+    bool has_dead_cells = false;
+    auto check_cells = [&] (column_kind kind, const auto& cells) {
+        cells.for_each_cell([&] (column_id id, const atomic_cell_or_collection& ac_o_c) {
+            if (!ac_o_c.as_atomic_cell(s.column_at(kind, id)).is_live()) {
+                has_dead_cells = true;
+            }
+        });
+    };
+    check_cells(column_kind::static_column, p.static_row());
+    for (const auto& cr : p.clustered_rows()) {
+        if (cr.row().deleted_at()) {
+            return true;
+        }
+        check_cells(column_kind::regular_column, cr.row().cells());
+    }
+    return has_dead_cells;
+}
+
+void counter_shard_cache::on_write(const schema& s, const frozen_mutation& m) {
+    if (_partitions.empty() || !_partitions.contains(partition_id{s.id(), to_bytes(m.key().representation())})) {
+        return;
+    }
+    on_write(m.unfreeze(s.shared_from_this()));
+}
+
+void counter_shard_cache::on_write(const mutation& m) {
+    if (_partitions.empty() || !deletes_data(m)) {
+        return;
+    }
+    invalidate(m.schema()->id(), m.key());
+}
+
+} // namespace replica
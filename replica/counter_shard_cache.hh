@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <boost/intrusive/list.hpp>
+
+#include "bytes.hh"
+#include "counters.hh"
+#include "keys.hh"
+#include "mutation/mutation.hh"
+#include "schema/schema_fwd.hh"
+
+class frozen_mutation;
+
+namespace replica {
+
+/// Caches the local shards (value and logical clock) of recently updated
+/// counter cells, so that counter updates of these cells are transformed
+/// to shards without reading the current state of the counters first.
+///
+/// The local shard of a counter cell is only ever changed by counter
+/// updates led by this node, and these are serialized by the counter cell
+/// locks. An update caches the shards it wrote after applying them, so the
+/// cached shard is always the latest one, and stays valid regardless of
+/// what happens to the memtable it went to (e.g. a flush). The exceptions
+/// are deletions of counters, and truncation, which drop the counters from
+/// the read-before-write path:
+/// - writes which aren't counter updates drop the partition, if it is
+///   cached and they carry tombstones, see on_write(). This must be called
+///   right after the write is applied to the memtable, without deferring
+///   in between.
+/// - truncating or dropping a table drops all of its partitions.
+///
+/// Cached shards are tied to the schema version they were cached with,
+/// since column ids change with the schema.
+class counter_shard_cache {
+public:
+    struct stats {
+        // Counter updates which looked up the cache, and those of them
+        // which found the local shards of all of their cells.
+        uint64_t lookups = 0;
+        uint64_t hits = 0;
+        // The number of partitions dropped due to a deletion or truncation.
+        uint64_t invalidations = 0;
+        // The number of partitions evicted to stay within the memory limit.
+        uint64_t evictions = 0;
+        // The number of partitions currently tracked by the cache.
+        uint64_t population = 0;
+        uint64_t memory_usage = 0;
+    };
+private:
+    struct partition_id {
+        table_id table;
+        bytes key;
+
+        bool operator==(const partition_id&) const = default;
+    };
+
+    struct partition_id_hash {
+        size_t operator()(const partition_id& id) const noexcept;
+    };
+
+    struct cell_id {
+        // Static cells have no clustering key.
+        std::optional<bytes> clustering_key;
+        column_id column;
+
+        bool operator==(const cell_id&) const = default;
+    };
+
+    struct cell_id_hash {
+        size_t operator()(const cell_id& id) const noexcept;
+    };
+
+    struct local_shard {
+        int64_t value;
+        int64_t logical_clock;
+    };
+
+    struct partition_entry {
+        boost::intrusive::list_member_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>> lru_link;
+        // The key of this entry in _partitions.
+        const partition_id* id = nullptr;
+        // Changes whenever the partition is invalidated.
+        uint64_t generation;
+        table_schema_version schema_version;
+        size_t memory_usage = 0;
+        std::unordered_map<cell_id, local_shard, cell_id_hash> cells;
+    };
+
+    using partitions_type = std::unordered_map<partition_id, partition_entry, partition_id_hash>;
+    using lru_type = boost::intrusive::list<partition_entry,
+        boost::intrusive::member_hook<partition_entry, decltype(partition_entry::lru_link), &partition_entry::lru_link>,
+        boost::intrusive::constant_time_size<false>>;
+
+    size_t _max_memory;
+    partitions_type _partitions;
+    // Least recently used partitions first.
+    lru_type _lru;
+    uint64_t _next_generation = 0;
+    stats _stats;
+
+    static size_t memory_usage_of(const partition_id& id);
+    static size_t memory_usage_of(const cell_id& id);
+
+    void erase(partitions_type::iterator it);
+    void evict();
+    void touch(partition_entry& e);
+public:
+    // A cache with max_memory == 0 is disabled.
+    explicit counter_shard_cache(size_t max_memory);
+
+    counter_shard_cache(const counter_shard_cache&) = delete;
+    counter_shard_cache& operator=(const counter_shard_cache&) = delete;
+
+    bool enabled() const {
+        return _max_memory != 0;
+    }
+
+    /// Returns the current state of the counter cells updated by `m`, as a
+    /// mutation with the local shards of these cells, or std::nullopt if any
+    /// of them is not cached. `generation` is set to the value which has to
+    /// be passed to insert() once the update is applied.
+    std::optional<mutation> lookup(const mutation& m, counter_id local_id, uint64_t& generation);
+
+    /// Caches the local shards of the counter cells of `m`, a counter update
+    /// transformed to shards and applied. Nothing is cached if the partition
+    /// was invalidated since the lookup, which returned `generation`.
+    void insert(const mutation& m, counter_id local_id, uint64_t generation);
+
+    /// Drops the cached shards of the partition.
+    void invalidate(table_id table, const partition_key& key);
+
+    /// Drops the cached shards of all partitions of the table.
+    void invalidate(table_id table);
+
+    /// Called for the writes to counter tables. Drops the cached shards of
+    /// the partition if the write deletes any data.
+    void on_write(const schema& s, const frozen_mutation& m);
+    void on_write(const mutation& m);
+
+    const stats& get_stats() const {
+        return _stats;
+    }
+};
+
+} // namespace replica
@@ -408,6 +408,9 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
     , _querier_cache([this] (const reader_concurrency_semaphore& s) {
         return this->is_user_semaphore(s);
     })
+    , _query_result_cache(std::make_unique<query_result_cache>(size_t(_cfg.query_result_cache_size_in_mb()) << 20,
+              size_t(_cfg.query_result_cache_max_result_size_in_kb()) << 10))
+    , _counter_shard_cache(std::make_unique<counter_shard_cache>(size_t(_cfg.counter_cache_size_in_mb()) << 20))
     , _large_data_handler(std::make_unique<db::cql_table_large_data_handler>(feat,
               _cfg.compaction_large_partition_warning_threshold_mb,
               _cfg.compaction_large_row_warning_threshold_mb,
@@ -628,6 +631,45 @@ database::setup_metrics() {
         sm::make_gauge("querier_cache_population", _querier_cache.get_stats().population,
                        sm::description("The number of entries currently in the querier cache.")),
 
+        sm::make_counter("query_result_cache_lookups", _query_result_cache->get_stats().lookups,
+                       sm::description("Counts query result cache lookups (single partition reads)")),
+
+        sm::make_counter("query_result_cache_hits", _query_result_cache->get_stats().hits,
+                       sm::description("Counts single partition reads which were served from the query result cache")),
+
+        sm::make_counter("query_result_cache_inserts", _query_result_cache->get_stats().inserts,
+                       sm::description("Counts read results inserted into the query result cache")),
+
+        sm::make_counter("query_result_cache_invalidations", _query_result_cache->get_stats().invalidations,
+                       sm::description("Counts partitions whose cached read results were dropped because they were written to")),
+
+        sm::make_counter("query_result_cache_evictions", _query_result_cache->get_stats().evictions,
+                       sm::description("Counts partitions evicted from the query result cache to stay within its memory limit")),
+
+        sm::make_gauge("query_result_cache_population", _query_result_cache->get_stats().population,
+                       sm::description("The number of partitions currently tracked by the query result cache.")),
+
+        sm::make_current_bytes("query_result_cache_memory_usage", _query_result_cache->get_stats().memory_usage,
+                       sm::description("The memory used by the query result cache.")),
+
+        sm::make_counter("counter_shard_cache_lookups", _counter_shard_cache->get_stats().lookups,
+                       sm::description("Counts counter updates which looked up the counter shard cache")),
+
+        sm::make_counter("counter_shard_cache_hits", _counter_shard_cache->get_stats().hits,
+                       sm::description("Counts counter updates which skipped the read of the current counter state thanks to the counter shard cache")),
+
+        sm::make_counter("counter_shard_cache_invalidations", _counter_shard_cache->get_stats().invalidations,
+                       sm::description("Counts partitions whose cached counter shards were dropped because of a deletion or truncation")),
+
+        sm::make_counter("counter_shard_cache_evictions", _counter_shard_cache->get_stats().evictions,
+                       sm::description("Counts partitions evicted from the counter shard cache to stay within its memory limit")),
+
+        sm::make_gauge("counter_shard_cache_population", _counter_shard_cache->get_stats().population,
+                       sm::description("The number of partitions currently tracked by the counter shard cache.")),
+
+        sm::make_current_bytes("counter_shard_cache_memory_usage", _counter_shard_cache->get_stats().memory_usage,
+                       sm::description("The memory used by the counter shard cache.")),
+
     });
 
     // Registering all the metrics with a single call causes the stack size to blow up.
@@ -1026,6 +1068,7 @@ future<> database::detach_column_family(table& cf) {
     co_await remove(cf);
     cf.clear_views();
     co_await cf.await_pending_ops();
+    _counter_shard_cache->invalidate(uuid);
     co_await foreach_reader_concurrency_semaphore([uuid] (reader_concurrency_semaphore& sem) -> future<> {
         co_await sem.evict_inactive_reads_for_table(uuid);
     });
@@ -1300,6 +1343,10 @@ keyspace::make_column_family_config(const schema& s, const database& db) const {
     cfg.tombstone_warn_threshold = db_config.tombstone_warn_threshold();
     cfg.view_update_concurrency_semaphore_limit = _config.view_update_concurrency_semaphore_limit;
     cfg.data_listeners = &db.data_listeners();
+    cfg.query_result_cache = &db.get_query_result_cache();
+    if (s.is_counter()) {
+        cfg.counter_shard_cache = &db.get_counter_shard_cache();
+    }
     cfg.enable_compacting_data_for_streaming_and_repair = db_config.enable_compacting_data_for_streaming_and_repair;
     cfg.enable_tombstone_gc_for_streaming_and_repair = db_config.enable_tombstone_gc_for_streaming_and_repair;
 
@@ -1515,6 +1562,37 @@ database::query(schema_ptr query_schema, const query::read_command& cmd, query::
     auto& semaphore = get_reader_concurrency_semaphore();
     auto max_result_size = cmd.max_result_size ? *cmd.max_result_size : get_query_max_result_size();
 
+    // Reads of a single partition, which don't continue a paged read, can be
+    // served from the query result cache, provided the row cache is not
+    // being updated.
+    std::optional<query_result_cache::read_signature> cached_read;
+    std::optional<partition_key> cached_key;
+    uint64_t cached_generation = 0;
+    if (_query_result_cache->enabled()
+            && opts.request == query::result_request::only_result
+            && !(cmd.query_uuid && !cmd.is_first_page)
+            && ranges.size() == 1
+            && ranges.front().is_singular()
+            && ranges.front().start()->value().has_key()
+            && cf.cache_enabled()
+            && !cf.is_virtual()) {
+        if (auto phase = cf.get_row_cache().stable_phase()) {
+            cached_key = ranges.front().start()->value().key();
+            cached_read.emplace(query_result_cache::read_signature{
+                .schema_version = query_schema->version(),
+                .slice = query_result_cache::serialize_slice(cmd.slice),
+                .row_limit = cmd.get_row_limit(),
+                .partition_limit = cmd.partition_limit,
+                .max_result_size = max_result_size,
+                .phase = *phase,
+            });
+            if (auto cached = _query_result_cache->lookup(cf.schema()->id(), *cached_key, *cached_read, cmd.timestamp, cached_generation)) {
+                ++semaphore.get_stats().total_successful_reads;
+                co_return std::tuple(std::move(cached), cf.get_global_cache_hit_rate());
+            }
+        }
+    }
+
     std::optional<query::querier> querier_opt;
     lw_shared_ptr<query::result> result;
     std::exception_ptr ex;
@@ -1562,6 +1640,13 @@ database::query(schema_ptr query_schema, const query::read_command& cmd, query::
         co_return coroutine::exception(std::move(ex));
     }
 
+    // If the row cache was updated while the read was running, the result
+    // may reflect either phase.
+    if (cached_read && !result->is_short_read() && cf.get_row_cache().stable_phase() == cached_read->phase) {
+        _query_result_cache->insert(cf.schema()->id(), *cached_key, std::move(*cached_read), cmd.timestamp,
+                cf.may_have_expiring_data(ranges.front()), *result, cached_generation);
+    }
+
     auto hit_rate = cf.get_global_cache_hit_rate();
     ++semaphore.get_stats().total_successful_reads;
     _stats->short_data_queries += bool(result->is_short_read());
@@ -1739,18 +1824,38 @@ future<mutation> database::do_apply_counter_update(column_family& cf, const froz
 
     // Before counter update is applied it needs to be transformed from
     // deltas to counter shards. To do that, we need to read the current
-    // counter state for each modified cell...
+    // counter state for each modified cell, unless our shards of all of
+    // them are cached...
 
-    tracing::trace(trace_state, "Reading counter values from the CF");
-    auto permit = get_reader_concurrency_semaphore().make_tracking_only_permit(cf.schema(), "counter-read-before-write", timeout, trace_state);
-    auto mopt = co_await counter_write_query(cf.schema(), cf.as_mutation_source(), std::move(permit), m.decorated_key(), slice, trace_state);
+    auto local_id = counter_id(get_token_metadata().get_my_id().uuid());
+    uint64_t cached_generation = 0;
+    std::optional<mutation> mopt;
+    if (_counter_shard_cache->enabled()) {
+        mopt = _counter_shard_cache->lookup(m, local_id, cached_generation);
+    }
+    if (mopt) {
+        tracing::trace(trace_state, "Found counter shards in the cache");
+    } else {
+        tracing::trace(trace_state, "Reading counter values from the CF");
+        auto permit = get_reader_concurrency_semaphore().make_tracking_only_permit(cf.schema(), "counter-read-before-write", timeout, trace_state);
+        mopt = co_await counter_write_query(cf.schema(), cf.as_mutation_source(), std::move(permit), m.decorated_key(), slice, trace_state);
+    }
 
     // ...now, that we got existing state of all affected counter
     // cells we can look for our shard in each of them, increment
     // its clock and apply the delta.
     transform_counter_updates_to_shards(m, mopt ? &*mopt : nullptr, cf.failed_counter_applies_to_memtable(), get_token_metadata().get_my_id());
     tracing::trace(trace_state, "Applying counter update");
-    co_await apply_with_commitlog(cf, m, timeout);
+    auto f = co_await coroutine::as_future(apply_with_commitlog(cf, m, timeout));
+    if (f.failed()) {
+        _counter_shard_cache->invalidate(cf.schema()->id(), m.key());
+        co_await coroutine::return_exception_ptr(f.get_exception());
+    }
+    if (_counter_shard_cache->enabled()) {
+        // The counter cell locks are still held, so the shards we wrote are
+        // the latest ones.
+        _counter_shard_cache->insert(m, local_id, cached_generation);
+    }
 
     if (utils::get_local_injector().enter("apply_counter_update_delay_5s")) {
         co_await seastar::sleep(std::chrono::seconds(5));
@@ -2596,6 +2701,7 @@ future<> database::truncate(db::system_keyspace& sys_ks, column_family& cf, cons
     // TODO: notify truncation
 
     db::replay_position rp = co_await cf.discard_sstables(truncated_at);
+    _counter_shard_cache->invalidate(uuid);
     // TODO: indexes.
     // Note: since discard_sstables was changed to only count tables owned by this shard,
     // we can get zero rp back. Changed SCYLLA_ASSERT, and ensure we save at least low_mark.
@@ -51,6 +51,8 @@
 #include "reader_concurrency_semaphore_group.hh"
 #include "db/timeout_clock.hh"
 #include "querier.hh"
+#include "replica/query_result_cache.hh"
+#include "replica/counter_shard_cache.hh"
 #include "cache_temperature.hh"
 #include <unordered_set>
 #include "utils/error_injection.hh"
@@ -422,6 +424,9 @@ class table : public enable_lw_shared_from_this<table>
         bool enable_node_aggregated_table_metrics = true;
         size_t view_update_concurrency_semaphore_limit;
         db::data_listeners* data_listeners = nullptr;
+        replica::query_result_cache* query_result_cache = nullptr;
+        // Set for counter tables only.
+        replica::counter_shard_cache* counter_shard_cache = nullptr;
         uint32_t tombstone_warn_threshold{0};
         unsigned x_log2_compaction_groups{0};
         utils::updateable_value<bool> enable_compacting_data_for_streaming_and_repair;
@@ -447,6 +452,11 @@ class table : public enable_lw_shared_from_this<table>
 
     template<typename... Args>
     void do_apply(compaction_group& cg, db::rp_handle&&, Args&&... args);
+    // Drops the results of reads of the partition cached by the database.
+    void invalidate_cached_results(const partition_key& key);
+    // Account a request to the load stats of the tablet owning the token.
+    void account_tablet_read(dht::token token, uint64_t bytes) noexcept;
+    void account_tablet_write(dht::token token, uint64_t bytes) noexcept;
 
     lw_shared_ptr<memtable_list> make_memory_only_memtable_list();
     lw_shared_ptr<memtable_list> make_memtable_list(compaction_group& cg);
@@ -774,10 +784,12 @@ class table : public enable_lw_shared_from_this<table>
             const dht::partition_range_vector& ranges, gc_clock::time_point compaction_time) const;
 
     // Single range overload.
+    // Only the sstables matching the predicate are read. It must outlive the reader.
     mutation_reader make_streaming_reader(schema_ptr schema, reader_permit permit, const dht::partition_range& range,
             const query::partition_slice& slice,
             mutation_reader::forwarding fwd_mr,
-            gc_clock::time_point compaction_time) const;
+            gc_clock::time_point compaction_time,
+            const sstables::sstable_predicate& predicate = sstables::default_sstable_predicate()) const;
 
     mutation_reader make_streaming_reader(schema_ptr schema, reader_permit permit, const dht::partition_range& range, gc_clock::time_point compaction_time) {
         return make_streaming_reader(schema, std::move(permit), range, schema->full_slice(), mutation_reader::forwarding::no, compaction_time);
@@ -813,6 +825,10 @@ class table : public enable_lw_shared_from_this<table>
         _virtual_writer.emplace(std::move(writer));
     }
 
+    bool is_virtual() const {
+        return bool(_virtual_reader);
+    }
+
     // Queries can be satisfied from multiple data sources, so they are returned
     // as temporaries.
     //
@@ -1010,6 +1026,10 @@ class table : public enable_lw_shared_from_this<table>
     lw_shared_ptr<const sstable_list> get_sstables() const;
     lw_shared_ptr<const sstable_list> get_sstables_including_compacted_undeleted() const;
     std::vector<sstables::shared_sstable> select_sstables(const dht::partition_range& range) const;
+    // Returns whether the memtables or sstables which may contain the singular
+    // range have expiring cells or row markers. If not, the result of a read
+    // of the range doesn't depend on the query time.
+    bool may_have_expiring_data(const dht::partition_range& range) const;
     size_t sstables_count() const;
     std::vector<uint64_t> sstable_count_per_level() const;
     int64_t get_unleveled_sstables() const;
@@ -1052,6 +1072,9 @@ class table : public enable_lw_shared_from_this<table>
     // The tablet filter is used to not double account migrating tablets, so it's important that
     // only one of pending or leaving replica is accounted based on current migration stage.
     locator::table_load_stats table_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)> tablet_filter) const noexcept;
+    // Adds the rates of requests served by the tablet replicas of this table on this shard to stats.
+    void tablet_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)> tablet_filter,
+                           std::unordered_map<locator::global_tablet_id, locator::tablet_load_stats>& stats) const;
 
     const db::view::stats& get_view_stats() const {
         return _view_stats;
@@ -1528,6 +1551,8 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
     bool _shutdown = false;
     bool _enable_autocompaction_toggle = false;
     query::querier_cache _querier_cache;
+    std::unique_ptr<query_result_cache> _query_result_cache;
+    std::unique_ptr<counter_shard_cache> _counter_shard_cache;
 
     std::unique_ptr<db::large_data_handler> _large_data_handler;
     std::unique_ptr<db::large_data_handler> _nop_large_data_handler;
@@ -1892,6 +1917,14 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
         return _querier_cache;
     }
 
+    query_result_cache& get_query_result_cache() const {
+        return *_query_result_cache;
+    }
+
+    counter_shard_cache& get_counter_shard_cache() const {
+        return *_counter_shard_cache;
+    }
+
     db::view::update_backlog get_view_update_backlog() const {
         return {max_memory_pending_view_updates() - _view_update_concurrency_sem.current(), max_memory_pending_view_updates()};
     }
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include "replica/query_result_cache.hh"
+
+#include <boost/container_hash/hash.hpp>
+
+#include "idl/read_command.dist.hh"
+#include "idl/read_command.dist.impl.hh"
+
+namespace replica {
+
+namespace {
+
+query::result copy_result(const query::result& r) {
+    return query::result(bytes_ostream(r.buf()), r.is_short_read(), r.row_count_low_bits(), r.partition_count(),
+            r.row_count_high_bits(), r.last_position());
+}
+
+} // anonymous namespace
+
+// Approximations, the point is to bound the memory used by the cache.
+size_t query_result_cache::memory_usage_of(const partition_id& id) {
+    return sizeof(partitions_type::value_type) + id.key.size();
+}
+
+size_t query_result_cache::memory_usage_of(const cached_result& r) {
+    return sizeof(cached_result) + r.signature.slice.size() + r.result.buf().size();
+}
+
+size_t query_result_cache::partition_id_hash::operator()(const partition_id& id) const noexcept {
+    size_t h = std::hash<table_id>()(id.table);
+    boost::hash_combine(h, std::hash<bytes_view>()(id.key));
+    return h;
+}
+
+bytes query_result_cache::serialize_slice(const query::partition_slice& slice) {
+    return ser::serialize_to_buffer<bytes>(slice);
+}
+
+query_result_cache::query_result_cache(size_t max_memory, size_t max_result_size)
+    : _max_memory(max_memory)
+    , _max_result_size(max_result_size)
+{ }
+
+void query_result_cache::erase(partitions_type::iterator it) {
+    _stats.memory_usage -= it->second.memory_usage;
+    --_stats.population;
+    _partitions.erase(it);
+}
+
+void query_result_cache::evict() {
+    while (_stats.memory_usage > _max_memory && !_lru.empty()) {
+        auto& e = _lru.front();
+        _lru.pop_front();
+        erase(_partitions.find(*e.id));
+        ++_stats.evictions;
+    }
+}
+
+void query_result_cache::touch(partition_entry& e) {
+    e.lru_link.unlink();
+    _lru.push_back(e);
+}
+
+lw_shared_ptr<query::result> query_result_cache::lookup(table_id table, const partition_key& key, const read_signature& signature,
+        gc_clock::time_point query_time, uint64_t& generation) {
+    ++_stats.lookups;
+    auto [it, inserted] = _partitions.try_emplace(partition_id{table, to_bytes(key.representation())});
+    auto& e = it->second;
+    if (inserted) {
+        e.id = &it->first;
+        e.generation = _next_generation++;
+        e.memory_usage = memory_usage_of(it->first);
+        _stats.memory_usage += e.memory_usage;
+        ++_stats.population;
+    }
+    ++e.reads;
+    touch(e);
+    for (const auto& r : e.results) {
+        if (r.signature == signature && r.valid_at(query_time)) {
+            ++_stats.hits;
+            return make_lw_shared<query::result>(copy_result(r.result));
+        }
+    }
+    generation = e.generation;
+    if (inserted) {
+        evict();
+    }
+    return nullptr;
+}
+
+void query_result_cache::insert(table_id table, const partition_key& key, read_signature signature, gc_clock::time_point query_time, bool may_expire,
+        const query::result& result, uint64_t generation) {
+    if (result.buf().size() > _max_result_size) {
+        return;
+    }
+    auto it = _partitions.find(partition_id{table, to_bytes(key.representation())});
+    // Only admit partitions which were read more than once.
+    if (it == _partitions.end() || it->second.generation != generation || it->second.reads < 2) {
+        return;
+    }
+    auto& e = it->second;
+    // Results of an older phase, or of reads of expiring data at an earlier
+    // time, will never be hit again.
+    std::erase_if(e.results, [&] (const cached_result& r) {
+        if (r.signature.phase < signature.phase || (r.query_time && *r.query_time < query_time)) {
+            e.memory_usage -= memory_usage_of(r);
+            _stats.memory_usage -= memory_usage_of(r);
+            return true;
+        }
+        return false;
+    });
+    // A concurrent read of the same data may have inserted it already.
+    bool cached = std::ranges::any_of(e.results, [&] (const cached_result& r) {
+        return r.signature == signature && r.valid_at(query_time);
+    });
+    if (cached || e.results.size() >= max_results_per_partition) {
+        return;
+    }
+    auto time = may_expire ? std::make_optional(query_time) : std::nullopt;
+    auto& r = e.results.emplace_back(cached_result{std::move(signature), time, copy_result(result)});
+    e.memory_usage += memory_usage_of(r);
+    _stats.memory_usage += memory_usage_of(r);
+    ++_stats.inserts;
+    touch(e);
+    evict();
+}
+
+void query_result_cache::invalidate(table_id table, const partition_key& key) {
+    if (_partitions.empty()) {
+        return;
+    }
+    auto it = _partitions.find(partition_id{table, to_bytes(key.representation())});
+    if (it == _partitions.end()) {
+        return;
+    }
+    // Reads which started before the write will see a different generation
+    // once the partition is looked up again, so they won't insert their
+    // possibly stale results.
+    ++_stats.invalidations;
+    erase(it);
+}
+
+} // namespace replica
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <unordered_map>
+#include <boost/intrusive/list.hpp>
+
+#include "bytes.hh"
+#include "gc_clock.hh"
+#include "keys.hh"
+#include "query-request.hh"
+#include "query-result.hh"
+#include "schema/schema_fwd.hh"
+#include "utils/phased_barrier.hh"
+
+namespace replica {
+
+/// Caches the serialized results of reads of small, frequently read
+/// partitions, so that repeated identical reads of a hot partition are
+/// answered without running the read path at all.
+///
+/// A result is cached for a read_signature, which captures everything the
+/// result depends on, besides the data: the schema version, the slice and
+/// the limits. The query time isn't part of it, as the result of a read of
+/// data which doesn't expire doesn't depend on it. If the data may contain
+/// expiring cells or row markers, the result is only valid for reads at the
+/// query time it was computed at. The query time has the resolution of
+/// gc_clock, which is also the resolution of TTL expiry.
+///
+/// The data is versioned in two ways:
+/// - writes of a partition drop the cached results of that partition, see
+///   invalidate(). This must be called right after the write is applied to
+///   the memtable, without deferring in between.
+/// - other changes to the data of a table (e.g. sstables added by streaming,
+///   truncation) go through the row cache, and change its population phase.
+///   The phase is part of the signature.
+///
+/// To keep partitions which are read only once from evicting the hot ones,
+/// results are only admitted on the second read of a partition.
+class query_result_cache {
+public:
+    using phase_type = utils::phased_barrier::phase_type;
+
+    struct read_signature {
+        table_schema_version schema_version;
+        // The serialized partition_slice.
+        bytes slice;
+        uint64_t row_limit;
+        uint32_t partition_limit;
+        query::max_result_size max_result_size;
+        phase_type phase;
+
+        bool operator==(const read_signature&) const = default;
+    };
+
+    struct stats {
+        uint64_t lookups = 0;
+        uint64_t hits = 0;
+        uint64_t inserts = 0;
+        // The number of partitions whose results were dropped due to a write.
+        uint64_t invalidations = 0;
+        // The number of partitions evicted to stay within the memory limit.
+        uint64_t evictions = 0;
+        // The number of partitions currently tracked by the cache.
+        uint64_t population = 0;
+        uint64_t memory_usage = 0;
+    };
+
+    // A partition can have results of at most this many reads cached.
+    static constexpr size_t max_results_per_partition = 4;
+private:
+    struct partition_id {
+        table_id table;
+        bytes key;
+
+        bool operator==(const partition_id&) const = default;
+    };
+
+    struct partition_id_hash {
+        size_t operator()(const partition_id& id) const noexcept;
+    };
+
+    struct cached_result {
+        read_signature signature;
+        // Set if the data read may expire, the result is then only valid
+        // for reads at this query time.
+        std::optional<gc_clock::time_point> query_time;
+        query::result result;
+
+        bool valid_at(gc_clock::time_point t) const {
+            return !query_time || *query_time == t;
+        }
+    };
+
+    struct partition_entry {
+        boost::intrusive::list_member_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>> lru_link;
+        // The key of this entry in _partitions.
+        const partition_id* id = nullptr;
+        // Changes whenever the partition is written to.
+        uint64_t generation;
+        uint64_t reads = 0;
+        size_t memory_usage = 0;
+        std::vector<cached_result> results;
+    };
+
+    using partitions_type = std::unordered_map<partition_id, partition_entry, partition_id_hash>;
+    using lru_type = boost::intrusive::list<partition_entry,
+        boost::intrusive::member_hook<partition_entry, decltype(partition_entry::lru_link), &partition_entry::lru_link>,
+        boost::intrusive::constant_time_size<false>>;
+
+    size_t _max_memory;
+    size_t _max_result_size;
+    partitions_type _partitions;
+    // Least recently used partitions first.
+    lru_type _lru;
+    uint64_t _next_generation = 0;
+    stats _stats;
+
+    static size_t memory_usage_of(const partition_id& id);
+    static size_t memory_usage_of(const cached_result& r);
+
+    void erase(partitions_type::iterator it);
+    void evict();
+    void touch(partition_entry& e);
+public:
+    // A cache with max_memory == 0 is disabled.
+    query_result_cache(size_t max_memory, size_t max_result_size);
+
+    query_result_cache(const query_result_cache&) = delete;
+    query_result_cache& operator=(const query_result_cache&) = delete;
+
+    bool enabled() const {
+        return _max_memory != 0;
+    }
+
+    /// Serializes the slice of a read, for read_signature::slice.
+    static bytes serialize_slice(const query::partition_slice& slice);
+
+    /// Returns a copy of the result of the read at `query_time`, or nullptr
+    /// if it is not cached. On a miss, `generation` is set to the value which
+    /// has to be passed to insert() once the read completes.
+    lw_shared_ptr<query::result> lookup(table_id table, const partition_key& key, const read_signature& signature,
+            gc_clock::time_point query_time, uint64_t& generation);
+
+    /// Caches the result of a read at `query_time` which missed the cache.
+    /// If `may_expire` is set, the data read may contain expiring cells or row
+    /// markers, and the result is only hit by reads at the same query time.
+    /// The result is dropped if the partition was written to since the
+    /// lookup, which returned `generation`.
+    void insert(table_id table, const partition_key& key, read_signature signature, gc_clock::time_point query_time, bool may_expire,
+            const query::result& result, uint64_t generation);
+
+    /// Drops the cached results of the partition.
+    void invalidate(table_id table, const partition_key& key);
+
+    const stats& get_stats() const {
+        return _stats;
+    }
+};
+
+} // namespace replica
@@ -317,7 +317,8 @@ table::make_streaming_reader(schema_ptr s, reader_permit permit,
 }
 
 mutation_reader table::make_streaming_reader(schema_ptr schema, reader_permit permit, const dht::partition_range& range,
-        const query::partition_slice& slice, mutation_reader::forwarding fwd_mr, gc_clock::time_point compaction_time) const {
+        const query::partition_slice& slice, mutation_reader::forwarding fwd_mr, gc_clock::time_point compaction_time,
+        const sstables::sstable_predicate& predicate) const {
     auto trace_state = tracing::trace_state_ptr();
     const auto fwd = streamed_mutation::forwarding::no;
 
@@ -325,7 +326,7 @@ mutation_reader table::make_streaming_reader(schema_ptr schema, reader_permit pe
     add_memtables_to_reader_list(readers, schema, permit, range, slice, trace_state, fwd, fwd_mr, [&] (size_t memtable_count) {
         readers.reserve(memtable_count + 1);
     });
-    readers.emplace_back(make_sstable_reader(schema, permit, _sstables, range, slice, std::move(trace_state), fwd, fwd_mr));
+    readers.emplace_back(make_sstable_reader(schema, permit, _sstables, range, slice, std::move(trace_state), fwd, fwd_mr, predicate));
     return maybe_compact_for_streaming(
             make_combined_reader(std::move(schema), std::move(permit), std::move(readers), fwd, fwd_mr),
             get_compaction_manager(),
@@ -723,6 +724,12 @@ class single_storage_group_manager final : public storage_group_manager {
             .split_ready_seq_number = std::numeric_limits<locator::resize_decision::seq_number_t>::min()
         };
     }
+    void tablet_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)>,
+                           std::unordered_map<locator::global_tablet_id, locator::tablet_load_stats>&) const override {
+    }
+    storage_group* maybe_storage_group_for_token(dht::token) const noexcept override {
+        return nullptr;
+    }
     bool all_storage_groups_split() override { return true; }
     future<> split_all_storage_groups(tasks::task_info tablet_split_task_info) override { return make_ready_future(); }
     future<> maybe_split_compaction_group_of(size_t idx) override { return make_ready_future(); }
@@ -856,6 +863,11 @@ class tablet_storage_group_manager final : public storage_group_manager {
     }
 
     locator::table_load_stats table_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)> tablet_filter) const noexcept override;
+    void tablet_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)> tablet_filter,
+                           std::unordered_map<locator::global_tablet_id, locator::tablet_load_stats>& stats) const override;
+    storage_group* maybe_storage_group_for_token(dht::token token) const noexcept override {
+        return maybe_storage_group_for_id(schema(), tablet_id_for_token(token));
+    }
     bool all_storage_groups_split() override;
     future<> split_all_storage_groups(tasks::task_info tablet_split_task_info) override;
     future<> maybe_split_compaction_group_of(size_t idx) override;
@@ -1310,6 +1322,10 @@ table::do_add_sstable_and_update_cache(compaction_group& cg, sstables::shared_ss
             add_maintenance_sstable(cg, sst);
         }
         update_stats_for_new_sstable(sst);
+        // The sstable may delete counters, e.g. if it comes from repair.
+        if (_config.counter_shard_cache) {
+            _config.counter_shard_cache->invalidate(_schema->id());
+        }
         if (trigger_compaction) {
             try_trigger_compaction(cg);
         }
@@ -1820,6 +1836,26 @@ uint64_t storage_group::live_disk_space_used() const noexcept {
     return std::ranges::fold_left(cgs | std::views::transform(std::mem_fn(&compaction_group::live_disk_space_used)), uint64_t(0), std::plus{});
 }
 
+locator::tablet_load_stats storage_group::load_stats() const noexcept {
+    auto now = lowres_clock::now();
+    if (now - _sampled_at < load_sample_interval) {
+        return _rates;
+    }
+    auto elapsed = std::chrono::duration<double>(now - _sampled_at).count();
+    auto rate = [elapsed] (uint64_t current, uint64_t sampled) {
+        return uint64_t((current - sampled) / elapsed);
+    };
+    _rates = locator::tablet_load_stats{
+        .reads = rate(_requests.reads, _sampled_requests.reads),
+        .writes = rate(_requests.writes, _sampled_requests.writes),
+        .read_bytes = rate(_requests.read_bytes, _sampled_requests.read_bytes),
+        .write_bytes = rate(_requests.write_bytes, _sampled_requests.write_bytes),
+    };
+    _sampled_requests = _requests;
+    _sampled_at = now;
+    return _rates;
+}
+
 uint64_t compaction_group::total_disk_space_used() const noexcept {
     return live_disk_space_used() + std::ranges::fold_left(_sstables_compacted_but_not_deleted | std::views::transform(std::mem_fn(&sstables::sstable::bytes_on_disk)), uint64_t(0), std::plus{});
 }
@@ -2231,6 +2267,21 @@ std::vector<sstables::shared_sstable> table::select_sstables(const dht::partitio
     return _sstables->select(range);
 }
 
+bool table::may_have_expiring_data(const dht::partition_range& range) const {
+    // The TTLs of expiring cells and row markers (and of dead row markers)
+    // are tracked in the encoding stats of memtables, which default to the
+    // maximal duration, and in the stats metadata of sstables, which
+    // defaults to 0.
+    auto& cg = compaction_group_for_token(range.start()->value().token());
+    if (std::ranges::any_of(*cg.memtables(), [] (const shared_memtable& m) { return m->get_encoding_stats().min_ttl != gc_clock::duration::max(); })) {
+        return true;
+    }
+    return std::ranges::any_of(select_sstables(range), [] (const sstables::shared_sstable& sst) {
+        // Older formats don't track the TTLs.
+        return sst->get_version() < sstables::sstable_version_types::mc || sst->get_stats_metadata().max_ttl != 0;
+    });
+}
+
 bool storage_group::no_compacted_sstable_undeleted() const {
     return std::ranges::all_of(compaction_groups(), [] (const_compaction_group_ptr& cg) {
         return cg->compacted_undeleted_sstables().empty();
@@ -2488,10 +2539,41 @@ locator::table_load_stats tablet_storage_group_manager::table_load_stats(std::fu
     return stats;
 }
 
+void tablet_storage_group_manager::tablet_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)> tablet_filter,
+                                                     std::unordered_map<locator::global_tablet_id, locator::tablet_load_stats>& stats) const {
+    for_each_storage_group([&] (size_t id, storage_group& sg) {
+        locator::global_tablet_id gid { _t.schema()->id(), locator::tablet_id(id) };
+        if (!tablet_filter(*_tablet_map, gid)) {
+            return;
+        }
+        // Idle tablets are left out, to keep the stats small.
+        if (auto tablet_stats = sg.load_stats(); tablet_stats.load() > 0) {
+            stats.emplace(gid, tablet_stats);
+        }
+    });
+}
+
 locator::table_load_stats table::table_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)> tablet_filter) const noexcept {
     return _sg_manager->table_load_stats(std::move(tablet_filter));
 }
 
+void table::tablet_load_stats(std::function<bool(const locator::tablet_map&, locator::global_tablet_id)> tablet_filter,
+                              std::unordered_map<locator::global_tablet_id, locator::tablet_load_stats>& stats) const {
+    _sg_manager->tablet_load_stats(std::move(tablet_filter), stats);
+}
+
+void table::account_tablet_read(dht::token token, uint64_t bytes) noexcept {
+    if (auto* sg = _sg_manager->maybe_storage_group_for_token(token)) {
+        sg->account_read(bytes);
+    }
+}
+
+void table::account_tablet_write(dht::token token, uint64_t bytes) noexcept {
+    if (auto* sg = _sg_manager->maybe_storage_group_for_token(token)) {
+        sg->account_write(bytes);
+    }
+}
+
 void tablet_storage_group_manager::handle_tablet_split_completion(const locator::tablet_map& old_tmap, const locator::tablet_map& new_tmap) {
     auto table_id = schema()->id();
     size_t old_tablet_count = old_tmap.tablet_count();
@@ -3420,11 +3502,26 @@ void table::do_apply(compaction_group& cg, db::rp_handle&& h, Args&&... args) {
     _stats.writes.mark(lc);
 }
 
+void table::invalidate_cached_results(const partition_key& key) {
+    if (_config.query_result_cache) {
+        _config.query_result_cache->invalidate(_schema->id(), key);
+    }
+}
+
 future<> table::apply(const mutation& m, db::rp_handle&& h, db::timeout_clock::time_point timeout) {
     auto& cg = compaction_group_for_token(m.token());
     auto holder = cg.async_gate().hold();
     return dirty_memory_region_group().run_when_memory_available([this, &m, h = std::move(h), &cg, holder = std::move(holder)] () mutable {
         do_apply(cg, std::move(h), m);
+        if (uses_tablets()) {
+            // Account the size the write has on the wire, as the frozen_mutation
+            // overload does, rather than its footprint in memory.
+            account_tablet_write(m.token(), freeze(m).representation().size());
+        }
+        invalidate_cached_results(m.key());
+        if (_config.counter_shard_cache) {
+            _config.counter_shard_cache->on_write(m);
+        }
     }, timeout);
 }
 
@@ -3440,6 +3537,13 @@ future<> table::apply(const frozen_mutation& m, schema_ptr m_schema, db::rp_hand
 
     return dirty_memory_region_group().run_when_memory_available([this, &m, m_schema = std::move(m_schema), h = std::move(h), &cg, holder = std::move(holder)]() mutable {
         do_apply(cg, std::move(h), m, m_schema);
+        if (uses_tablets()) {
+            account_tablet_write(dht::get_token(*m_schema, m.key()), m.representation().size());
+        }
+        invalidate_cached_results(m.key());
+        if (_config.counter_shard_cache) {
+            _config.counter_shard_cache->on_write(*m_schema, m);
+        }
     }, timeout);
 }
 
@@ -3550,7 +3654,14 @@ table::query(schema_ptr query_schema,
         *saved_querier = std::move(querier_opt);
     }
 
-    co_return make_lw_shared<query::result>(qs.builder.build(std::move(last_pos)));
+    auto result = make_lw_shared<query::result>(qs.builder.build(std::move(last_pos)));
+    // Reads of tables using tablets don't cross tablet boundaries, so the read is accounted
+    // to the tablet owning the start of the first range.
+    if (uses_tablets() && !partition_ranges.empty()) {
+        auto& first_range = partition_ranges.front();
+        account_tablet_read(first_range.start() ? first_range.start()->value().token() : dht::minimum_token(), result->buf().size());
+    }
+    co_return result;
 }
 
 future<reconcilable_result>
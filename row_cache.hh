@@ -459,6 +459,17 @@ class row_cache final {
     future<> invalidate(external_updater, const dht::partition_range& = query::full_partition_range);
     future<> invalidate(external_updater, dht::partition_range_vector&&);
 
+    // Returns the population phase, or std::nullopt while an update() or
+    // invalidate() is in progress. Each of them changes the phase, so a read
+    // which observes the same phase before and after it ran didn't race with
+    // any change of the underlying mutation source.
+    std::optional<phase_type> stable_phase() const noexcept {
+        if (_prev_snapshot) {
+            return std::nullopt;
+        }
+        return _underlying_phase;
+    }
+
     // Evicts entries from cache.
     //
     // Note that this does not synchronize with the underlying source,
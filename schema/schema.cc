@@ -980,6 +980,12 @@ sstring schema::get_create_statement(const schema_describe_helper& helper, bool
                     << cql3::util::maybe_quote(ks_name()) << "." << cql3::util::maybe_quote(view_info()->base_name());
 
             describe_index_columns(os, is_local, *this, helper.find_schema(view_info()->base_id()));
+            auto included_columns = regular_columns() | std::views::filter([] (const column_definition& cdef) {
+                return !cdef.is_view_virtual();
+            }) | std::views::transform(std::mem_fn(&column_definition::name_as_cql_string));
+            if (!std::ranges::empty(included_columns)) {
+                os << " INCLUDE (" << fmt::to_string(fmt::join(included_columns, ", ")) << ")";
+            }
             os << ";\n";
 
             return std::move(os).str();
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+#include "db/per_partition_rate_limit_info.hh"
+#include "inet_address_vectors.hh"
+#include "mutation/frozen_mutation.hh"
+#include "service/topology_state_machine.hh"
+#include "tracing/tracing.hh"
+
+namespace service {
+
+// A write sent to a replica in a MUTATION_BATCH, together with other writes
+// of the same coordinator shard. Carries the same information as a single
+// MUTATION, and is acknowledged separately, with MUTATION_DONE or
+// MUTATION_FAILED for its response_id.
+struct batched_mutation {
+    frozen_mutation fm;
+    unsigned shard;
+    uint64_t response_id;
+    std::optional<tracing::trace_info> trace_info;
+    db::per_partition_rate_limit::info rate_limit_info;
+    fencing_token fence;
+    // The time left until the timeout of the write, when the batch was sent.
+    std::chrono::milliseconds timeout;
+};
+
+} // namespace service
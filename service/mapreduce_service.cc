@@ -14,9 +14,13 @@
 #include <seastar/coroutine/parallel_for_each.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/smp.hh>
+#include <span>
 #include <stdexcept>
+#include <unordered_map>
 
+#include "db/config.hh"
 #include "db/consistency_level.hh"
+#include "db/marshal/type_parser.hh"
 #include "dht/sharder.hh"
 #include "gms/gossiper.hh"
 #include "idl/mapreduce_request.dist.hh"
@@ -54,10 +58,55 @@ static logging::logger flogger("forward_service"); // not "mapreduce", for compa
 
 static std::vector<::shared_ptr<db::functions::aggregate_function>> get_functions(const query::mapreduce_request& request);
 
+// Hashes and compares the GROUP BY prefix of rows of a grouped
+// mapreduce_result, so that partial results can be merged by group key.
+struct group_key_hash {
+    size_t operator()(std::span<const bytes_opt> key) const {
+        size_t h = 0;
+        for (const auto& v : key) {
+            h = h * 31 + (v ? std::hash<bytes_view>()(*v) : 0);
+        }
+        return h;
+    }
+};
+
+struct group_key_equal {
+    bool operator()(std::span<const bytes_opt> a, std::span<const bytes_opt> b) const {
+        return std::ranges::equal(a, b);
+    }
+};
+
+static void mark_group_limit_exceeded(query::mapreduce_result& result) {
+    result.grouped_query_results = std::nullopt;
+    result.group_limit_exceeded = true;
+}
+
+// The number of groups above which a grouped request gives up.
+static size_t get_max_groups(const replica::database& db, const query::mapreduce_request& req) {
+    size_t max_groups = db.get_config().parallelized_group_by_max_groups();
+    if (req.max_groups) {
+        max_groups = std::min<size_t>(max_groups, *req.max_groups);
+    }
+    return max_groups;
+}
+
+static void enforce_group_limit(query::mapreduce_result& result, size_t max_groups) {
+    if (result.grouped_query_results && result.grouped_query_results->size() > max_groups) {
+        mark_group_limit_exceeded(result);
+    }
+}
+
 class mapreduce_aggregates {
 private:
     std::vector<::shared_ptr<db::functions::aggregate_function>> _funcs;
     std::vector<db::functions::stateless_aggregate_function> _aggrs;
+    // Number of GROUP BY columns prefixing each grouped result row, 0 if the
+    // request isn't grouped.
+    size_t _group_by_size = 0;
+    bool _grouped = false;
+
+    void merge_grouped(query::mapreduce_result& result, query::mapreduce_result&& other);
+    void finalize_grouped(query::mapreduce_result& result);
 public:
     mapreduce_aggregates(const query::mapreduce_request& request);
     void merge(query::mapreduce_result& result, query::mapreduce_result&& other);
@@ -87,9 +136,65 @@ mapreduce_aggregates::mapreduce_aggregates(const query::mapreduce_request& reque
         aggrs.push_back(func->get_aggregate());
     }
     _aggrs = std::move(aggrs);
+    _grouped = request.is_grouped();
+    _group_by_size = _grouped ? request.group_by_column_names->size() : 0;
+}
+
+void mapreduce_aggregates::merge_grouped(query::mapreduce_result& result, query::mapreduce_result&& other) {
+    if (result.group_limit_exceeded || other.group_limit_exceeded) {
+        mark_group_limit_exceeded(result);
+        return;
+    }
+    if (!result.grouped_query_results) {
+        result.grouped_query_results = std::move(other.grouped_query_results);
+        return;
+    } else if (!other.grouped_query_results) {
+        return;
+    }
+
+    auto& rows = *result.grouped_query_results;
+    const size_t row_size = _group_by_size + _aggrs.size();
+    auto group_key = [this] (const std::vector<bytes_opt>& row) {
+        return std::span<const bytes_opt>(row.data(), _group_by_size);
+    };
+
+    // Spans point into the rows' own buffers, which stay put when `rows`
+    // reallocates, so the index remains valid while new groups are appended.
+    std::unordered_map<std::span<const bytes_opt>, size_t, group_key_hash, group_key_equal> index;
+    index.reserve(rows.size() + other.grouped_query_results->size());
+    for (size_t i = 0; i < rows.size(); i++) {
+        index.emplace(group_key(rows[i]), i);
+    }
+
+    for (auto& row : *other.grouped_query_results) {
+        if (row.size() != row_size) {
+            on_internal_error(
+                flogger,
+                format("mapreduce_aggregates::merge_grouped(): operation cannot be completed due to invalid row size. "
+                        "expected: {} "
+                        "row.size(): {} ",
+                        row_size, row.size())
+            );
+        }
+        auto it = index.find(group_key(row));
+        if (it == index.end()) {
+            rows.push_back(std::move(row));
+            index.emplace(group_key(rows.back()), rows.size() - 1);
+            continue;
+        }
+        auto& target = rows[it->second];
+        for (size_t i = 0; i < _aggrs.size(); i++) {
+            auto& state = target[_group_by_size + i];
+            state = _aggrs[i].state_reduction_function->execute(std::vector({std::move(state), std::move(row[_group_by_size + i])}));
+        }
+    }
 }
 
 void mapreduce_aggregates::merge(query::mapreduce_result &result, query::mapreduce_result&& other) {
+    if (_grouped) {
+        merge_grouped(result, std::move(other));
+        return;
+    }
     if (result.query_results.empty()) {
         result.query_results = std::move(other.query_results);
         return;
@@ -113,7 +218,31 @@ void mapreduce_aggregates::merge(query::mapreduce_result &result, query::mapredu
     }
 }
 
+void mapreduce_aggregates::finalize_grouped(query::mapreduce_result& result) {
+    if (result.group_limit_exceeded) {
+        return;
+    }
+    if (!result.grouped_query_results) {
+        // No groups at all; unlike ungrouped aggregation, an empty GROUP BY
+        // query yields no rows.
+        result.grouped_query_results.emplace();
+        return;
+    }
+    for (auto& row : *result.grouped_query_results) {
+        for (size_t i = 0; i < _aggrs.size(); i++) {
+            auto& state = row[_group_by_size + i];
+            if (_aggrs[i].state_to_result_function) {
+                state = _aggrs[i].state_to_result_function->execute(std::vector({std::move(state)}));
+            }
+        }
+    }
+}
+
 void mapreduce_aggregates::finalize(query::mapreduce_result &result) {
+    if (_grouped) {
+        finalize_grouped(result);
+        return;
+    }
     if (result.query_results.empty()) {
         // An empty result means that we didn't send the aggregation request
         // to any node. I.e., it was a query that matched no partition, such
@@ -174,7 +303,10 @@ static std::vector<::shared_ptr<db::functions::aggregate_function>> get_function
         } else {
             auto& info = request.aggregation_infos.value()[i];
             auto types = info.column_names | std::views::transform(name_as_type) | std::ranges::to<std::vector<data_type>>();
-            
+            for (const auto& constant : info.constant_arguments) {
+                types.push_back(db::marshal::type_parser::parse(constant.type_name));
+            }
+
             auto func = cql3::functions::instance().mock_get(info.name, types);
             if (!func) {
                 throw std::runtime_error(format("Cannot mock aggregate function {}", info.name));    
@@ -319,18 +451,27 @@ static shared_ptr<cql3::selection::selection> mock_selection(
 
     auto functions = get_functions(request);
 
+    auto name_as_expression = [] (const sstring& name) -> cql3::expr::expression {
+        constexpr bool keep_case = true;
+        return cql3::expr::unresolved_identifier {
+            make_shared<cql3::column_identifier_raw>(name, keep_case)
+        };
+    };
+
+    // GROUP BY columns come first, so that each result row starts with its
+    // group key.
+    if (request.is_grouped()) {
+        for (const auto& name : *request.group_by_column_names) {
+            auto prepared_expr = cql3::expr::prepare_expression(name_as_expression(name), db.as_data_dictionary(), "", schema.get(), nullptr);
+            prepared_selectors.emplace_back(cql3::selection::prepared_selector{std::move(prepared_expr), make_shared<cql3::column_identifier>(name, true)});
+        }
+    }
+
     auto mock_singular_selection = [&] (
         const ::shared_ptr<db::functions::aggregate_function>& aggr_function,
         const query::mapreduce_request::reduction_type& reduction,
         const std::optional<query::mapreduce_request::aggregation_info>& info
     ) {
-        auto name_as_expression = [] (const sstring& name) -> cql3::expr::expression {
-            constexpr bool keep_case = true;
-            return cql3::expr::unresolved_identifier {
-                make_shared<cql3::column_identifier_raw>(name, keep_case)
-            };
-        };
-
         if (reduction == query::mapreduce_request::reduction_type::count) {
             auto count_expr = cql3::expr::function_call{
                 .func = cql3::functions::aggregate_fcts::make_count_rows_function(),
@@ -346,6 +487,11 @@ static shared_ptr<cql3::selection::selection> mock_selection(
 
         auto reducible_aggr = aggr_function->reducible_aggregate_function();
         auto arg_exprs = info->column_names | std::views::transform(name_as_expression) | std::ranges::to<std::vector<cql3::expr::expression>>();
+        for (const auto& constant : info->constant_arguments) {
+            arg_exprs.push_back(cql3::expr::constant(
+                    cql3::raw_value::make_value(constant.value),
+                    db::marshal::type_parser::parse(constant.type_name)));
+        }
         auto fc_expr = cql3::expr::function_call{reducible_aggr, arg_exprs};
         auto column_identifier = make_shared<cql3::column_identifier>(info->name.name, false);
         auto prepared_expr = cql3::expr::prepare_expression(fc_expr, db.as_data_dictionary(), "", schema.get(), nullptr);
@@ -376,10 +522,12 @@ future<query::mapreduce_result> mapreduce_service::dispatch_to_shards(
     auto results = co_await when_all_succeed(futures.begin(), futures.end());
 
     mapreduce_aggregates aggrs(req);
-    co_return co_await aggrs.with_thread_if_needed([&aggrs, req, results = std::move(results), result = std::move(result)] () mutable {
+    const size_t max_groups = get_max_groups(_db.local(), req);
+    co_return co_await aggrs.with_thread_if_needed([&aggrs, req, max_groups, results = std::move(results), result = std::move(result)] () mutable {
         for (auto&& r : results) {
             if (result) {
                 aggrs.merge(*result, std::move(r));
+                enforce_group_limit(*result, max_groups);
             }
             else {
                 result = r;
@@ -440,11 +588,25 @@ future<query::mapreduce_result> mapreduce_service::execute_on_this_shard(
         cql3::query_options::specific_options::DEFAULT
     );
 
+    std::vector<size_t> group_by_cell_indices;
+    if (req.is_grouped()) {
+        for (const auto& name : *req.group_by_column_names) {
+            auto def = schema->get_column_definition(to_bytes(name));
+            if (!def) {
+                throw std::runtime_error(format("Unknown GROUP BY column {}", name));
+            }
+            group_by_cell_indices.push_back(selection->index_of(*def));
+        }
+    }
+    const bool grouped = !group_by_cell_indices.empty();
+    const size_t max_groups = get_max_groups(_db.local(), req);
+    bool group_limit_exceeded = false;
+
     auto rs_builder = cql3::selection::result_set_builder(
         *selection,
         now,
         nullptr,
-        std::vector<size_t>() // Represents empty GROUP BY indices.
+        std::move(group_by_cell_indices)
     );
 
     // We serve up to 256 ranges at a time to avoid allocating a huge vector for ranges
@@ -490,14 +652,45 @@ future<query::mapreduce_result> mapreduce_service::execute_on_this_shard(
             }
 
             co_await pager->fetch_page(rs_builder, DEFAULT_INTERNAL_PAGING_SIZE, now, timeout);
+
+            // Bound the memory held by partial groups. The caller falls back
+            // to a regular paged query, so there's no point in going on.
+            if (grouped && rs_builder.result_set_size() > max_groups) {
+                group_limit_exceeded = true;
+                break;
+            }
         }
 
         ranges_owned_by_this_shard.clear();
-    } while (current_range);
+    } while (current_range && !group_limit_exceeded);
+
+    if (group_limit_exceeded) {
+        tracing::trace(tr_state, "On shard execution exceeded the limit of {} groups", max_groups);
+        flogger.debug("on shard execution exceeded the limit of {} groups", max_groups);
+        query::mapreduce_result res;
+        mark_group_limit_exceeded(res);
+        co_return res;
+    }
 
-    co_return co_await rs_builder.with_thread_if_needed([&req, &rs_builder, reductions = req.reduction_types, tr_state = std::move(tr_state)] {
+    co_return co_await rs_builder.with_thread_if_needed([&req, &rs_builder, grouped, reductions = req.reduction_types, tr_state = std::move(tr_state)] {
         auto rs = rs_builder.build();
         auto& rows = rs->rows();
+        if (grouped) {
+            const size_t row_size = req.group_by_column_names->size() + reductions.size();
+            query::mapreduce_result res;
+            auto& grouped_rows = res.grouped_query_results.emplace();
+            grouped_rows.reserve(rows.size());
+            for (const auto& row : rows) {
+                if (row.size() != row_size) {
+                    flogger.error("grouped aggregation result column count does not match requested column count");
+                    throw std::runtime_error("grouped aggregation result column count does not match requested column count");
+                }
+                grouped_rows.push_back(row | std::views::transform([] (const managed_bytes_opt& x) { return to_bytes_opt(x); }) | std::ranges::to<std::vector<bytes_opt>>());
+            }
+            tracing::trace(tr_state, "On shard execution produced {} groups", grouped_rows.size());
+            flogger.debug("on shard execution produced {} groups", grouped_rows.size());
+            return res;
+        }
         if (rows.size() != 1) {
             flogger.error("aggregation result row count != 1");
             throw std::runtime_error("aggregation result row count != 1");
@@ -573,6 +766,7 @@ future<query::mapreduce_result> mapreduce_service::dispatch(query::mapreduce_req
 
     retrying_dispatcher dispatcher(*this, tr_state);
     query::mapreduce_result result;
+    const size_t max_groups = get_max_groups(_db.local(), req);
 
     co_await coroutine::parallel_for_each(vnodes_per_addr,
             [&] (std::pair<const locator::host_id, dht::partition_range_vector>& vnodes_with_addr) -> future<> {
@@ -598,8 +792,9 @@ future<query::mapreduce_result> mapreduce_service::dispatch(query::mapreduce_req
         flogger.debug("received mapreduce_result={} from {}", partial_printer, addr);
 
         auto aggrs = mapreduce_aggregates(req);
-        co_return co_await aggrs.with_thread_if_needed([&result_, &aggrs, partial_result = std::move(partial_result)] () mutable {
+        co_return co_await aggrs.with_thread_if_needed([&result_, &aggrs, max_groups, partial_result = std::move(partial_result)] () mutable {
             aggrs.merge(result_, std::move(partial_result));
+            enforce_group_limit(result_, max_groups);
         });
     });
 
@@ -45,6 +45,14 @@ class storage_proxy;
 //   5. `dispatch` merges results from all coordinators and returns merged
 //      result.
 //
+// GROUP BY queries are supported when `group_by_column_names` is set. Each
+// shard then returns one row of partial aggregation states per group,
+// prefixed with the group's key, and coordinators merge partial results by
+// hashing group keys. The number of groups held in memory is bounded by the
+// `parallelized_group_by_max_groups` option; when it's exceeded, the result
+// is marked with `group_limit_exceeded` and the caller falls back to the
+// regular, paged algorithm.
+//
 // Splitting query into sub-queries in is implemented as:
 //   a. Partition ranges of the original query are split into a sequence of
 //      vnodes.
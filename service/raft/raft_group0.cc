@@ -27,6 +27,7 @@
 #include "gms/feature_service.hh"
 #include "db/system_keyspace.hh"
 #include "replica/database.hh"
+#include "db/config.hh"
 #include "utils/assert.hh"
 #include "utils/error_injection.hh"
 
@@ -246,6 +247,7 @@ raft_server_for_group raft_group0::create_server_for_group0(raft::group_id gid,
     auto& persistence_ref = *storage;
     auto* cl = qp.proxy().get_db().local().schema_commitlog();
     auto config = raft::server::configuration {
+        .max_in_flight_append_requests = qp.proxy().get_db().local().get_config().group0_raft_max_in_flight_append_requests(),
         .on_background_error = [gid, this](std::exception_ptr e) {
             _raft_gr.abort_server(gid, fmt::format("background error, {}", e));
             _status_for_monitoring = status_for_monitoring::aborted;
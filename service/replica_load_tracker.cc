@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <algorithm>
+#include <ranges>
+
+#include "service/replica_load_tracker.hh"
+#include "utils/small_vector.hh"
+
+namespace service {
+
+static double ewma(double average, double sample, bool has_average) noexcept {
+    return has_average ? average + replica_load_tracker::alpha * (sample - average) : sample;
+}
+
+replica_load replica_load_meter::on_read_finish(clock_type::duration service_time) noexcept {
+    --_in_flight;
+    auto us = std::chrono::duration<double, std::micro>(service_time).count();
+    _service_time_us = ewma(_service_time_us, us, _service_time_us != 0);
+    return replica_load{
+        .queue_length = _in_flight,
+        .service_time = std::chrono::microseconds(int64_t(_service_time_us)),
+    };
+}
+
+void replica_load_tracker::on_request(locator::host_id ep) {
+    ++_endpoints[ep].outstanding;
+}
+
+void replica_load_tracker::on_response(locator::host_id ep, std::chrono::steady_clock::duration response_time) {
+    auto& s = _endpoints[ep];
+    if (s.outstanding) {
+        --s.outstanding;
+    }
+    auto us = std::chrono::duration<double, std::micro>(response_time).count();
+    s.response_time_us = ewma(s.response_time_us, us, s.has_response);
+    s.has_response = true;
+    s.last_response = clock_type::now();
+}
+
+void replica_load_tracker::on_load_report(locator::host_id ep, const replica_load& load) {
+    auto& s = _endpoints[ep];
+    s.queue_length = ewma(s.queue_length, load.queue_length, s.has_load);
+    s.service_time_us = ewma(s.service_time_us, load.service_time.count(), s.has_load);
+    s.has_load = true;
+}
+
+void replica_load_tracker::on_failure(locator::host_id ep) {
+    auto it = _endpoints.find(ep);
+    if (it != _endpoints.end() && it->second.outstanding) {
+        --it->second.outstanding;
+    }
+}
+
+double replica_load_tracker::score(const endpoint_state& s) const noexcept {
+    if (!s.has_response) {
+        // Nothing is known about the replica yet. Prefer it, so that it
+        // gets to be measured.
+        return 0;
+    }
+    if (!s.has_load) {
+        auto q = 1.0 + s.outstanding;
+        return s.response_time_us * q * q * q;
+    }
+    auto q = 1.0 + s.outstanding + s.queue_length;
+    return std::max(s.response_time_us - s.service_time_us, 0.0) + q * q * q * s.service_time_us;
+}
+
+double replica_load_tracker::score(locator::host_id ep) const noexcept {
+    auto it = _endpoints.find(ep);
+    return it == _endpoints.end() ? 0 : score(it->second);
+}
+
+void replica_load_tracker::sort_by_score(std::span<locator::host_id> replicas) {
+    if (replicas.size() <= 1) {
+        return;
+    }
+    auto now = clock_type::now();
+    utils::small_vector<std::pair<double, locator::host_id>, 3> scored;
+    for (auto ep : replicas) {
+        auto it = _endpoints.find(ep);
+        if (it != _endpoints.end() && it->second.has_response && now - it->second.last_response > forget_after) {
+            if (it->second.outstanding) {
+                it->second = endpoint_state{.outstanding = it->second.outstanding};
+            } else {
+                _endpoints.erase(it);
+                it = _endpoints.end();
+            }
+        }
+        scored.emplace_back(it == _endpoints.end() ? 0 : score(it->second), ep);
+    }
+    std::ranges::stable_sort(scored, std::less<>(), [] (const auto& p) { return p.first; });
+    std::ranges::copy(scored | std::views::values, replicas.begin());
+}
+
+} // namespace service
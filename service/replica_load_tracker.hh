@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <span>
+#include <unordered_map>
+
+#include <seastar/core/lowres_clock.hh>
+
+#include "locator/host_id.hh"
+
+namespace service {
+
+// The load of a replica, as reported by it in the responses to reads.
+struct replica_load {
+    // The number of reads the replica was handling when it responded.
+    uint32_t queue_length = 0;
+    // The (moving average of the) time the replica takes to handle a read.
+    std::chrono::microseconds service_time = std::chrono::microseconds(0);
+};
+
+// Measures the load of the reads handled by a shard for its coordinators,
+// see replica_load.
+class replica_load_meter {
+public:
+    using clock_type = std::chrono::steady_clock;
+private:
+    uint32_t _in_flight = 0;
+    double _service_time_us = 0;
+public:
+    void on_read_start() noexcept {
+        ++_in_flight;
+    }
+    // Returns the load reported in the response to the finished read.
+    replica_load on_read_finish(clock_type::duration service_time) noexcept;
+};
+
+// Ranks the replicas of a read by their predicted response time, so that
+// the coordinator routes reads away from the replicas which are slow, or
+// are about to become slow because of their queues.
+//
+// The prediction follows C3: for each replica the coordinator keeps moving
+// averages of the response time R it observes, and of the queue length q
+// and service time s reported by the replica. The replica is scored with
+//
+//   R - s + (1 + os + q)^3 * s
+//
+// where os is the number of reads the coordinator (shard) has outstanding
+// to the replica. The cubic term makes a replica with a long queue much
+// less attractive than a slightly slower replica with a short one, and
+// the os term reacts to the load the coordinator itself is adding before
+// the replica gets to report it. Replicas which don't report their load
+// (older versions) are scored with R * (1 + os)^3.
+//
+// Replicas which weren't heard from for a while are forgotten, and score
+// like unknown replicas, so that a replica which was slow gets probed
+// again instead of being avoided forever.
+class replica_load_tracker {
+public:
+    using clock_type = seastar::lowres_clock;
+    // The weight of a new sample in the moving averages.
+    static constexpr double alpha = 0.2;
+    static constexpr std::chrono::seconds forget_after = std::chrono::seconds(2);
+private:
+    struct endpoint_state {
+        uint32_t outstanding = 0;
+        // The moving averages are valid only once a response was received.
+        bool has_response = false;
+        bool has_load = false;
+        double response_time_us = 0;
+        double queue_length = 0;
+        double service_time_us = 0;
+        clock_type::time_point last_response;
+    };
+    std::unordered_map<locator::host_id, endpoint_state> _endpoints;
+
+    double score(const endpoint_state& s) const noexcept;
+public:
+    // Called when a read is sent to the replica.
+    void on_request(locator::host_id ep);
+    // Called when the replica responds to a read, with the time it took
+    // and the load the replica reported, if any.
+    void on_response(locator::host_id ep, std::chrono::steady_clock::duration response_time);
+    void on_load_report(locator::host_id ep, const replica_load& load);
+    // Called when a read sent to the replica fails.
+    void on_failure(locator::host_id ep);
+
+    // Returns the predicted response time score of the replica. Lower is better.
+    double score(locator::host_id ep) const noexcept;
+    // Sorts the replicas, best first. Equally scored replicas keep their order.
+    void sort_by_score(std::span<locator::host_id> replicas);
+};
+
+} // namespace service
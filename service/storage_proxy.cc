@@ -66,11 +66,16 @@
 #include <seastar/coroutine/parallel_for_each.hh>
 #include <seastar/coroutine/as_future.hh>
 #include <seastar/coroutine/all.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/gate.hh>
 #include <type_traits>
 #include "locator/abstract_replication_strategy.hh"
+#include "locator/tablet_sharder.hh"
 #include "service/paxos/cas_request.hh"
 #include "mutation/mutation_partition_view.hh"
 #include "service/paxos/paxos_state.hh"
+#include "service/batched_mutation.hh"
+#include "utils/hash.hh"
 #include "gms/feature_service.hh"
 #include "db/virtual_table.hh"
 #include "mutation/canonical_mutation.hh"
@@ -194,6 +199,10 @@ bool storage_proxy::only_me(const locator::effective_replication_map& erm, const
     return replicas.size() == 1 && is_me(erm, replicas[0]);
 }
 
+bool storage_proxy::shard_aware_rpc_connections() const {
+    return _db.local().get_config().enable_shard_aware_rpc_connections() && features().shard_aware_storage_port;
+}
+
 enum class storage_proxy_remote_read_verb {
     read_data,
     read_mutation_data,
@@ -244,6 +253,39 @@ class storage_proxy::remote {
     netw::connection_drop_slot_t _connection_dropped;
     netw::connection_drop_registration_t _condrop_registration;
 
+    // The load of the reads handled for other coordinators, reported back to them.
+    replica_load_meter _read_load;
+
+    // Writes waiting to be sent to a replica in a MUTATION_BATCH, see send_mutation().
+    // Writes of different scheduling groups are batched separately, so that
+    // they keep being isolated on the replica.
+    struct mutation_batch_key {
+        locator::host_id replica;
+        scheduling_group sg;
+
+        bool operator==(const mutation_batch_key&) const = default;
+    };
+    struct mutation_batch_key_hash {
+        size_t operator()(const mutation_batch_key& k) const noexcept {
+            return utils::hash_combine(std::hash<locator::host_id>()(k.replica), std::hash<scheduling_group>()(k.sg));
+        }
+    };
+    struct pending_mutation_batch {
+        std::vector<batched_mutation> mutations;
+        std::vector<storage_proxy::clock_type::time_point> timeouts;
+        size_t size = 0;
+        gms::inet_address reply_to_ip;
+        lw_shared_ptr<shared_promise<>> sent = make_lw_shared<shared_promise<>>();
+    };
+    // Batches bigger than that are sent without waiting for the window to end.
+    static constexpr size_t max_mutations_per_batch = 128;
+    static constexpr size_t max_mutation_batch_size = 128 * 1024;
+    // Bigger mutations gain nothing from batching, and are sent on their own.
+    static constexpr size_t max_batched_mutation_size = 4 * 1024;
+    std::unordered_map<mutation_batch_key, pending_mutation_batch, mutation_batch_key_hash> _mutation_batches;
+    timer<> _mutation_batch_timer;
+    seastar::gate _mutation_batches_gate;
+
     bool _stopped{false};
 
 public:
@@ -252,7 +294,9 @@ class storage_proxy::remote {
         : _sp(sp), _ms(ms), _gossiper(g), _mm(mm), _sys_ks(sys_ks), _group0_client(group0_client), _topology_state_machine(tsm)
         , _connection_dropped(std::bind_front(&remote::connection_dropped, this))
         , _condrop_registration(_ms.when_connection_drops(_connection_dropped))
+        , _mutation_batch_timer([this] { flush_mutation_batches(); })
     {
+        ser::storage_proxy_rpc_verbs::register_mutation_batch(&_ms, std::bind_front(&remote::handle_mutation_batch, this, _sp._write_smp_service_group));
         ser::storage_proxy_rpc_verbs::register_counter_mutation(&_ms, std::bind_front(&remote::handle_counter_mutation, this));
         ser::storage_proxy_rpc_verbs::register_mutation(&_ms, std::bind_front(&remote::receive_mutation_handler, this, _sp._write_smp_service_group));
         ser::storage_proxy_rpc_verbs::register_hint_mutation(&_ms, std::bind_front(&remote::receive_hint_mutation_handler, this));
@@ -260,6 +304,7 @@ class storage_proxy::remote {
         ser::storage_proxy_rpc_verbs::register_mutation_done(&_ms, std::bind_front(&remote::handle_mutation_done, this));
         ser::storage_proxy_rpc_verbs::register_mutation_failed(&_ms, std::bind_front(&remote::handle_mutation_failed, this));
         ser::storage_proxy_rpc_verbs::register_read_data(&_ms, std::bind_front(&remote::handle_read_data, this));
+        ser::storage_proxy_rpc_verbs::register_read_data_multi(&_ms, std::bind_front(&remote::handle_read_data_multi, this));
         ser::storage_proxy_rpc_verbs::register_read_mutation_data(&_ms, std::bind_front(&remote::handle_read_mutation_data, this));
         ser::storage_proxy_rpc_verbs::register_read_digest(&_ms, std::bind_front(&remote::handle_read_digest, this));
         ser::storage_proxy_rpc_verbs::register_truncate(&_ms, std::bind_front(&remote::handle_truncate, this));
@@ -276,6 +321,9 @@ class storage_proxy::remote {
 
     // Must call before destroying the `remote` object.
     future<> stop() {
+        _mutation_batch_timer.cancel();
+        flush_mutation_batches();
+        co_await _mutation_batches_gate.close();
         _group0_as.request_abort();
         co_await std::move(_truncate_table_fiber);
         co_await ser::storage_proxy_rpc_verbs::unregister(&_ms);
@@ -291,6 +339,16 @@ class storage_proxy::remote {
         return _gossiper.is_alive(ep);
     }
 
+    // The number of most significant token bits the node ignores when
+    // sharding the vnode tables, which may differ from ours.
+    std::optional<unsigned> ignore_msb_bits(locator::host_id ep) const {
+        auto* rs = _topology_state_machine._topology.find(raft::server_id(ep.uuid()));
+        if (!rs) {
+            return std::nullopt;
+        }
+        return rs->second.ignore_msb;
+    }
+
     db::system_keyspace& system_keyspace() {
         return _sys_ks.local();
     }
@@ -317,12 +375,88 @@ class storage_proxy::remote {
             locator::host_id addr, storage_proxy::clock_type::time_point timeout, const std::optional<tracing::trace_info>& trace_info,
             const frozen_mutation& m, const host_id_vector_replica_set& forward, gms::inet_address reply_to_ip, locator::host_id reply_to, unsigned shard,
             storage_proxy::response_id_type response_id, db::per_partition_rate_limit::info rate_limit_info,
-            fencing_token fence) {
+            fencing_token fence, std::optional<unsigned> dst_shard = std::nullopt) {
+        // Small writes of this coordinator are batched, if enabled. Writes to be
+        // forwarded, and writes forwarded on behalf of other coordinators, are not.
+        if (forward.empty() && m.representation().size() <= max_batched_mutation_size
+                && reply_to == _sp.get_token_metadata_ptr()->get_my_id()
+                && !_mutation_batches_gate.is_closed() && _sp.features().batched_mutations) {
+            auto window = std::chrono::microseconds(_sp._db.local().get_config().write_rpc_batching_window_in_us());
+            if (window.count() > 0) {
+                return send_batched_mutation(addr, timeout, trace_info, m, reply_to_ip, shard, response_id, rate_limit_info, fence, window);
+            }
+        }
         inet_address_vector_replica_set forward_ips;
-        return ser::storage_proxy_rpc_verbs::send_mutation(
-                &_ms, std::move(addr), timeout,
-                m, get_forward_ips_if_needed(forward), reply_to_ip, shard,
-                response_id, trace_info, rate_limit_info, fence, forward, reply_to);
+        auto send = [&] (auto dst) {
+            return ser::storage_proxy_rpc_verbs::send_mutation(
+                    &_ms, std::move(dst), timeout,
+                    m, get_forward_ips_if_needed(forward), reply_to_ip, shard,
+                    response_id, trace_info, rate_limit_info, fence, forward, reply_to);
+        };
+        return dst_shard ? send(netw::host_shard{addr, *dst_shard}) : send(addr);
+    }
+
+    // Adds the write to the batch of its replica, sent when the batching window
+    // ends or the batch fills up. The returned future resolves when the batch
+    // is sent. The write is acknowledged on its own, like a single MUTATION.
+    future<> send_batched_mutation(
+            locator::host_id addr, storage_proxy::clock_type::time_point timeout, const std::optional<tracing::trace_info>& trace_info,
+            const frozen_mutation& m, gms::inet_address reply_to_ip, unsigned shard,
+            storage_proxy::response_id_type response_id, db::per_partition_rate_limit::info rate_limit_info,
+            fencing_token fence, std::chrono::microseconds window) {
+        auto key = mutation_batch_key{addr, current_scheduling_group()};
+        auto& batch = _mutation_batches[key];
+        batch.reply_to_ip = reply_to_ip;
+        batch.mutations.push_back(batched_mutation{
+            .fm = m,
+            .shard = shard,
+            .response_id = response_id,
+            .trace_info = trace_info,
+            .rate_limit_info = rate_limit_info,
+            .fence = fence,
+            .timeout = std::chrono::milliseconds(0),
+        });
+        batch.timeouts.push_back(timeout);
+        batch.size += m.representation().size();
+        auto f = batch.sent->get_shared_future();
+        if (batch.mutations.size() >= max_mutations_per_batch || batch.size >= max_mutation_batch_size) {
+            auto nh = _mutation_batches.extract(key);
+            send_mutation_batch(nh.key(), std::move(nh.mapped()));
+        } else if (!_mutation_batch_timer.armed()) {
+            _mutation_batch_timer.arm(window);
+        }
+        return f;
+    }
+
+    void flush_mutation_batches() {
+        auto batches = std::exchange(_mutation_batches, {});
+        for (auto& [key, batch] : batches) {
+            send_mutation_batch(key, std::move(batch));
+        }
+    }
+
+    void send_mutation_batch(mutation_batch_key key, pending_mutation_batch batch) {
+        auto now = storage_proxy::clock_type::now();
+        for (size_t i = 0; i < batch.mutations.size(); ++i) {
+            batch.mutations[i].timeout = std::chrono::duration_cast<std::chrono::milliseconds>(std::max(batch.timeouts[i] - now, storage_proxy::clock_type::duration(0)));
+        }
+        auto timeout = *std::ranges::max_element(batch.timeouts);
+        auto sent = batch.sent;
+        // Waited on indirectly, via the gate
+        (void)with_gate(_mutation_batches_gate, [this, key, timeout, batch = std::move(batch)] () mutable {
+            return with_scheduling_group(key.sg, [this, key, timeout, batch = std::move(batch)] () mutable {
+                ++_sp.get_stats().mutation_batches;
+                _sp.get_stats().batched_mutations += batch.mutations.size();
+                return ser::storage_proxy_rpc_verbs::send_mutation_batch(&_ms, key.replica, timeout,
+                        batch.mutations, batch.reply_to_ip, _sp.get_token_metadata_ptr()->get_my_id());
+            });
+        }).then_wrapped([sent = std::move(sent)] (future<> f) {
+            if (f.failed()) {
+                sent->set_exception(f.get_exception());
+            } else {
+                sent->set_value();
+            }
+        });
     }
 
     future<> send_hint_mutation(
@@ -371,9 +505,15 @@ class storage_proxy::remote {
     send_read_mutation_data(
             locator::host_id addr, storage_proxy::clock_type::time_point timeout, tracing::trace_state_ptr tr_state,
             const query::read_command& cmd, const dht::partition_range& pr,
-            fencing_token fence) {
+            fencing_token fence, std::optional<unsigned> dst_shard) {
         tracing::trace(tr_state, "read_mutation_data: sending a message to /{}", addr);
-        auto&& [result, hit_rate, opt_exception] = co_await ser::storage_proxy_rpc_verbs::send_read_mutation_data(&_ms, addr, timeout, cmd, pr, fence);
+        auto send = [&] (auto dst) {
+            return ser::storage_proxy_rpc_verbs::send_read_mutation_data(&_ms, std::move(dst), timeout, cmd, pr, fence);
+        };
+        auto&& [result, hit_rate, opt_exception, opt_load] = co_await (dst_shard ? send(netw::host_shard{addr, *dst_shard}) : send(addr));
+        if (opt_load) {
+            _sp._replica_load_tracker.on_load_report(addr, *opt_load);
+        }
         if (opt_exception.has_value() && *opt_exception) {
             co_await coroutine::return_exception_ptr((*opt_exception).into_exception_ptr());
         }
@@ -387,10 +527,16 @@ class storage_proxy::remote {
             locator::host_id addr, storage_proxy::clock_type::time_point timeout, tracing::trace_state_ptr tr_state,
             const query::read_command& cmd, const dht::partition_range& pr,
             query::digest_algorithm digest_algo, db::per_partition_rate_limit::info rate_limit_info,
-            fencing_token fence) {
+            fencing_token fence, std::optional<unsigned> dst_shard) {
         tracing::trace(tr_state, "read_data: sending a message to /{}", addr);
-        auto&& [result, hit_rate, opt_exception] =
-            co_await ser::storage_proxy_rpc_verbs::send_read_data(&_ms, addr, timeout, cmd, pr, digest_algo, rate_limit_info, fence);
+        auto send = [&] (auto dst) {
+            return ser::storage_proxy_rpc_verbs::send_read_data(&_ms, std::move(dst), timeout, cmd, pr, digest_algo, rate_limit_info, fence);
+        };
+        auto&& [result, hit_rate, opt_exception, opt_load] =
+            co_await (dst_shard ? send(netw::host_shard{addr, *dst_shard}) : send(addr));
+        if (opt_load) {
+            _sp._replica_load_tracker.on_load_report(addr, *opt_load);
+        }
         if (opt_exception.has_value() && *opt_exception) {
             co_await coroutine::return_exception_ptr((*opt_exception).into_exception_ptr());
         }
@@ -399,15 +545,44 @@ class storage_proxy::remote {
         co_return rpc::tuple{make_foreign(::make_lw_shared<query::result>(std::move(result))), hit_rate.value_or(cache_temperature::invalid())};
     }
 
+    future<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>>
+    send_read_data_multi(
+            locator::host_id addr, storage_proxy::clock_type::time_point timeout, tracing::trace_state_ptr tr_state,
+            const query::read_command& cmd, const dht::partition_range_vector& prs, fencing_token fence) {
+        tracing::trace(tr_state, "read_data_multi: sending a message to /{} for {} partitions", addr, prs.size());
+        auto&& [results, exception, opt_load] =
+            co_await ser::storage_proxy_rpc_verbs::send_read_data_multi(&_ms, addr, timeout, cmd, prs, fence);
+        if (opt_load) {
+            _sp._replica_load_tracker.on_load_report(addr, *opt_load);
+        }
+        if (exception) {
+            co_await coroutine::return_exception_ptr(std::move(exception).into_exception_ptr());
+        }
+
+        tracing::trace(tr_state, "read_data_multi: got response from /{}", addr);
+        std::vector<foreign_ptr<lw_shared_ptr<query::result>>> ret;
+        ret.reserve(results.size());
+        for (auto& r : results) {
+            ret.push_back(make_foreign(::make_lw_shared<query::result>(std::move(r))));
+        }
+        co_return ret;
+    }
+
     future<rpc::tuple<query::result_digest, api::timestamp_type, cache_temperature, std::optional<full_position>>>
     send_read_digest(
             locator::host_id addr, storage_proxy::clock_type::time_point timeout, tracing::trace_state_ptr tr_state,
             const query::read_command& cmd, const dht::partition_range& pr,
             query::digest_algorithm digest_algo, db::per_partition_rate_limit::info rate_limit_info,
-            fencing_token fence) {
+            fencing_token fence, std::optional<unsigned> dst_shard) {
         tracing::trace(tr_state, "read_digest: sending a message to /{}", addr);
-        auto&& [d, t, hit_rate, opt_exception, opt_last_pos] =
-            co_await ser::storage_proxy_rpc_verbs::send_read_digest(&_ms, addr, timeout, cmd, pr, digest_algo, rate_limit_info, fence);
+        auto send = [&] (auto dst) {
+            return ser::storage_proxy_rpc_verbs::send_read_digest(&_ms, std::move(dst), timeout, cmd, pr, digest_algo, rate_limit_info, fence);
+        };
+        auto&& [d, t, hit_rate, opt_exception, opt_last_pos, opt_load] =
+            co_await (dst_shard ? send(netw::host_shard{addr, *dst_shard}) : send(addr));
+        if (opt_load) {
+            _sp._replica_load_tracker.on_load_report(addr, *opt_load);
+        }
         if (opt_exception.has_value() && *opt_exception) {
             co_await coroutine::return_exception_ptr((*opt_exception).into_exception_ptr());
         }
@@ -699,6 +874,18 @@ class storage_proxy::remote {
                 });
     }
 
+    future<rpc::no_wait_type> handle_mutation_batch(
+            smp_service_group smp_grp, const rpc::client_info& cinfo, rpc::opt_time_point t,
+            std::vector<batched_mutation> mutations, gms::inet_address reply_to, locator::host_id reply_to_id) {
+        auto now = storage_proxy::clock_type::now();
+        co_await coroutine::parallel_for_each(mutations, [&] (batched_mutation& bm) -> future<> {
+            co_await receive_mutation_handler(smp_grp, cinfo, now + bm.timeout, std::move(bm.fm), {}, reply_to, bm.shard, bm.response_id,
+                    rpc::optional<std::optional<tracing::trace_info>>(std::move(bm.trace_info)), bm.rate_limit_info, bm.fence,
+                    host_id_vector_replica_set{}, reply_to_id);
+        });
+        co_return netw::messaging_service::no_wait();
+    }
+
     future<rpc::no_wait_type> receive_hint_mutation_handler(
             const rpc::client_info& cinfo, rpc::opt_time_point t,
             frozen_mutation in, inet_address_vector_replica_set forward, gms::inet_address reply_to,
@@ -781,6 +968,19 @@ class storage_proxy::remote {
 
     using read_verb = storage_proxy_remote_read_verb;
 
+    // Runs the handler of a read and appends the load of this shard to its result.
+    template<utils::Tuple Result, typename Func>
+    future<Result> with_replica_load(Func func) {
+        _read_load.on_read_start();
+        auto start = replica_load_meter::clock_type::now();
+        auto f = co_await coroutine::as_future(func());
+        auto load = _read_load.on_read_finish(replica_load_meter::clock_type::now() - start);
+        if (f.failed()) {
+            co_await coroutine::return_exception_ptr(f.get_exception());
+        }
+        co_return utils::tuple_insert<Result>(f.get(), std::move(load));
+    }
+
     template<typename Result, read_verb verb>
     future<Result> handle_read(const rpc::client_info& cinfo, rpc::opt_time_point t,
         query::read_command cmd1, ::compat::wrapping_partition_range pr,
@@ -916,34 +1116,108 @@ class storage_proxy::remote {
     }
 
     using read_data_result_t = rpc::tuple<foreign_ptr<lw_shared_ptr<query::result>>, cache_temperature, replica::exception_variant>;
-    future<read_data_result_t> handle_read_data(
+    using read_data_load_result_t = rpc::tuple<foreign_ptr<lw_shared_ptr<query::result>>, cache_temperature, replica::exception_variant, replica_load>;
+    future<read_data_load_result_t> handle_read_data(
             const rpc::client_info& cinfo, rpc::opt_time_point t,
             query::read_command cmd1, ::compat::wrapping_partition_range pr,
             rpc::optional<query::digest_algorithm> oda,
             rpc::optional<db::per_partition_rate_limit::info> rate_limit_info_opt,
             rpc::optional<service::fencing_token> fence) {
-        return handle_read<read_data_result_t, read_verb::read_data>(cinfo, t, std::move(cmd1),
-            std::move(pr), oda, rate_limit_info_opt, fence);
+        return with_replica_load<read_data_load_result_t>([&] {
+            return handle_read<read_data_result_t, read_verb::read_data>(cinfo, t, std::move(cmd1),
+                std::move(pr), oda, rate_limit_info_opt, fence);
+        });
+    }
+
+    using read_data_multi_result_t = rpc::tuple<std::vector<query::result>, replica::exception_variant>;
+    using read_data_multi_load_result_t = rpc::tuple<std::vector<query::result>, replica::exception_variant, replica_load>;
+    future<read_data_multi_load_result_t> handle_read_data_multi(
+            const rpc::client_info& cinfo, rpc::opt_time_point t,
+            query::read_command cmd1, dht::partition_range_vector prs,
+            service::fencing_token fence) {
+        return with_replica_load<read_data_multi_load_result_t>([&] {
+            return do_handle_read_data_multi(cinfo, t, std::move(cmd1), std::move(prs), fence);
+        });
+    }
+
+    future<read_data_multi_result_t> do_handle_read_data_multi(
+            const rpc::client_info& cinfo, rpc::opt_time_point t,
+            query::read_command cmd1, dht::partition_range_vector prs,
+            service::fencing_token fence) {
+        tracing::trace_state_ptr trace_state_ptr;
+        auto src_addr = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
+        auto src_shard = cinfo.retrieve_auxiliary<uint32_t>("src_cpu_id");
+
+        if (cmd1.trace_info) {
+            trace_state_ptr = tracing::tracing::get_local_tracing_instance().create_session(*cmd1.trace_info);
+            tracing::begin(trace_state_ptr);
+            tracing::trace(trace_state_ptr, "read_data_multi: message received from /{}", src_addr);
+        }
+        if (!cmd1.max_result_size) {
+            auto& cfg = _sp.local_db().get_config();
+            cmd1.max_result_size.emplace(cfg.max_memory_for_unlimited_query_soft_limit(), cfg.max_memory_for_unlimited_query_hard_limit());
+        }
+        shared_ptr<storage_proxy> p = _sp.shared_from_this();
+        auto cmd = make_lw_shared<query::read_command>(std::move(cmd1));
+        auto timeout = t ? *t : db::no_timeout;
+
+        // The verb is only sent once the whole cluster supports it, so the
+        // read command always comes in the native reversed format.
+        auto f = co_await coroutine::as_future(coroutine::lambda([&] () -> future<std::vector<query::result>> {
+            schema_ptr s = co_await get_schema_for_read(cmd->schema_version, src_addr, src_shard, timeout);
+            for (const auto& pr : prs) {
+                if (!pr.is_singular()) {
+                    throw std::runtime_error("READ_DATA_MULTI called with a non-singular range");
+                }
+            }
+            if (auto stale = _sp.apply_fence(fence, src_addr)) {
+                co_await coroutine::return_exception(std::move(*stale));
+            }
+            p->get_stats().replica_data_multi_reads++;
+            auto erm = s->table().get_effective_replication_map();
+            auto results = co_await p->query_result_local_multi(std::move(erm), std::move(s), cmd, prs, trace_state_ptr, timeout);
+            if (auto stale = _sp.apply_fence(fence, src_addr)) {
+                co_await coroutine::return_exception(std::move(*stale));
+            }
+            // The results are owned by the shards which produced them, copy
+            // them over so they can be sent back in one response.
+            co_return results | std::views::transform([] (const foreign_ptr<lw_shared_ptr<query::result>>& r) {
+                return query::result(bytes_ostream(r->buf()), r->is_short_read(), r->row_count_low_bits(), r->partition_count(),
+                        r->row_count_high_bits(), r->last_position());
+            }) | std::ranges::to<std::vector>();
+        }));
+        tracing::trace(trace_state_ptr, "read_data_multi handling is done, sending a response to /{}", src_addr);
+
+        if (f.failed()) {
+            co_return co_await encode_replica_exception_for_rpc<read_data_multi_result_t>(p->features(), f.get_exception());
+        }
+        co_return read_data_multi_result_t(f.get(), replica::exception_variant{});
     }
 
     using read_mutation_data_result_t = rpc::tuple<foreign_ptr<lw_shared_ptr<reconcilable_result>>, cache_temperature, replica::exception_variant>;
-    future<read_mutation_data_result_t> handle_read_mutation_data(
+    using read_mutation_data_load_result_t = rpc::tuple<foreign_ptr<lw_shared_ptr<reconcilable_result>>, cache_temperature, replica::exception_variant, replica_load>;
+    future<read_mutation_data_load_result_t> handle_read_mutation_data(
             const rpc::client_info& cinfo, rpc::opt_time_point t,
             query::read_command cmd1, ::compat::wrapping_partition_range pr,
             rpc::optional<service::fencing_token> fence) {
-        return handle_read<read_mutation_data_result_t, read_verb::read_mutation_data>(cinfo, t, std::move(cmd1),
-            std::move(pr), std::nullopt, std::nullopt, fence);
+        return with_replica_load<read_mutation_data_load_result_t>([&] {
+            return handle_read<read_mutation_data_result_t, read_verb::read_mutation_data>(cinfo, t, std::move(cmd1),
+                std::move(pr), std::nullopt, std::nullopt, fence);
+        });
     }
 
     using read_digest_result_t = rpc::tuple<query::result_digest, long, cache_temperature, replica::exception_variant, std::optional<full_position>>;
-    future<read_digest_result_t> handle_read_digest(
+    using read_digest_load_result_t = rpc::tuple<query::result_digest, long, cache_temperature, replica::exception_variant, std::optional<full_position>, replica_load>;
+    future<read_digest_load_result_t> handle_read_digest(
             const rpc::client_info& cinfo, rpc::opt_time_point t,
             query::read_command cmd1, ::compat::wrapping_partition_range pr,
             rpc::optional<query::digest_algorithm> oda,
             rpc::optional<db::per_partition_rate_limit::info> rate_limit_info_opt,
             rpc::optional<service::fencing_token> fence) {
-        return handle_read<read_digest_result_t, read_verb::read_digest>(cinfo, t, std::move(cmd1),
-            std::move(pr), oda, rate_limit_info_opt, fence);
+        return with_replica_load<read_digest_load_result_t>([&] {
+            return handle_read<read_digest_result_t, read_verb::read_digest>(cinfo, t, std::move(cmd1),
+                std::move(pr), oda, rate_limit_info_opt, fence);
+        });
     }
 
     future<> handle_truncate(rpc::opt_time_point timeout, sstring ksname, sstring cfname) {
@@ -1209,6 +1483,7 @@ class mutation_holder {
             const locator::effective_replication_map& erm, fencing_token fence) = 0;
     virtual future<> apply_remotely(storage_proxy& sp, locator::host_id ep, const host_id_vector_replica_set& forward,
             storage_proxy::response_id_type response_id, storage_proxy::clock_type::time_point timeout,
+            const locator::effective_replication_map& erm,
             tracing::trace_state_ptr tr_state, db::per_partition_rate_limit::info rate_limit_info,
             fencing_token fence) = 0;
     virtual bool is_shared() = 0;
@@ -1264,13 +1539,18 @@ class per_destination_mutation : public mutation_holder {
     }
     virtual future<> apply_remotely(storage_proxy& sp, locator::host_id ep, const host_id_vector_replica_set& forward,
             storage_proxy::response_id_type response_id, storage_proxy::clock_type::time_point timeout,
+            const locator::effective_replication_map& erm,
             tracing::trace_state_ptr tr_state, db::per_partition_rate_limit::info rate_limit_info, fencing_token fence) override {
         auto m = _mutations[ep];
         if (m) {
             tracing::trace(tr_state, "Sending a mutation to /{}", ep);
+            std::optional<unsigned> dst_shard;
+            if (sp.shard_aware_rpc_connections()) {
+                dst_shard = sp.replica_shard(erm, *_schema, _token, ep);
+            }
             return sp.remote().send_mutation(ep, timeout, tracing::make_trace_info(tr_state),
                     *m, forward, sp.my_address(), sp.get_token_metadata_ptr()->get_my_id(), this_shard_id(),
-                    response_id, rate_limit_info, fence);
+                    response_id, rate_limit_info, fence, dst_shard);
         }
         sp.got_response(response_id, ep, std::nullopt);
         return make_ready_future<>();
@@ -1314,12 +1594,17 @@ class shared_mutation : public mutation_holder {
     }
     virtual future<> apply_remotely(storage_proxy& sp, locator::host_id ep, const host_id_vector_replica_set& forward,
             storage_proxy::response_id_type response_id, storage_proxy::clock_type::time_point timeout,
+            const locator::effective_replication_map& erm,
             tracing::trace_state_ptr tr_state, db::per_partition_rate_limit::info rate_limit_info,
             fencing_token fence) override {
         tracing::trace(tr_state, "Sending a mutation to /{}", ep);
+        std::optional<unsigned> dst_shard;
+        if (sp.shard_aware_rpc_connections()) {
+            dst_shard = sp.replica_shard(erm, *_schema, _mutation->token(*_schema), ep);
+        }
         return sp.remote().send_mutation(ep, timeout, tracing::make_trace_info(tr_state),
                 *_mutation, forward, sp.my_address(), sp.get_token_metadata_ptr()->get_my_id(), this_shard_id(),
-                response_id, rate_limit_info, fence);
+                response_id, rate_limit_info, fence, dst_shard);
     }
     virtual bool is_shared() override {
         return true;
@@ -1346,6 +1631,7 @@ class hint_mutation : public shared_mutation {
     }
     virtual future<> apply_remotely(storage_proxy& sp, locator::host_id ep, const host_id_vector_replica_set& forward,
             storage_proxy::response_id_type response_id, storage_proxy::clock_type::time_point timeout,
+            const locator::effective_replication_map& erm,
             tracing::trace_state_ptr tr_state, db::per_partition_rate_limit::info rate_limit_info, fencing_token fence) override {
         return sp.remote().send_hint_mutation(ep, timeout, tr_state,
                 *_mutation, forward, sp.my_address(), sp.get_token_metadata_ptr()->get_my_id(), this_shard_id(), response_id, rate_limit_info, fence);
@@ -1422,6 +1708,10 @@ class paxos_response_handler : public enable_shared_from_this<paxos_response_han
     future<paxos::prepare_summary> prepare_ballot(utils::UUID ballot);
     future<bool> accept_proposal(lw_shared_ptr<paxos::proposal> proposal, bool timeout_if_partially_accepted = true);
     future<> learn_decision(lw_shared_ptr<paxos::proposal> proposal, bool allow_hints = false);
+    // Learns an accepted decision without making the client wait for it,
+    // see storage_proxy::cas(). Holds the CAS lock of the key until the
+    // decision is learned.
+    void learn_decision_in_background(lw_shared_ptr<paxos::proposal> proposal, paxos::paxos_state::guard cas_lock);
     void prune(utils::UUID ballot);
     uint64_t id() const {
         return _id;
@@ -1471,6 +1761,7 @@ class cas_mutation : public mutation_holder {
     }
     virtual future<> apply_remotely(storage_proxy& sp, locator::host_id ep, const host_id_vector_replica_set& forward,
             storage_proxy::response_id_type response_id, storage_proxy::clock_type::time_point timeout,
+            const locator::effective_replication_map& erm,
             tracing::trace_state_ptr tr_state, db::per_partition_rate_limit::info rate_limit_info, fencing_token) override {
         tracing::trace(tr_state, "Sending a learn to /{}", ep);
         // TODO: Enforce per partition rate limiting in paxos
@@ -1780,7 +2071,7 @@ class abstract_write_response_handler : public seastar::enable_shared_from_this<
             storage_proxy::response_id_type response_id, storage_proxy::clock_type::time_point timeout,
             tracing::trace_state_ptr tr_state) {
         return _mutation_holder->apply_remotely(*_proxy, ep, forward,
-            response_id, timeout, std::move(tr_state), _rate_limit_info,
+            response_id, timeout, *_effective_replication_map_ptr, std::move(tr_state), _rate_limit_info,
             storage_proxy::get_fence(*_effective_replication_map_ptr));
     }
     const schema_ptr& get_schema() const {
@@ -2468,6 +2759,21 @@ future<> paxos_response_handler::learn_decision(lw_shared_ptr<paxos::proposal> d
     co_await when_all_succeed(std::move(f_cdc), std::move(f_lwt)).discard_result();
 }
 
+void paxos_response_handler::learn_decision_in_background(lw_shared_ptr<paxos::proposal> decision, paxos::paxos_state::guard cas_lock) {
+    _proxy->get_stats().cas_background_learn++;
+    // The handler is kept alive until the decision is learned, and it holds
+    // the shared pointer to storage_proxy, so storage_proxy::stop() waits for it.
+    (void)learn_decision(std::move(decision)).then_wrapped([h = shared_from_this(), cas_lock = std::move(cas_lock)] (future<> f) {
+        if (f.failed()) {
+            // The decision is accepted by a quorum, so it will be repaired
+            // by the next paxos round on the key.
+            auto ex = f.get_exception();
+            tracing::trace(h->tr_state, "learn_decision in background failed: {}", ex);
+            paxos::paxos_state::logger.debug("CAS[{}] background learn failed: {}", h->_id, ex);
+        }
+    });
+}
+
 void paxos_response_handler::prune(utils::UUID ballot) {
     if ( _proxy->get_stats().cas_now_pruning >= pruning_limit) {
         _proxy->get_stats().cas_coordinator_dropped_prune++;
@@ -2862,6 +3168,22 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("number of speculative data read requests that were sent"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
 
+        sm::make_total_operations("batched_data_reads", batched_data_reads,
+                       sm::description("number of multi-partition data read requests, each covering several partitions of one query owned by the same replica"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_total_operations("batched_data_read_partitions", batched_data_read_partitions,
+                       sm::description("number of partitions read by multi-partition data read requests"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_total_operations("mutation_batches", mutation_batches,
+                       sm::description("number of batched write requests sent to replicas, each carrying several writes of this coordinator"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_total_operations("batched_mutations", batched_mutations,
+                       sm::description("number of writes sent to replicas in batched write requests"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
         sm::make_summary("cas_read_latency_summary", sm::description("CAS read latency summary"), [this] {return to_metrics_summary(cas_read.summary());})(storage_proxy_stats::current_scheduling_group_label()).set_skip_when_empty(),
         sm::make_summary("cas_write_latency_summary", sm::description("CAS write latency summary"), [this] {return to_metrics_summary(cas_write.summary());})(storage_proxy_stats::current_scheduling_group_label()).set_skip_when_empty(),
 
@@ -2926,6 +3248,10 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("how many times a coordinator did not perform prune after cas"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
 
+        sm::make_total_operations("cas_background_learn", cas_background_learn,
+                       sm::description("how many times a paxos decision was learned in the background, after the result was already returned"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
         sm::make_total_operations("cas_total_operations", cas_total_operations,
                        sm::description("number of total paxos operations executed (reads and writes)"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
@@ -2968,6 +3294,10 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("number of remote reads this Node received. op_type label could be data, mutation_data or digest"),
                        {storage_proxy_stats::current_scheduling_group_label(), storage_proxy_stats::op_type_label("digest")}).set_skip_when_empty(),
 
+        sm::make_total_operations("reads", replica_data_multi_reads,
+                       sm::description("number of remote reads this Node received. op_type label could be data, mutation_data or digest"),
+                       {storage_proxy_stats::current_scheduling_group_label(), storage_proxy_stats::op_type_label("data_multi")}).set_skip_when_empty(),
+
         sm::make_total_operations("cross_shard_ops", replica_cross_shard_ops,
                        sm::description("number of operations that crossed a shard boundary"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
@@ -3145,6 +3475,18 @@ const struct storage_proxy::remote& storage_proxy::remote() const {
         "attempted to perform remote query when `storage_proxy::remote` is unavailable");
 }
 
+std::optional<unsigned> storage_proxy::replica_shard(const locator::effective_replication_map& erm, const schema& s, dht::token token, locator::host_id ep) const {
+    if (erm.get_replication_strategy().uses_tablets()) {
+        return locator::tablet_sharder(erm.get_token_metadata(), s.id(), ep).shard_for_reads(token);
+    }
+    auto* node = erm.get_topology().find_node(ep);
+    auto ignore_msb = remote().ignore_msb_bits(ep);
+    if (!node || !node->get_shard_count() || !ignore_msb) {
+        return std::nullopt;
+    }
+    return dht::shard_of(node->get_shard_count(), *ignore_msb, token);
+}
+
 const data_dictionary::database
 storage_proxy::data_dictionary() const {
     return _db.local().as_data_dictionary();
@@ -5184,6 +5526,14 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
     }
 
 protected:
+    // Single partition reads are sent over the connection to the shard of the
+    // replica which owns the partition, if enabled.
+    std::optional<unsigned> replica_shard(locator::host_id ep) const {
+        if (!_proxy->shard_aware_rpc_connections() || !_partition_range.is_singular()) {
+            return std::nullopt;
+        }
+        return _proxy->replica_shard(*_effective_replication_map_ptr, *_schema, _partition_range.start()->value().token(), ep);
+    }
     future<rpc::tuple<foreign_ptr<lw_shared_ptr<reconcilable_result>>, cache_temperature>> make_mutation_data_request(lw_shared_ptr<query::read_command> cmd, locator::host_id ep, clock_type::time_point timeout) {
         ++_proxy->get_stats().mutation_data_read_attempts.get_ep_stat(get_topology(), ep);
         auto fence = storage_proxy::get_fence(*_effective_replication_map_ptr);
@@ -5194,7 +5544,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
             const bool format_reverse_required = cmd->slice.is_reversed() && !_native_reversed_queries_enabled;
             cmd = format_reverse_required ? reversed(::make_lw_shared(*cmd)) : cmd;
 
-            auto f = _proxy->remote().send_read_mutation_data(ep, timeout, _trace_state, *cmd, _partition_range, fence);
+            auto f = _proxy->remote().send_read_mutation_data(ep, timeout, _trace_state, *cmd, _partition_range, fence, replica_shard(ep));
             if (format_reverse_required) {
                 f = f.then([](auto r) {
                     auto&& [result, hit_rate] = r;
@@ -5218,7 +5568,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
         } else {
             const bool format_reverse_required = _cmd->slice.is_reversed() && !_native_reversed_queries_enabled;
             auto cmd = format_reverse_required ? reversed(::make_lw_shared(*_cmd)) : _cmd;
-            return _proxy->remote().send_read_data(ep, timeout, _trace_state, *cmd, _partition_range, opts.digest_algo, _rate_limit_info, fence);
+            return _proxy->remote().send_read_data(ep, timeout, _trace_state, *cmd, _partition_range, opts.digest_algo, _rate_limit_info, fence, replica_shard(ep));
         }
     }
     future<rpc::tuple<query::result_digest, api::timestamp_type, cache_temperature, std::optional<full_position>>> make_digest_request(locator::host_id ep, clock_type::time_point timeout) {
@@ -5232,12 +5582,13 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
             tracing::trace(_trace_state, "read_digest: sending a message to /{}", ep);
             const bool format_reverse_required = _cmd->slice.is_reversed() && !_native_reversed_queries_enabled;
             auto cmd = format_reverse_required ? reversed(::make_lw_shared(*_cmd)) : _cmd;
-            return _proxy->remote().send_read_digest(ep, timeout, _trace_state, *cmd, _partition_range, digest_algorithm(*_proxy), _rate_limit_info, fence);
+            return _proxy->remote().send_read_digest(ep, timeout, _trace_state, *cmd, _partition_range, digest_algorithm(*_proxy), _rate_limit_info, fence, replica_shard(ep));
         }
     }
     void make_mutation_data_requests(lw_shared_ptr<query::read_command> cmd, data_resolver_ptr resolver, targets_iterator begin, targets_iterator end, clock_type::time_point timeout) {
         auto start = latency_clock::now();
         for (const locator::host_id& ep : std::ranges::subrange(begin, end)) {
+            _proxy->get_replica_load_tracker().on_request(ep);
             // Waited on indirectly, shared_from_this keeps `this` alive
             (void)make_mutation_data_request(cmd, ep, timeout).then_wrapped([this, resolver, ep, start, exec = shared_from_this()] (future<rpc::tuple<foreign_ptr<lw_shared_ptr<reconcilable_result>>, cache_temperature>> f) {
                 std::exception_ptr ex;
@@ -5247,6 +5598,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                     _cf->set_hit_rate(ep, std::get<1>(v));
                     resolver->add_mutate_data(ep, std::get<0>(std::move(v)));
                     ++_proxy->get_stats().mutation_data_read_completed.get_ep_stat(get_topology(), ep);
+                    _proxy->get_replica_load_tracker().on_response(ep, latency_clock::now() - start);
                     register_request_latency(latency_clock::now() - start);
                     return;
                   } else {
@@ -5257,6 +5609,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                 }
 
                 ++_proxy->get_stats().mutation_data_read_errors.get_ep_stat(get_topology(), ep);
+                _proxy->get_replica_load_tracker().on_failure(ep);
                 resolver->error(ep, std::move(ex));
             });
         }
@@ -5264,6 +5617,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
     void make_data_requests(digest_resolver_ptr resolver, targets_iterator begin, targets_iterator end, clock_type::time_point timeout, bool want_digest) {
         auto start = latency_clock::now();
         for (const locator::host_id& ep : std::ranges::subrange(begin, end)) {
+            _proxy->get_replica_load_tracker().on_request(ep);
             // Waited on indirectly, shared_from_this keeps `this` alive
             (void)make_data_request(ep, timeout, want_digest).then_wrapped([this, resolver, ep, start, exec = shared_from_this()] (future<rpc::tuple<foreign_ptr<lw_shared_ptr<query::result>>, cache_temperature>> f) {
                 std::exception_ptr ex;
@@ -5273,6 +5627,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                     _cf->set_hit_rate(ep, std::get<1>(v));
                     resolver->add_data(ep, std::get<0>(std::move(v)));
                     ++_proxy->get_stats().data_read_completed.get_ep_stat(get_topology(), ep);
+                    _proxy->get_replica_load_tracker().on_response(ep, latency_clock::now() - start);
                     _used_targets.push_back(ep);
                     register_request_latency(latency_clock::now() - start);
                     return;
@@ -5284,6 +5639,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                 }
 
                 ++_proxy->get_stats().data_read_errors.get_ep_stat(get_topology(), ep);
+                _proxy->get_replica_load_tracker().on_failure(ep);
                 resolver->error(ep, std::move(ex));
             });
         }
@@ -5291,6 +5647,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
     void make_digest_requests(digest_resolver_ptr resolver, targets_iterator begin, targets_iterator end, clock_type::time_point timeout) {
         auto start = latency_clock::now();
         for (const locator::host_id& ep : std::ranges::subrange(begin, end)) {
+            _proxy->get_replica_load_tracker().on_request(ep);
             // Waited on indirectly, shared_from_this keeps `this` alive
             (void)make_digest_request(ep, timeout).then_wrapped([this, resolver, ep, start, exec = shared_from_this()] (future<rpc::tuple<query::result_digest, api::timestamp_type, cache_temperature, std::optional<full_position>>> f) {
                 std::exception_ptr ex;
@@ -5300,6 +5657,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                     _cf->set_hit_rate(ep, std::get<2>(v));
                     resolver->add_digest(ep, std::get<0>(v), std::get<1>(v), std::get<3>(std::move(v)));
                     ++_proxy->get_stats().digest_read_completed.get_ep_stat(get_topology(), ep);
+                    _proxy->get_replica_load_tracker().on_response(ep, latency_clock::now() - start);
                     _used_targets.push_back(ep);
                     register_request_latency(latency_clock::now() - start);
                     return;
@@ -5311,6 +5669,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                 }
 
                 ++_proxy->get_stats().digest_read_errors.get_ep_stat(get_topology(), ep);
+                _proxy->get_replica_load_tracker().on_failure(ep);
                 resolver->error(ep, std::move(ex));
             });
         }
@@ -5688,10 +6047,19 @@ result<::shared_ptr<abstract_read_executor>> storage_proxy::get_read_executor(lw
     // orders the list by proximity to the local endpoint.
     is_read_non_local |= !all_replicas.empty() && all_replicas.front() != erm->get_topology().my_host_id();
 
+    // Rank the replicas of the local DC by their predicted response time.
+    // filter_for_query() keeps the order, so the best ones become the targets
+    // and the next best one the extra replica to speculate with.
+    const bool adaptive_replica_selection = _db.local().get_config().adaptive_replica_selection();
+    if (adaptive_replica_selection) {
+        auto local_end = std::stable_partition(all_replicas.begin(), all_replicas.end(), erm->get_topology().get_local_dc_filter());
+        _replica_load_tracker.sort_by_score(std::span(all_replicas.begin(), local_end));
+    }
+
     auto cf = _db.local().find_column_family(schema).shared_from_this();
     host_id_vector_replica_set target_replicas = filter_replicas_for_read(cl, *erm, all_replicas, preferred_endpoints, repair_decision,
             retry_type == speculative_retry::type::NONE ? nullptr : &extra_replica,
-            _db.local().get_config().cache_hit_rate_read_balancing() ? &*cf : nullptr);
+            !adaptive_replica_selection && _db.local().get_config().cache_hit_rate_read_balancing() ? &*cf : nullptr);
 
     slogger.trace("creating read executor for token {} with all: {} targets: {} rp decision: {}", token, all_replicas, target_replicas, repair_decision);
     tracing::trace(trace_state, "Creating read executor for token {} with all: {} targets: {} repair decision: {}", token, all_replicas, target_replicas, repair_decision);
@@ -5798,6 +6166,47 @@ storage_proxy::query_result_local(locator::effective_replication_map_ptr erm, sc
     }
 }
 
+// The number of partitions of a batched read which a shard reads concurrently.
+// A batch can hold all the partitions of an IN query, so reading them all at
+// once could admit an unbounded number of reads to the shard's semaphore.
+static constexpr size_t read_data_multi_concurrency = 16;
+
+future<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>>
+storage_proxy::query_result_local_multi(locator::effective_replication_map_ptr erm, schema_ptr query_schema, lw_shared_ptr<query::read_command> cmd,
+                                        const dht::partition_range_vector& prs, tracing::trace_state_ptr trace_state, storage_proxy::clock_type::time_point timeout) {
+    // Group the ranges by the shard owning them, so that every shard is
+    // visited once, no matter how many of the partitions it owns.
+    std::map<unsigned, std::vector<size_t>> ranges_per_shard;
+    const auto& sharder = erm->get_sharder(*query_schema);
+    for (size_t i = 0; i < prs.size(); ++i) {
+        ranges_per_shard[dht::is_single_shard(sharder, *query_schema, prs[i]).value()].push_back(i);
+    }
+
+    std::vector<foreign_ptr<lw_shared_ptr<query::result>>> results(prs.size());
+    co_await coroutine::parallel_for_each(ranges_per_shard, [&] (const std::pair<const unsigned, std::vector<size_t>>& shard_and_ranges) -> future<> {
+        auto& [shard, indexes] = shard_and_ranges;
+        get_stats().replica_cross_shard_ops += shard != this_shard_id();
+        auto shard_prs = indexes | std::views::transform([&] (size_t i) { return prs[i]; }) | std::ranges::to<dht::partition_range_vector>();
+        auto shard_results = co_await _db.invoke_on(shard, _read_smp_service_group, coroutine::lambda([gs = global_schema_ptr(query_schema), prv = std::move(shard_prs), cmd, timeout,
+                gt = tracing::global_trace_state_ptr(trace_state)] (replica::database& db) -> future<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>> {
+            auto trace_state = gt.get();
+            schema_ptr s = gs;
+            std::vector<foreign_ptr<lw_shared_ptr<query::result>>> ret(prv.size());
+            co_await max_concurrent_for_each(std::views::iota(size_t(0), prv.size()), read_data_multi_concurrency, [&] (size_t i) -> future<> {
+                tracing::trace(trace_state, "Start querying singular range {}", prv[i]);
+                auto [r, ht] = co_await db.query(s, *cmd, query::result_options::only_result(), dht::partition_range_vector({prv[i]}), trace_state, timeout, std::monostate());
+                ret[i] = make_foreign(std::move(r));
+            });
+            tracing::trace(trace_state, "Querying is done");
+            co_return ret;
+        }));
+        for (size_t j = 0; j < indexes.size(); ++j) {
+            results[indexes[j]] = std::move(shard_results[j]);
+        }
+    });
+    co_return results;
+}
+
 void storage_proxy::handle_read_error(std::variant<exceptions::coordinator_exception_container, std::exception_ptr> failure, bool range) {
     // All errors are handled, it's OK to discard the result.
     (void)utils::result_try([&] () -> result<> {
@@ -5828,6 +6237,211 @@ void storage_proxy::handle_read_error(std::variant<exceptions::coordinator_excep
     }));
 }
 
+bool storage_proxy::can_batch_singular_reads(const query::read_command& cmd, const dht::partition_range_vector& partition_ranges,
+        db::consistency_level cl, db::read_repair_decision repair_decision) const {
+    // A read at CL=ONE is answered by a single replica, so there are no
+    // digests to compare and nothing to repair. Partitions of such a read
+    // which are owned by the same replica can be fetched with one request,
+    // instead of a read executor (and a request) per partition.
+    if (partition_ranges.size() < 2
+            || (cl != db::consistency_level::ONE && cl != db::consistency_level::LOCAL_ONE)
+            || repair_decision != db::read_repair_decision::NONE
+            || !features().batched_singular_reads) {
+        return false;
+    }
+    auto schema = local_schema_registry().get(cmd.schema_version);
+    // Per-partition rate limiting is decided by the coordinator, separately
+    // for every partition.
+    return !cmd.allow_limit || !_db.local().can_apply_per_partition_rate_limit(*schema, db::operation_type::read);
+}
+
+// The race between the read of a batch from the replica chosen for it and
+// the speculative read of the same batch from the extra replica. The first
+// successful read wins; the batch fails only if every read sent fails.
+struct batched_read_race : public enable_lw_shared_from_this<batched_read_race> {
+    using results_type = std::vector<foreign_ptr<lw_shared_ptr<query::result>>>;
+    promise<results_type> result;
+    timer<storage_proxy::clock_type> speculate_timer;
+    unsigned pending = 0;
+    bool done = false;
+
+    void add(future<results_type> f) {
+        ++pending;
+        // The read which loses the race completes in the background.
+        (void)f.then_wrapped([self = shared_from_this()] (future<results_type> f) {
+            --self->pending;
+            if (self->done || (f.failed() && self->pending)) {
+                f.ignore_ready_future();
+                return;
+            }
+            self->done = true;
+            self->speculate_timer.cancel();
+            f.forward_to(std::move(self->result));
+        });
+    }
+};
+
+future<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>>
+storage_proxy::query_singular_batch_from(locator::host_id replica, locator::effective_replication_map_ptr erm, schema_ptr schema,
+        lw_shared_ptr<query::read_command> cmd, dht::partition_range_vector prs, tracing::trace_state_ptr trace_state,
+        clock_type::time_point timeout, fencing_token fence) {
+    // keeps sp alive for the co-routine lifetime, a read which lost the
+    // speculation race completes after the query returned
+    auto p = shared_from_this();
+
+    ++get_stats().data_read_attempts.get_ep_stat(erm->get_topology(), replica);
+    auto start = utils::latency_counter::clock::now();
+    _replica_load_tracker.on_request(replica);
+    auto f = co_await coroutine::as_future(coroutine::lambda([&] () -> future<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>> {
+        if (is_me(*erm, replica)) {
+            tracing::trace(trace_state, "read_data_multi: querying locally");
+            co_return co_await apply_fence(query_result_local_multi(erm, schema, cmd, prs, trace_state, timeout), fence, my_address());
+        }
+        co_return co_await remote().send_read_data_multi(replica, timeout, trace_state, *cmd, prs, fence);
+    }));
+    if (f.failed()) {
+        _replica_load_tracker.on_failure(replica);
+        co_await coroutine::return_exception_ptr(f.get_exception());
+    }
+    ++get_stats().data_read_completed.get_ep_stat(erm->get_topology(), replica);
+    _replica_load_tracker.on_response(replica, utils::latency_counter::clock::now() - start);
+    co_return f.get();
+}
+
+future<result<storage_proxy::coordinator_query_result>>
+storage_proxy::query_singular_batched(lw_shared_ptr<query::read_command> cmd,
+        dht::partition_range_vector partition_ranges,
+        db::consistency_level cl,
+        storage_proxy::coordinator_query_options query_options) {
+    schema_ptr schema = local_schema_registry().get(cmd->schema_version);
+    auto cf = _db.local().find_column_family(schema).shared_from_this();
+    auto erm = cf->get_effective_replication_map();
+    auto& trace_state = query_options.trace_state;
+
+    bool is_read_non_local = false;
+    replicas_per_token_range used_replicas;
+    // Indexes into partition_ranges, grouped by the replica chosen to read
+    // them and the extra replica to speculate to, if any. All the partitions
+    // of a batch are then also owned by its extra replica, so the whole batch
+    // can speculate, as the read executor of a single partition does.
+    std::map<std::pair<locator::host_id, std::optional<locator::host_id>>, std::vector<size_t>> ranges_per_replica;
+    const bool adaptive_replica_selection = _db.local().get_config().adaptive_replica_selection();
+    const auto& sr = schema->speculative_retry();
+    const bool speculate = sr.get_type() != speculative_retry::type::NONE;
+
+    for (size_t i = 0; i < partition_ranges.size(); ++i) {
+        const auto& pr = partition_ranges[i];
+        if (!pr.is_singular()) {
+            co_await coroutine::return_exception(std::runtime_error("mixed singular and non singular range are not supported"));
+        }
+        const dht::token& token = pr.start()->value().token();
+        auto token_range = dht::token_range::make_singular(token);
+        auto it = query_options.preferred_replicas.find(token_range);
+        const auto preferred = it == query_options.preferred_replicas.end()
+            ? host_id_vector_replica_set{} : (it->second | std::ranges::to<host_id_vector_replica_set>());
+
+        host_id_vector_replica_set all_replicas = get_endpoints_for_reading(schema->ks_name(), *erm, token);
+        is_read_non_local |= !all_replicas.empty() && all_replicas.front() != erm->get_topology().my_host_id();
+        // Pick the replica to read from the way the read executors do.
+        if (adaptive_replica_selection) {
+            auto local_end = std::stable_partition(all_replicas.begin(), all_replicas.end(), erm->get_topology().get_local_dc_filter());
+            _replica_load_tracker.sort_by_score(std::span(all_replicas.begin(), local_end));
+        }
+        std::optional<locator::host_id> extra_replica;
+        host_id_vector_replica_set target_replicas = filter_replicas_for_read(cl, *erm, all_replicas, preferred,
+                db::read_repair_decision::NONE, speculate ? &extra_replica : nullptr,
+                !adaptive_replica_selection && _db.local().get_config().cache_hit_rate_read_balancing() ? &*cf : nullptr);
+        try {
+            db::assure_sufficient_live_nodes(cl, *erm, target_replicas, host_id_vector_topology_change{});
+        } catch (exceptions::unavailable_exception& ex) {
+            slogger.debug("Read unavailable: cl={} required {} alive {}", ex.consistency, ex.required, ex.alive);
+            get_stats().read_unavailables.mark();
+            throw;
+        }
+        ranges_per_replica[{target_replicas.front(), extra_replica}].push_back(i);
+        used_replicas.emplace(std::move(token_range), std::vector<locator::host_id>{target_replicas.front()});
+    }
+    if (is_read_non_local) {
+        get_stats().reads_coordinator_outside_replica_set++;
+    }
+    tracing::trace(trace_state, "Reading {} partitions in {} batches", partition_ranges.size(), ranges_per_replica.size());
+
+    // keeps sp alive for the co-routine lifetime
+    auto p = shared_from_this();
+
+    const auto timeout = query_options.timeout(*this);
+    const auto fence = get_fence(*erm);
+    std::vector<foreign_ptr<lw_shared_ptr<query::result>>> results(partition_ranges.size());
+    // The latency of every partition is the latency of the request which read it.
+    std::vector<utils::latency_counter::clock::duration> latencies(partition_ranges.size());
+    // Computed as by speculating_read_executor; zero for ALWAYS.
+    const auto speculate_after = sr.get_type() == speculative_retry::type::ALWAYS ? std::chrono::milliseconds(0)
+        : sr.get_type() == speculative_retry::type::PERCENTILE
+            ? std::min(cf->get_coordinator_read_latency_percentile(sr.get_value()), std::chrono::milliseconds(_db.local().get_config().read_request_timeout_in_ms()/2))
+            : std::chrono::milliseconds(unsigned(sr.get_value()));
+
+    auto f = co_await coroutine::as_future(coroutine::parallel_for_each(ranges_per_replica, [&] (const auto& replicas_and_ranges) -> future<> {
+        auto& [replicas, indexes] = replicas_and_ranges;
+        auto& [replica, extra_replica] = replicas;
+        auto prs = indexes | std::views::transform([&] (size_t i) { return partition_ranges[i]; }) | std::ranges::to<dht::partition_range_vector>();
+        get_stats().batched_data_reads++;
+        get_stats().batched_data_read_partitions += prs.size();
+        auto start = utils::latency_counter::clock::now();
+        std::vector<foreign_ptr<lw_shared_ptr<query::result>>> replica_results;
+        if (!extra_replica) {
+            replica_results = co_await query_singular_batch_from(replica, erm, schema, cmd, std::move(prs), trace_state, timeout, fence);
+        } else {
+            // If the replica doesn't answer in time, read the whole batch
+            // from the extra replica too, and take the first answer.
+            auto race = make_lw_shared<batched_read_race>();
+            race->speculate_timer.set_callback([this, race = race.get(), extra = *extra_replica, erm, schema, cmd, prs, trace_state, timeout, fence] {
+                if (!race->done) {
+                    get_stats().speculative_data_reads++;
+                    tracing::trace(trace_state, "Launching speculative retry for data of {} partitions", prs.size());
+                    race->add(query_singular_batch_from(extra, erm, schema, cmd, prs, trace_state, timeout, fence));
+                }
+            });
+            race->speculate_timer.arm(speculate_after);
+            race->add(query_singular_batch_from(replica, erm, schema, cmd, prs, trace_state, timeout, fence));
+            replica_results = co_await race->result.get_future();
+        }
+        auto latency = utils::latency_counter::clock::now() - start;
+        for (size_t j = 0; j < indexes.size(); ++j) {
+            results[indexes[j]] = std::move(replica_results[j]);
+            latencies[indexes[j]] = latency;
+        }
+    }));
+
+    if (f.failed()) {
+        auto eptr = f.get_exception();
+        // Report the failure the way the read executor of a single partition does.
+        exceptions::coordinator_exception_container error;
+        if (try_catch<rpc::timeout_error>(eptr) || try_catch<seastar::timed_out_error>(eptr)) {
+            error = read_timeout_exception(schema->ks_name(), schema->cf_name(), cl, 0, 1, false);
+        } else if (try_catch<replica::rate_limit_exception>(eptr)) {
+            error = exceptions::rate_limit_exception(schema->ks_name(), schema->cf_name(), db::operation_type::read, false);
+        } else {
+            slogger.debug("Batched read of {} partitions failed: {}", partition_ranges.size(), eptr);
+            error = read_failure_exception(schema->ks_name(), schema->cf_name(), cl, 0, 1, 1, false);
+        }
+        handle_read_error(error.clone(), false);
+        co_return bo::failure(std::move(error));
+    }
+    // One sample per partition, as the per-partition executors record,
+    // to keep the histogram the percentile speculative retry relies on intact.
+    for (auto latency : latencies) {
+        cf->add_coordinator_read_latency(latency);
+    }
+
+    // Reassemble the results in the order of the requested ranges.
+    query::result_merger merger(cmd->get_row_limit(), cmd->partition_limit);
+    merger.reserve(results.size());
+    for (auto& r : results) {
+        merger(std::move(r));
+    }
+    co_return coordinator_query_result(merger.get(), std::move(used_replicas), db::read_repair_decision::NONE);
+}
+
 future<result<storage_proxy::coordinator_query_result>>
 storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
         dht::partition_range_vector&& partition_ranges,
@@ -5844,6 +6458,10 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
     db::read_repair_decision repair_decision = query_options.read_repair_decision
         ? *query_options.read_repair_decision : db::read_repair_decision::NONE;
 
+    if (can_batch_singular_reads(*cmd, partition_ranges, cl, repair_decision)) {
+        co_return co_await query_singular_batched(std::move(cmd), std::move(partition_ranges), cl, std::move(query_options));
+    }
+
     // Update reads_coordinator_outside_replica_set once per request,
     // not once per partition.
     bool is_read_non_local = false;
@@ -6509,6 +7127,10 @@ future<bool> storage_proxy::cas(schema_ptr schema, shared_ptr<cas_request> reque
 
             auto mutation = request->apply(std::move(qr), cmd->slice, utils::UUID_gen::micros_timestamp(ballot));
             condition_met = true;
+            // The consistency level the decision of this round is learned with.
+            // Decided anew in every round, as a round which doesn't write may be
+            // pre-empted and followed by one which does.
+            auto round_cl_for_learn = cl_for_learn;
             if (!mutation) {
                 if (write) {
                     paxos::paxos_state::logger.debug("CAS[{}] precondition does not match current values", handler->id());
@@ -6522,16 +7144,34 @@ future<bool> storage_proxy::cas(schema_ptr schema, shared_ptr<cas_request> reque
                 // Let's use empty mutation as a value and proceed
                 mutation.emplace(handler->schema(), handler->key());
                 // since the value we are writing is dummy we may use minimal consistency level for learn
-                handler->set_cl_for_learn(db::consistency_level::ANY);
+                round_cl_for_learn = db::consistency_level::ANY;
             } else {
                 paxos::paxos_state::logger.debug("CAS[{}] precondition is met; proposing client-requested updates for {}",
                         handler->id(), ballot);
                 tracing::trace(handler->tr_state, "CAS precondition is met; proposing client-requested updates for {}", ballot);
             }
 
+            handler->set_cl_for_learn(round_cl_for_learn);
+
             auto proposal = make_lw_shared<paxos::proposal>(ballot, freeze(*mutation));
 
+            co_await utils::get_local_injector().inject("cas_wait_before_accept", [] (auto& injection) -> future<> {
+                paxos::paxos_state::logger.info("cas_wait_before_accept: waiting");
+                co_await injection.wait_for_message(std::chrono::steady_clock::now() + std::chrono::minutes{1});
+            });
+
             bool is_accepted = co_await handler->accept_proposal(proposal);
+            if (is_accepted && round_cl_for_learn == db::consistency_level::ANY
+                    && _db.local().get_config().lwt_background_learn()) {
+                // The decision is accepted by a quorum, which is all that
+                // learning with ANY promises, so don't make the client wait
+                // for it. If the learn doesn't complete, the next paxos
+                // round on the key finds the decision and repairs it.
+                paxos::paxos_state::logger.debug("CAS[{}] successful, learning the decision in the background", handler->id());
+                tracing::trace(handler->tr_state, "CAS successful, learning the decision in the background");
+                handler->learn_decision_in_background(std::move(proposal), std::move(l));
+                break;
+            }
             if (is_accepted) {
                 // The majority (aka a QUORUM) has promised the coordinator to
                 // accept the action associated with the computed ballot.
@@ -33,6 +33,7 @@
 #include "utils/phased_barrier.hh"
 #include "utils/small_vector.hh"
 #include "service/endpoint_lifecycle_subscriber.hh"
+#include "service/replica_load_tracker.hh"
 #include <seastar/core/circular_buffer.hh>
 #include "exceptions/coordinator_result.hh"
 #include "replica/exceptions.hh"
@@ -296,6 +297,8 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
             lw_shared_ptr<cdc::operation_result_tracker>> _mutate_stage;
     db::view::node_update_backlog& _max_view_update_backlog;
     std::unordered_map<locator::host_id, view_update_backlog_timestamped> _view_update_backlogs;
+    // The load of the replicas, as seen by this coordinator shard, for adaptive replica selection.
+    replica_load_tracker _replica_load_tracker;
 
     //NOTICE(sarna): This opaque pointer is here just to avoid moving write handler class definitions from .cc to .hh. It's slow path.
     class cancellable_write_handlers_list;
@@ -326,6 +329,21 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
             dht::partition_range_vector&& partition_ranges,
             db::consistency_level cl,
             coordinator_query_options optional_params);
+    bool can_batch_singular_reads(const query::read_command& cmd, const dht::partition_range_vector& partition_ranges,
+            db::consistency_level cl, db::read_repair_decision repair_decision) const;
+    future<result<coordinator_query_result>> query_singular_batched(lw_shared_ptr<query::read_command> cmd,
+            dht::partition_range_vector partition_ranges,
+            db::consistency_level cl,
+            coordinator_query_options optional_params);
+    // Reads the partitions of a batch of a batched singular read from the given replica.
+    future<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>> query_singular_batch_from(locator::host_id replica,
+            locator::effective_replication_map_ptr erm,
+            schema_ptr schema,
+            lw_shared_ptr<query::read_command> cmd,
+            dht::partition_range_vector prs,
+            tracing::trace_state_ptr trace_state,
+            clock_type::time_point timeout,
+            fencing_token fence);
     response_id_type register_response_handler(shared_ptr<abstract_write_response_handler>&& h);
     void remove_response_handler(response_id_type id);
     void remove_response_handler_entry(response_handlers_map::iterator entry);
@@ -381,6 +399,15 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
             tracing::trace_state_ptr trace_state,
             clock_type::time_point timeout,
             db::per_partition_rate_limit::info rate_limit_info);
+    // Reads every singular range of `prs` on the shard owning it, returning
+    // the results in the order of `prs`.
+    future<std::vector<foreign_ptr<lw_shared_ptr<query::result>>>> query_result_local_multi(
+            locator::effective_replication_map_ptr,
+            schema_ptr,
+            lw_shared_ptr<query::read_command> cmd,
+            const dht::partition_range_vector& prs,
+            tracing::trace_state_ptr trace_state,
+            clock_type::time_point timeout);
     future<rpc::tuple<query::result_digest, api::timestamp_type, cache_temperature, std::optional<full_position>>> query_result_local_digest(
             locator::effective_replication_map_ptr,
             schema_ptr,
@@ -525,6 +552,12 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
 private:
     bool only_me(const locator::effective_replication_map& erm, const host_id_vector_replica_set& replicas) const noexcept;
 
+    // Whether requests are sent to replicas over connections to the shards
+    // which own the data, see the enable_shard_aware_rpc_connections option.
+    bool shard_aware_rpc_connections() const;
+    // The shard of the replica `ep` which owns `token`.
+    std::optional<unsigned> replica_shard(const locator::effective_replication_map& erm, const schema& s, dht::token token, locator::host_id ep) const;
+
     // Throws an error if remote is not initialized.
     const struct remote& remote() const;
     struct remote& remote();
@@ -730,6 +763,9 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
     cdc_stats& get_cdc_stats() {
         return _cdc_stats;
     }
+    replica_load_tracker& get_replica_load_tracker() noexcept {
+        return _replica_load_tracker;
+    }
 
     scheduling_group_key get_stats_key() const {
         return _stats_key;
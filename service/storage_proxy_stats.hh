@@ -113,6 +113,7 @@ struct write_stats {
     uint64_t cas_prune = 0;
     uint64_t cas_coordinator_dropped_prune = 0;
     uint64_t cas_replica_dropped_prune = 0;
+    uint64_t cas_background_learn = 0; // decisions learned after the client was answered
 
     seastar::metrics::metric_groups _metrics;
 
@@ -159,6 +160,7 @@ struct stats : public write_stats {
     uint64_t replica_data_reads = 0;
     uint64_t replica_digest_reads = 0;
     uint64_t replica_mutation_data_reads = 0;
+    uint64_t replica_data_multi_reads = 0;
 
     uint64_t replica_cross_shard_ops = 0;
 
@@ -171,6 +173,13 @@ struct stats : public write_stats {
     uint64_t read_retries = 0; // read is retried with new limit
     uint64_t speculative_digest_reads = 0;
     uint64_t speculative_data_reads = 0;
+    // multi-partition reads sent to a replica in a single request,
+    // and the number of partitions they covered
+    uint64_t batched_data_reads = 0;
+    uint64_t batched_data_read_partitions = 0;
+    // MUTATION_BATCH requests sent to replicas, and the number of writes they carried
+    uint64_t mutation_batches = 0;
+    uint64_t batched_mutations = 0;
 
     uint64_t cas_read_unfinished_commit = 0;
     uint64_t cas_foreground = 0;
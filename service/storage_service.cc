@@ -64,6 +64,7 @@
 #include "utils/user_provided_param.hh"
 #include "version.hh"
 #include "dht/range_streamer.hh"
+#include "streaming/stream_manager.hh"
 #include <boost/range/algorithm.hpp>
 #include <boost/range/join.hpp>
 #include "transport/server.hh"
@@ -6100,27 +6101,53 @@ future<> storage_service::stream_tablet(locator::global_tablet_id tablet) {
                 return handler.wait_for_message(db::timeout_clock::now() + std::chrono::minutes(2));
             });
             auto& table = _db.local().find_column_family(tablet.table);
-            std::vector<sstring> tables = {table.schema()->cf_name()};
-            auto my_id = tm->get_my_id();
-            auto streamer = make_lw_shared<dht::range_streamer>(_db, _stream_manager, std::move(tm),
-                                                                guard.get_abort_source(),
-                                                                my_id, _snitch.local()->get_location(),
-                                                                format("Tablet {}", trinfo->transition),
-                                                                reason,
-                                                                topo_guard,
-                                                                std::move(tables));
-            tm = nullptr;
-            streamer->add_source_filter(std::make_unique<dht::range_streamer::failure_detector_source_filter>(
-                    _gossiper.get_unreachable_host_ids()));
 
-            std::unordered_map<locator::host_id, dht::token_range_vector> ranges_per_endpoint;
-            for (auto r: streaming_info.read_from) {
-                ranges_per_endpoint[r.host].emplace_back(range);
+            // The sstables of the leaving replica can be attached to the pending replica as they are,
+            // unless they need to go through view building on the way.
+            bool streamed_files = false;
+            if (reason == streaming::stream_reason::tablet_migration && leaving_replica
+                    && streaming_info.read_from == std::unordered_set<locator::tablet_replica>{*leaving_replica}
+                    && table.views().empty()
+                    && _feature_service.file_stream && _db.local().get_config().enable_file_stream()) {
+                auto req = streaming::tablet_stream_files_request{
+                    .ops_id = streaming::plan_id::create_random_id(),
+                    .table = tablet.table,
+                    .range = range,
+                    .src_shard = leaving_replica->shard,
+                    .dst_shard = pending_replica->shard,
+                    .session = topo_guard,
+                };
+                streamed_files = co_await _stream_manager.local().stream_tablet_files(leaving_replica->host, std::move(req), guard.get_abort_source());
+                if (streamed_files) {
+                    slogger.info("File streaming for tablet migration of {} finished table={}.{} range={}", tablet, table.schema()->ks_name(), table.schema()->cf_name(), range);
+                } else {
+                    slogger.info("File streaming for tablet migration of {} isn't possible, streaming mutations instead", tablet);
+                }
+            }
+
+            if (!streamed_files) {
+                std::vector<sstring> tables = {table.schema()->cf_name()};
+                auto my_id = tm->get_my_id();
+                auto streamer = make_lw_shared<dht::range_streamer>(_db, _stream_manager, std::move(tm),
+                                                                    guard.get_abort_source(),
+                                                                    my_id, _snitch.local()->get_location(),
+                                                                    format("Tablet {}", trinfo->transition),
+                                                                    reason,
+                                                                    topo_guard,
+                                                                    std::move(tables));
+                tm = nullptr;
+                streamer->add_source_filter(std::make_unique<dht::range_streamer::failure_detector_source_filter>(
+                        _gossiper.get_unreachable_host_ids()));
+
+                std::unordered_map<locator::host_id, dht::token_range_vector> ranges_per_endpoint;
+                for (auto r: streaming_info.read_from) {
+                    ranges_per_endpoint[r.host].emplace_back(range);
+                }
+                streamer->add_rx_ranges(table.schema()->ks_name(), std::move(ranges_per_endpoint));
+                slogger.debug("Streaming for tablet migration of {} started table={}.{} range={}", tablet, table.schema()->ks_name(), table.schema()->cf_name(), range);
+                co_await streamer->stream_async();
+                slogger.info("Streaming for tablet migration of {} finished table={}.{} range={}", tablet, table.schema()->ks_name(), table.schema()->cf_name(), range);
             }
-            streamer->add_rx_ranges(table.schema()->ks_name(), std::move(ranges_per_endpoint));
-            slogger.debug("Streaming for tablet migration of {} started table={}.{} range={}", tablet, table.schema()->ks_name(), table.schema()->cf_name(), range);
-            co_await streamer->stream_async();
-            slogger.info("Streaming for tablet migration of {} finished table={}.{} range={}", tablet, table.schema()->ks_name(), table.schema()->cf_name(), range);
         }
 
         // If new pending tablet replica needs splitting, streaming waits for it to complete.
@@ -6575,6 +6602,7 @@ future<locator::load_stats> storage_service::load_stats_for_tablet_based_tables(
             };
 
             load_stats.tables.emplace(id, table->table_load_stats(tablet_filter));
+            table->tablet_load_stats(tablet_filter, load_stats.tablets);
             co_await coroutine::maybe_yield();
         }
 
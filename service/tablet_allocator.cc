@@ -356,6 +356,9 @@ class load_balancer {
 
         absl::flat_hash_map<table_id, size_t> tablet_count_per_table;
 
+        // Sum of the measured load of tablet replicas on this shard, see tablet_load().
+        double load = 0;
+
         // Number of tablets which are streamed from this shard.
         size_t streaming_read_load = 0;
 
@@ -486,16 +489,38 @@ class load_balancer {
         return double(max_tablet_size / 2) * 0.5;
     }
 
+    // Tablets with lower measured load than this never drive resize decisions, so that noise
+    // in the load of an idle cluster doesn't cause splits.
+    static constexpr double min_hot_tablet_load = 100;
+
     struct table_size_desc {
         uint64_t target_max_tablet_size;
         uint64_t avg_tablet_size;
         locator::resize_decision resize_decision;
         size_t tablet_count;
         size_t shard_count;
+        // The highest measured load of a tablet replica of the table, and the average load of
+        // a shard in the cluster, see tablet_load().
+        double max_tablet_load = 0;
+        double avg_shard_load = 0;
+        size_t total_shard_count = 0;
 
         uint64_t target_min_tablet_size() const noexcept {
             return load_balancer::target_min_tablet_size(target_max_tablet_size);
         }
+
+        // A tablet of the table puts more load on its shard than an average shard has, so no
+        // placement of tablets can balance the load. Splitting spreads it over more shards,
+        // which is worth it until the table has a tablet per shard.
+        bool hot() const noexcept {
+            return max_tablet_load >= min_hot_tablet_load && max_tablet_load > avg_shard_load
+                    && tablet_count < total_shard_count;
+        }
+
+        // Merging would make a tablet hot.
+        bool too_hot_to_merge() const noexcept {
+            return max_tablet_load * 2 >= min_hot_tablet_load && max_tablet_load * 2 > avg_shard_load;
+        }
     };
 
     struct cluster_resize_load {
@@ -513,10 +538,10 @@ class load_balancer {
             bool left_growing_mode = !d.resize_decision.initial_decision();
             lblogger.debug("table_needs_merge: tablet_count={}, avg_tablet_size={}, left_growing_mode={} (seq number: {})",
                            d.tablet_count, d.avg_tablet_size, left_growing_mode, d.resize_decision.sequence_number);
-            return left_growing_mode && d.tablet_count > 1 && d.avg_tablet_size < d.target_min_tablet_size();
+            return left_growing_mode && d.tablet_count > 1 && d.avg_tablet_size < d.target_min_tablet_size() && !d.too_hot_to_merge();
         }
         static bool table_needs_split(const table_size_desc& d) {
-            return d.avg_tablet_size > d.target_max_tablet_size;
+            return d.avg_tablet_size > d.target_max_tablet_size || d.hot();
         }
 
         bool table_needs_resize(const table_size_desc& d) const {
@@ -531,9 +556,9 @@ class load_balancer {
         bool table_needs_resize_cancellation(const table_size_desc& d) const {
             auto& way = d.resize_decision.way;
             if (std::holds_alternative<locator::resize_decision::split>(way)) {
-                return d.avg_tablet_size < d.target_max_tablet_size / 2;
+                return d.avg_tablet_size < d.target_max_tablet_size / 2 && !d.hot();
             } else if (std::holds_alternative<locator::resize_decision::merge>(way)) {
-                return d.avg_tablet_size > d.target_min_tablet_size() * 2;
+                return d.avg_tablet_size > d.target_min_tablet_size() * 2 || d.too_hot_to_merge();
             }
             return false;
         }
@@ -560,7 +585,9 @@ class load_balancer {
             return [] (const table_id_and_size_desc& a, const table_id_and_size_desc& b) {
                 auto urgency = [] (const table_size_desc& d) -> double {
                     // FIXME: only takes into account split today.
-                    return double(d.avg_tablet_size) / d.target_max_tablet_size;
+                    auto size_urgency = double(d.avg_tablet_size) / d.target_max_tablet_size;
+                    auto load_urgency = d.hot() ? d.max_tablet_load / d.avg_shard_load : 0;
+                    return std::max(size_urgency, load_urgency);
                 };
                 return urgency(a.second) < urgency(b.second);
             };
@@ -733,6 +760,28 @@ class load_balancer {
         return (it != _table_load_stats->tables.end()) ? &it->second : nullptr;
     }
 
+    // The load a replica of the tablet puts on its shard, measured from the rates of requests it serves.
+    // Zero if not known.
+    double tablet_load(global_tablet_id tablet) const {
+        if (!_table_load_stats) {
+            return 0;
+        }
+        auto it = _table_load_stats->tablets.find(tablet);
+        return (it != _table_load_stats->tablets.end()) ? it->second.load() : 0;
+    }
+
+    double tablet_load(const migration_tablet_set& tablet_set) const {
+        double load = 0;
+        for (auto tablet : tablet_set.tablets()) {
+            load += tablet_load(tablet);
+        }
+        return load;
+    }
+
+    bool has_tablet_load() const {
+        return _table_load_stats && !_table_load_stats->tablets.empty();
+    }
+
     future<bool> needs_auto_repair(const locator::global_tablet_id& gid, const locator::tablet_info& info,
             const locator::repair_scheduler_config& config, const db_clock::time_point& now, db_clock::duration& diff) {
         co_return false;
@@ -1067,6 +1116,31 @@ class load_balancer {
 
         cluster_resize_load resize_load;
 
+        size_t total_shard_count = std::invoke([this] {
+            size_t shard_count = 0;
+            _tm->for_each_token_owner([&] (const locator::node& node) {
+                shard_count += node.get_shard_count();
+            });
+            return shard_count;
+        });
+
+        // Hot tablets are split to spread their load, see table_size_desc::hot().
+        double total_load = 0;
+        std::unordered_map<table_id, double> max_tablet_load;
+        if (_table_load_stats) {
+            for (auto&& [tablet, stats] : _table_load_stats->tablets) {
+                co_await coroutine::maybe_yield();
+                auto it = _tm->tablets().all_tables().find(tablet.table);
+                if (it == _tm->tablets().all_tables().end() || tablet.tablet.value() >= it->second->tablet_count()) {
+                    continue;
+                }
+                auto load = stats.load();
+                total_load += load * it->second->get_tablet_info(tablet.tablet).replicas.size();
+                max_tablet_load[tablet.table] = std::max(max_tablet_load[tablet.table], load);
+            }
+        }
+        double avg_shard_load = total_load / std::max(total_shard_count, size_t(1));
+
         for (auto&& [table, tmap_] : _tm->tablets().all_tables()) {
             auto& tmap = *tmap_;
 
@@ -1087,11 +1161,15 @@ class load_balancer {
                 .avg_tablet_size = avg_tablet_size,
                 .resize_decision = tmap.resize_decision(),
                 .tablet_count = tmap.tablet_count(),
-                .shard_count = shard_count
+                .shard_count = shard_count,
+                .max_tablet_load = max_tablet_load[table],
+                .avg_shard_load = avg_shard_load,
+                .total_shard_count = total_shard_count,
             };
 
             resize_load.update(table, std::move(size_desc));
-            lblogger.info("Table {} with tablet_count={} has an average tablet size of {}", table, tmap.tablet_count(), avg_tablet_size);
+            lblogger.info("Table {} with tablet_count={} has an average tablet size of {} and a max tablet load of {} (avg shard load: {})",
+                          table, tmap.tablet_count(), avg_tablet_size, max_tablet_load[table], avg_shard_load);
             co_await coroutine::maybe_yield();
         }
 
@@ -1101,13 +1179,6 @@ class load_balancer {
         // If tables still have a low tablet count, the concurrency must be high in order to saturate the cluster.
         // If a table covers the entire cluster, and needs split, concurrency will be reduced to 1.
 
-        size_t total_shard_count = std::invoke([this] {
-            size_t shard_count = 0;
-            _tm->for_each_token_owner([&] (const locator::node& node) {
-                shard_count += node.get_shard_count();
-            });
-            return shard_count;
-        });
         size_t resizing_shard_count = std::accumulate(resize_load.tables_being_resized.begin(), resize_load.tables_being_resized.end(), size_t(0),
              [] (size_t shard_count, const auto& table_desc) {
                  return shard_count + table_desc.second.shard_count;
@@ -1126,8 +1197,8 @@ class load_balancer {
             }
 
             auto resize_decision = cluster_resize_load::to_resize_decision(size_desc);
-            lblogger.info("Emitting resize decision of type {} for table {} due to avg tablet size of {}",
-                          resize_decision.type_name(), table, size_desc.avg_tablet_size);
+            lblogger.info("Emitting resize decision of type {} for table {} due to avg tablet size of {} and max tablet load of {}",
+                          resize_decision.type_name(), table, size_desc.avg_tablet_size, size_desc.max_tablet_load);
             resize_plan.resize[table] = std::move(resize_decision);
             _stats.for_cluster().resizes_emitted++;
 
@@ -1144,7 +1215,8 @@ class load_balancer {
             if (resize_load.table_needs_resize_cancellation(size_desc)) {
                 resize_plan.resize[table] = cluster_resize_load::revoke_resize_decision();
                 _stats.for_cluster().resizes_revoked++;
-                lblogger.info("Revoking resize decision for table {} due to avg tablet size of {}", table, size_desc.avg_tablet_size);
+                lblogger.info("Revoking resize decision for table {} due to avg tablet size of {} and max tablet load of {}",
+                              table, size_desc.avg_tablet_size, size_desc.max_tablet_load);
                 continue;
             }
 
@@ -1377,7 +1449,7 @@ class load_balancer {
         for (auto&& [table, tablets] : shard_info.candidates) {
             if (!tablets.empty()) {
                 auto badness = evaluate_candidate(nodes, table, src, dst);
-                auto candidate = migration_candidate{*tablets.begin(), src, dst, badness};
+                auto candidate = migration_candidate{pick_candidate_by_load(nodes, tablets, src, dst), src, dst, badness};
                 lblogger.trace("Candidate: {}", candidate);
                 if (!best_candidate || candidate.badness < best_candidate->badness) {
                     best_candidate = candidate;
@@ -1393,6 +1465,21 @@ class load_balancer {
         co_return *best_candidate;
     }
 
+    // Picks the tablet whose migration from src to dst evens out the measured load of the two shards the most,
+    // that is the one whose load is the closest to half of the difference of their loads.
+    // All candidates of a table are equally good for balancing the tablet count.
+    migration_tablet_set pick_candidate_by_load(node_load_map& nodes, const std::unordered_set<migration_tablet_set>& tablets,
+                                                tablet_replica src, tablet_replica dst) {
+        if (!has_tablet_load()) {
+            return *tablets.begin();
+        }
+        auto desired_load = (nodes[src.host].shards[src.shard].load - nodes[dst.host].shards[dst.shard].load) / 2;
+        auto distance = [&] (const migration_tablet_set& t) {
+            return std::abs(tablet_load(t) - desired_load);
+        };
+        return *std::ranges::min_element(tablets, std::less<double>(), distance);
+    }
+
     void erase_candidate(shard_load& shard_info, migration_tablet_set tablets) {
         if (_use_table_aware_balancing) {
             auto table = tablets.table();
@@ -1493,6 +1580,9 @@ class load_balancer {
         src_info.tablet_count--;
         dst_info.tablet_count_per_table[tablet.table]++;
         src_info.tablet_count_per_table[tablet.table]--;
+        auto load = tablet_load(tablet);
+        dst_info.load += load;
+        src_info.load -= load;
     }
 
     // Adjusts the load of the source and destination (host:shard) that were picked for the migration.
@@ -1501,6 +1591,7 @@ class load_balancer {
             auto& target_info = nodes[dst.host];
             target_info.shards[dst.shard].tablet_count++;
             target_info.shards[dst.shard].tablet_count_per_table[source_tablet.table]++;
+            target_info.shards[dst.shard].load += tablet_load(source_tablet);
             target_info.tablet_count_per_table[source_tablet.table]++;
             target_info.tablet_count += 1;
             target_info.update();
@@ -1510,6 +1601,7 @@ class load_balancer {
         auto& src_shard_info = src_node_info.shards[src.shard];
         src_shard_info.tablet_count -= 1;
         src_shard_info.tablet_count_per_table[source_tablet.table]--;
+        src_shard_info.load -= tablet_load(source_tablet);
         src_node_info.tablet_count_per_table[source_tablet.table]--;
 
         src_node_info.tablet_count -= 1;
@@ -1561,6 +1653,7 @@ class load_balancer {
         std::make_heap(src_shards.begin(), src_shards.end(), node_load.shards_by_load_cmp());
 
         size_t max_load = 0; // Tracks max load among shards which ran out of candidates.
+        bool balanced = false;
 
         while (true) {
             co_await coroutine::maybe_yield();
@@ -1603,6 +1696,7 @@ class load_balancer {
             // When in shuffle mode, exit condition is guaranteed by running out of candidates or by load limit.
             if (!shuffle && (src == dst || !check_convergence(src_info, dst_info))) {
                 lblogger.debug("Node {} is balanced", host);
+                balanced = true;
                 break;
             }
 
@@ -1620,6 +1714,7 @@ class load_balancer {
             // Recheck convergence to avoid oscillations if co-located tablets are being migrated together.
             if (!shuffle && (src == dst || !check_convergence(src_info, dst_info, tablets))) {
                 lblogger.debug("Node {} is balanced", host);
+                balanced = true;
                 break;
             }
 
@@ -1649,6 +1744,133 @@ class load_balancer {
             sketch.unload(host, src);
         }
 
+        if (balanced && has_tablet_load()) {
+            plan.merge(co_await make_node_load_plan(nodes, host, node_load));
+        }
+
+        co_return plan;
+    }
+
+    // Shards of a node are balanced in terms of measured load if the difference between the loads
+    // of the most and the least loaded shard is within this fraction of the average shard load.
+    static constexpr double max_shard_load_imbalance = 0.2;
+
+    // Evens out the measured load of shards of a node which is balanced in terms of tablet count.
+    // The most loaded shard swaps a tablet with a less loaded tablet of the least loaded shard, which
+    // keeps tablet counts intact, so that it doesn't go against convergence of balancing tablet counts.
+    // Every swap reduces the sum of squares of shard loads, so this converges too, as long as the
+    // measured load doesn't change.
+    future<migration_plan> make_node_load_plan(node_load_map& nodes, host_id host, node_load& node_load) {
+        migration_plan plan;
+        const tablet_metadata& tmeta = _tm->tablets();
+        auto& sketch = *_load_sketch;
+
+        double total_load = 0;
+        for (auto& shard : node_load.shards) {
+            total_load += shard.load;
+        }
+        auto min_gain = total_load / node_load.shard_count * max_shard_load_imbalance / 2;
+
+        auto single_tablet_candidates = [&] (shard_load& shard_info) {
+            std::vector<std::pair<double, migration_tablet_set>> result;
+            auto add = [&] (const std::unordered_set<migration_tablet_set>& tablets) {
+                for (auto& t : tablets) {
+                    // Co-located sibling tablets are skipped, so that swaps keep tablet counts intact.
+                    if (t.tablets().size() == 1) {
+                        result.emplace_back(tablet_load(t), t);
+                    }
+                }
+            };
+            for (auto& [table, tablets] : shard_info.candidates) {
+                add(tablets);
+            }
+            add(shard_info.candidates_all_tables);
+            std::ranges::sort(result, std::less<double>(), [] (const auto& c) { return c.first; });
+            return result;
+        };
+
+        while (true) {
+            co_await coroutine::maybe_yield();
+
+            auto by_load = [&] (shard_id a, shard_id b) {
+                return node_load.shards[a].load < node_load.shards[b].load;
+            };
+            auto shards = std::views::iota(shard_id(0), shard_id(node_load.shard_count));
+            auto [dst, src] = std::ranges::minmax(shards, by_load);
+            auto& src_info = node_load.shards[src];
+            auto& dst_info = node_load.shards[dst];
+            auto imbalance = src_info.load - dst_info.load;
+
+            if (imbalance <= min_gain * 2) {
+                lblogger.debug("Node {} is balanced in terms of load", host);
+                break;
+            }
+
+            // Moving a tablet of load a from src to dst and a tablet of load b back changes the loads by
+            // d = a - b, which evens them out the most when d is closest to half of the imbalance.
+            auto src_candidates = single_tablet_candidates(src_info);
+            auto dst_candidates = single_tablet_candidates(dst_info);
+            std::optional<std::pair<migration_tablet_set, migration_tablet_set>> best;
+            double best_gain = min_gain;
+            for (auto& [a, a_tablets] : src_candidates) {
+                auto b_it = std::ranges::lower_bound(dst_candidates, a - imbalance / 2, std::less<double>(),
+                                                     [] (const auto& c) { return c.first; });
+                for (auto it : {b_it, b_it == dst_candidates.begin() ? b_it : std::prev(b_it)}) {
+                    if (it == dst_candidates.end()) {
+                        continue;
+                    }
+                    auto d = a - it->first;
+                    // The reduction of the load of the more loaded shard of the two.
+                    auto gain = std::min(d, imbalance - d);
+                    if (gain > best_gain) {
+                        best_gain = gain;
+                        best = std::make_pair(a_tablets, it->second);
+                    }
+                }
+                co_await coroutine::maybe_yield();
+            }
+
+            if (!best) {
+                lblogger.debug("Unable to balance load of node {}: no tablets to swap between shards {} (load={}) and {} (load={})",
+                               host, src, src_info.load, dst, dst_info.load);
+                break;
+            }
+
+            auto& [to_dst, to_src] = *best;
+            auto to_dst_mig = get_migration_info(to_dst, tablet_transition_kind::intranode_migration,
+                                                 tablet_replica{host, src}, tablet_replica{host, dst});
+            auto to_src_mig = get_migration_info(to_src, tablet_transition_kind::intranode_migration,
+                                                 tablet_replica{host, dst}, tablet_replica{host, src});
+            auto& to_dst_tmap = tmeta.get_tablet_map(to_dst.table());
+            auto& to_src_tmap = tmeta.get_tablet_map(to_src.table());
+            auto to_dst_streaming_info = get_migration_streaming_infos(_tm->get_topology(), to_dst_tmap, to_dst_mig);
+            auto to_src_streaming_info = get_migration_streaming_infos(_tm->get_topology(), to_src_tmap, to_src_mig);
+
+            if (!can_accept_load(nodes, to_dst_streaming_info) || !can_accept_load(nodes, to_src_streaming_info)) {
+                _stats.for_dc(node_load.dc()).migrations_skipped++;
+                lblogger.debug("Unable to balance load of {}: load limit reached", host);
+                break;
+            }
+
+            lblogger.debug("Swapping tablets {} (load={}) and {} (load={}) between shards {} (load={}) and {} (load={}) of {}",
+                           to_dst, tablet_load(to_dst), to_src, tablet_load(to_src), src, src_info.load, dst, dst_info.load, host);
+
+            auto emit = [&] (migration_vector mig, const migration_streaming_info_vector& streaming_info,
+                             const tablet_map& tmap, const migration_tablet_set& tablets, shard_id from, shard_id to) {
+                apply_load(nodes, streaming_info);
+                lblogger.debug("Adding migration: {}", mig);
+                _stats.for_dc(node_load.dc()).migrations_produced++;
+                _stats.for_dc(node_load.dc()).intranode_migrations_produced++;
+                plan.add(std::move(mig));
+                erase_candidates(nodes, tmap, tablets);
+                update_node_load_on_migration(node_load, host, from, to, tablets);
+                sketch.pick(host, to);
+                sketch.unload(host, from);
+            };
+            emit(std::move(to_dst_mig), to_dst_streaming_info, to_dst_tmap, to_dst, src, dst);
+            emit(std::move(to_src_mig), to_src_streaming_info, to_src_tmap, to_src, dst, src);
+        }
+
         co_return plan;
     }
 
@@ -2631,6 +2853,9 @@ class load_balancer {
                     }
                     shard_load_info.tablet_count += tids.size();
                     shard_load_info.tablet_count_per_table[table] += tids.size();
+                    for (auto tid : tids) {
+                        shard_load_info.load += tablet_load(global_tablet_id{table, tid});
+                    }
                     node_load_info.tablet_count_per_table[table] += tids.size();
                     total_load += tids.size();
                     if (tmap.needs_merge() && tids.size() == 2) {
@@ -2984,6 +2984,24 @@ future<locator::load_stats> topology_coordinator::refresh_tablet_load_stats() {
         // the average tablet size by dividing total size by tablet count.
         table_load_stats.size_in_bytes /= table_total_replicas;
     }
+    for (auto& [tablet, tablet_stats] : stats.tablets) {
+        co_await coroutine::maybe_yield();
+
+        // Likewise, the rates of requests of a tablet are averaged over its replicas, so the load balancer
+        // sees the load a replica puts on its shard.
+        auto it = tm->tablets().all_tables().find(tablet.table);
+        if (it == tm->tablets().all_tables().end() || tablet.tablet.value() >= it->second->tablet_count()) {
+            continue;
+        }
+        auto replicas = it->second->get_tablet_info(tablet.tablet).replicas.size();
+        if (replicas == 0) {
+            continue;
+        }
+        tablet_stats.reads /= replicas;
+        tablet_stats.writes /= replicas;
+        tablet_stats.read_bytes /= replicas;
+        tablet_stats.write_bytes /= replicas;
+    }
     rtlogger.debug("raft topology: Refreshed table load stats for all DC(s).");
 
     co_return std::move(stats);
@@ -45,10 +45,12 @@
  */
 
 #include <vector>
+#include <span>
 #include <cmath>
 #include <sstream>
 #include <stdexcept>
 #include <algorithm>
+#include <bit>
 #include <seastar/core/byteorder.hh>
 #include <seastar/core/temporary_buffer.hh>
 
@@ -153,14 +155,53 @@ class HyperLogLog {
     }
 #endif
     void offer_hashed(uint64_t hash) {
-        uint32_t index = hash >> (64 - b_);
-        uint8_t rank = rho((hash << b_), 64 - b_);
+        offer_hashed(M_, b_, hash);
+    }
 
-        if (rank > M_[index]) {
-            M_[index] = rank;
+    /**
+     * Adds a hashed element to a bare register array, as returned by
+     * registers(). Allows updating an estimator kept in serialized form
+     * without materializing a HyperLogLog object.
+     *
+     * @param[in,out] registers 2 to the b power registers
+     * @param[in] b bit width
+     * @param[in] hash hashed element
+     */
+    static void offer_hashed(std::span<uint8_t> registers, uint8_t b, uint64_t hash) {
+        uint32_t index = hash >> (64 - b);
+        uint8_t rank = rho((hash << b), 64 - b);
+
+        if (rank > registers[index]) {
+            registers[index] = rank;
         }
     }
 
+    /**
+     * Creates an estimator from a bare register array, as returned by
+     * registers().
+     *
+     * @param[in] registers registers, their count must be a power of 2
+     *
+     * @exception std::invalid_argument the register count is invalid.
+     */
+    static HyperLogLog from_registers(std::span<const uint8_t> registers) {
+        if (!std::has_single_bit(registers.size())) {
+            throw std::invalid_argument("register count must be a power of 2");
+        }
+        HyperLogLog ret(std::countr_zero(registers.size()));
+        std::copy(registers.begin(), registers.end(), ret.M_.begin());
+        return ret;
+    }
+
+    /**
+     * Returns the registers.
+     *
+     * @return Registers
+     */
+    std::span<const uint8_t> registers() const {
+        return M_;
+    }
+
     /*
      * Calculate the size of buffer returned by get_bytes().
      */
@@ -321,7 +362,7 @@ class HyperLogLog {
     double alphaMM_; ///< alpha * m^2
     std::vector<uint8_t> M_; ///< registers
 
-    uint8_t rho(uint32_t x, uint8_t b) {
+    static uint8_t rho(uint32_t x, uint8_t b) {
         uint8_t v = 1;
         while (v <= b && !(x & 0x80000000)) {
             v++;
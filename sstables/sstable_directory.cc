@@ -253,6 +253,8 @@ sstable_directory::process_descriptor(sstables::entry_descriptor desc,
     if (flags.need_mutate_level) {
         dirlog.trace("Mutating {} to level 0\n", sst->get_filename());
         co_await sst->mutate_sstable_level(0);
+        // Imported data wasn't repaired by this cluster's incremental repair.
+        co_await sst->mutate_repaired_at(0);
     }
 
     if (flags.sort_sstables_according_to_owner) {
@@ -628,10 +628,14 @@ future<> parse(const schema& schema, sstable_version_types v, random_access_read
     }
 }
 
-inline void write(sstable_version_types v, file_writer& out, const statistics& s) {
+inline void write(sstable_version_types v, file_writer& out, const statistics& s, const stats_metadata* stats = nullptr) {
     write(v, out, s.offsets);
     for (auto&& e : s.offsets.elements) {
-        s.contents.at(e.first)->write(v, out);
+        if (stats && e.first == metadata_type::Stats) {
+            stats->write(v, out);
+        } else {
+            s.contents.at(e.first)->write(v, out);
+        }
     }
 }
 
@@ -882,6 +886,19 @@ future<entry_descriptor> sstable::clone(generation_type new_generation) const {
     co_return entry_descriptor(new_generation, _version, _format, component_type::TOC, _state);
 }
 
+void sstable::open_for_copy(const std::vector<component_type>& components) {
+    _recognized_components.clear();
+    _recognized_components.insert(component_type::TOC);
+    _recognized_components.insert(components.begin(), components.end());
+    // Mark sstable for implicit deletion if destructed before it is sealed.
+    _marked_for_deletion = mark_for_deletion::implicit;
+    _storage->open(*this);
+}
+
+future<data_sink> sstable::make_component_sink(component_type c, file_output_stream_options options) {
+    return _storage->make_component_sink(*this, c, open_flags::wo | open_flags::create | open_flags::exclusive, std::move(options));
+}
+
 file_writer::~file_writer() {
     if (_closed) {
         return;
@@ -1290,7 +1307,7 @@ void sstable::write_statistics() {
     write_simple<component_type::Statistics>(_components->statistics);
 }
 
-void sstable::rewrite_statistics() {
+void sstable::rewrite_statistics(const stats_metadata* stats) {
     auto file_path = filename(component_type::TemporaryStatistics);
     sstlog.debug("Rewriting statistics component of sstable {}", get_filename());
 
@@ -1298,7 +1315,7 @@ void sstable::rewrite_statistics() {
     options.buffer_size = sstable_buffer_size;
     auto w = make_component_file_writer(component_type::TemporaryStatistics, std::move(options),
             open_flags::wo | open_flags::create | open_flags::truncate).get();
-    write(_version, w, _components->statistics);
+    write(_version, w, _components->statistics, stats);
     w.close();
     // rename() guarantees atomicity when renaming a file into place.
     sstable_write_io_check(rename_file, file_path, filename(component_type::Statistics)).get();
@@ -2806,6 +2823,36 @@ future<> sstable::mutate_sstable_level(uint32_t new_level) {
     });
 }
 
+future<> sstable::mutate_repaired_at(uint64_t repaired_at) {
+    if (!has_component(component_type::Statistics)) {
+        return make_ready_future<>();
+    }
+
+    auto entry = _components->statistics.contents.find(metadata_type::Stats);
+    if (entry == _components->statistics.contents.end()) {
+        return make_ready_future<>();
+    }
+
+    auto& p = entry->second;
+    if (!p) {
+        return make_exception_future<>(std::runtime_error("Statistics is malformed"));
+    }
+    stats_metadata& s = *static_cast<stats_metadata *>(p.get());
+    if (s.repaired_at == repaired_at) {
+        return make_ready_future<>();
+    }
+
+    sstlog.debug("set repaired_at of {} from {} to {}", get_filename(), s.repaired_at, repaired_at);
+    // The sstable is seen as repaired only once the new Statistics is in
+    // place, so that a failed rewrite leaves it unrepaired in memory too.
+    auto new_stats = s;
+    new_stats.repaired_at = repaired_at;
+    return seastar::async([this, &s, new_stats = std::move(new_stats)] {
+        rewrite_statistics(&new_stats);
+        s.repaired_at = new_stats.repaired_at;
+    });
+}
+
 int sstable::compare_by_max_timestamp(const sstable& other) const {
     auto ts1 = get_stats_metadata().max_timestamp;
     auto ts2 = other.get_stats_metadata().max_timestamp;
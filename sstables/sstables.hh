@@ -105,6 +105,8 @@ struct sstable_writer_config {
     mutation_fragment_stream_validation_level validation_level;
     std::optional<db::replay_position> replay_position;
     std::optional<int> sstable_level;
+    // See stats_metadata::repaired_at.
+    uint64_t repaired_at = 0;
     write_monitor* monitor = &default_write_monitor();
     run_id run_identifier = run_id::create_random_id();
     size_t summary_byte_cost;
@@ -384,6 +386,10 @@ class sstable : public enable_lw_shared_from_this<sstable> {
         return _version;
     }
 
+    format_types get_format() const {
+        return _format;
+    }
+
     // Returns the total bytes of all components.
     uint64_t bytes_on_disk() const;
 
@@ -676,7 +682,8 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     void write_statistics();
     // Rewrite statistics component by creating a temporary Statistics and
     // renaming it into place of existing one.
-    void rewrite_statistics();
+    // If `stats` is set, it is written instead of the Stats metadata in memory.
+    void rewrite_statistics(const stats_metadata* stats = nullptr);
     // Validate metadata that's used to optimize reads when user specifies
     // a clustering key range. If this specific metadata is incorrect, then
     // it should be cleared. Otherwise, it could lead to bad decisions.
@@ -940,6 +947,15 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     // This will change sstable level only in memory.
     void set_sstable_level(uint32_t);
 
+    // See stats_metadata::repaired_at.
+    uint64_t get_repaired_at() const {
+        return get_stats_metadata().repaired_at;
+    }
+
+    bool is_repaired() const {
+        return get_repaired_at() != 0;
+    }
+
     void generate_new_run_identifier() {
         _run_identifier = run_id::create_random_id();
     }
@@ -952,6 +968,10 @@ class sstable : public enable_lw_shared_from_this<sstable> {
 
     future<> mutate_sstable_level(uint32_t);
 
+    // Marks the sstable as repaired at the given time, and persists it in the
+    // Statistics component.
+    future<> mutate_repaired_at(uint64_t repaired_at);
+
     const summary& get_summary() const {
         return _components->summary;
     }
@@ -1019,6 +1039,15 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     // Implementation is underlying storage specific.
     future<entry_descriptor> clone(generation_type new_generation) const;
 
+    // Prepares the sstable for writing component files copied as a whole
+    // from another sstable, e.g. received by file streaming. Each of the
+    // components has to be written with make_component_sink(), after which
+    // the sstable is sealed with seal_sstable(). The sstable is deleted if
+    // it's destroyed before being sealed.
+    // Must be called in a seastar thread.
+    void open_for_copy(const std::vector<component_type>& components);
+    future<data_sink> make_component_sink(component_type c, file_output_stream_options options);
+
     struct lesser_reclaimed_memory {
         // comparator class to be used by the _reclaimed set in sstables manager
         bool operator()(const sstable& sst1, const sstable& sst2) const {
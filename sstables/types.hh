@@ -308,8 +308,9 @@ struct stats_metadata : public metadata_base<stats_metadata> {
     double compression_ratio;
     utils::streaming_histogram estimated_tombstone_drop_time;
     uint32_t sstable_level;
-    // There is not meaningful value to put in this field, since we have no
-    // incremental repair. Before we have it, let's set it to 0.
+    // The time (in milliseconds since the epoch) of the incremental repair
+    // which made the data of the sstable consistent with the other replicas,
+    // or 0 if the sstable wasn't repaired.
     uint64_t repaired_at = 0;
     disk_array<uint32_t, disk_string<uint16_t>> min_column_names;
     disk_array<uint32_t, disk_string<uint16_t>> max_column_names;
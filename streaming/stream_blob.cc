@@ -0,0 +1,466 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <ranges>
+#include <unordered_set>
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/fstream.hh>
+#include <seastar/core/loop.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/core/thread.hh>
+#include <seastar/coroutine/as_future.hh>
+#include <seastar/coroutine/exception.hh>
+#include <seastar/util/defer.hh>
+
+#include "streaming/stream_blob.hh"
+#include "streaming/stream_manager.hh"
+#include "message/messaging_service.hh"
+#include "replica/database.hh"
+#include "sstables/sstables.hh"
+#include "sstables/sstables_manager.hh"
+#include "sstables/version.hh"
+#include "dht/auto_refreshing_sharder.hh"
+#include "service/topology_guard.hh"
+#include "utils/crc.hh"
+#include "utils/error_injection.hh"
+#include "utils/log.hh"
+#include "idl/streaming.dist.hh"
+
+namespace streaming {
+
+extern logging::logger sslog;
+
+// The number of sstables sent in parallel by a shard.
+static constexpr size_t stream_blob_concurrency = 2;
+static constexpr size_t stream_blob_buffer_size = 128 * 1024;
+
+static void update_crc(utils::crc32& crc, const temporary_buffer<char>& buf) {
+    crc.process(reinterpret_cast<const uint8_t*>(buf.get()), buf.size());
+}
+
+// Receives the components of a single sstable on the shard of the pending
+// replica. The complete sstable is staged, still unsealed, with the file
+// streaming it belongs to, see stream_manager::stream_tablet_files(). An
+// unsealed sstable is deleted when the last reference to it is dropped.
+class sstable_receiver {
+    lw_shared_ptr<replica::table> _table;
+    utils::phased_barrier::operation _op;
+    plan_id _ops_id;
+    service::topology_guard _guard;
+    sstables::shared_sstable _sst;
+    // The components announced by the sender and not received yet.
+    std::unordered_set<sstables::component_type, enum_hash<sstables::component_type>> _pending;
+    // The component being received.
+    sstables::component_type _component = sstables::component_type::Unknown;
+    std::optional<output_stream<char>> _out;
+    utils::crc32 _crc;
+public:
+    sstable_receiver(replica::table& table, const stream_blob_meta& meta)
+        : _table(table.shared_from_this())
+        , _op(table.stream_in_progress())
+        , _ops_id(meta.ops_id)
+        , _guard(meta.session)
+    { }
+
+    future<> start(const stream_blob_meta& meta) {
+        auto version = sstables::version_from_string(meta.version);
+        auto sst_format = sstables::format_from_string(meta.format);
+        std::vector<sstables::component_type> components;
+        for (const auto& name : meta.components) {
+            auto c = sstables::sstable::component_from_sstring(version, name);
+            if (c == sstables::component_type::Unknown || c == sstables::component_type::TOC) {
+                throw std::runtime_error(format("Unexpected sstable component {}", name));
+            }
+            components.push_back(c);
+            _pending.insert(c);
+        }
+        _sst = _table->get_sstables_manager().make_sstable(_table->schema(), _table->get_storage_options(),
+                _table->calculate_generation_for_new_table(), sstables::sstable_state::normal, version, sst_format);
+        co_await seastar::async([&] {
+            _sst->open_for_copy(components);
+        });
+    }
+
+    future<> handle(const stream_blob_cmd_data& cmd) {
+        switch (cmd.cmd) {
+        case stream_blob_cmd::component:
+            return start_component(cmd.component);
+        case stream_blob_cmd::data:
+            return write(cmd.data);
+        case stream_blob_cmd::end_of_component:
+            return end_component(cmd.checksum);
+        case stream_blob_cmd::error:
+            return make_exception_future<>(std::runtime_error("The sender failed"));
+        default:
+            return make_exception_future<>(std::runtime_error(format("Unexpected stream_blob_cmd {}", int(cmd.cmd))));
+        }
+    }
+
+    // Stages the received sstable, to be added to the table with the other
+    // sstables of the file streaming.
+    void finish(stream_manager& sm) {
+        if (_out || !_pending.empty()) {
+            throw std::runtime_error(format("Incomplete sstable {}: {} components weren't received", _sst->get_filename(), _pending.size()));
+        }
+        _guard.check();
+        sm.stage_sstable(_ops_id, _sst);
+        sslog.debug("Received sstable {} of table {}.{}", _sst->get_filename(), _table->schema()->ks_name(), _table->schema()->cf_name());
+    }
+
+    future<> abort() noexcept {
+        if (_out) {
+            try {
+                co_await _out->close();
+            } catch (...) {
+                // The sstable is going to be deleted anyway.
+            }
+            _out.reset();
+        }
+    }
+
+private:
+    future<> start_component(const sstring& name) {
+        if (_out) {
+            throw std::runtime_error(format("Component {} started before {} ended", name, _sst->component_basename(_component)));
+        }
+        auto c = sstables::sstable::component_from_sstring(_sst->get_version(), name);
+        if (!_pending.contains(c)) {
+            throw std::runtime_error(format("Unexpected sstable component {}", name));
+        }
+        _component = c;
+        _crc = {};
+        file_output_stream_options options;
+        options.buffer_size = stream_blob_buffer_size;
+        _out.emplace(co_await _sst->make_component_sink(c, options));
+    }
+
+    future<> write(const temporary_buffer<char>& buf) {
+        if (!_out) {
+            return make_exception_future<>(std::runtime_error("Component data sent before the component was started"));
+        }
+        update_crc(_crc, buf);
+        // Copies the buffer, which belongs to another shard.
+        return _out->write(buf.get(), buf.size());
+    }
+
+    future<> end_component(uint32_t checksum) {
+        if (!_out) {
+            throw std::runtime_error("Component ended before it was started");
+        }
+        std::exception_ptr ex;
+        try {
+            co_await _out->flush();
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        try {
+            co_await _out->close();
+        } catch (...) {
+            if (!ex) {
+                ex = std::current_exception();
+            }
+        }
+        _out.reset();
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+        if (_crc.get() != checksum) {
+            throw std::runtime_error(format("Checksum mismatch of {}: expected {}, got {}", _sst->component_basename(_component), checksum, _crc.get()));
+        }
+        _pending.erase(_component);
+    }
+};
+
+// Runs on the shard which got the STREAM_BLOB stream, and hands the
+// received data over to a sstable_receiver on the destination shard.
+static future<> receive_sstable_files(sharded<stream_manager>& sm, locator::host_id from, stream_blob_meta meta,
+        rpc::source<stream_blob_cmd_data> source, rpc::sink<stream_blob_cmd_data> sink) {
+    const auto shard = meta.dst_shard;
+    foreign_ptr<std::unique_ptr<sstable_receiver>> receiver;
+    std::exception_ptr ex;
+    try {
+        if (shard >= smp::count) {
+            throw std::runtime_error(format("Invalid destination shard {}", shard));
+        }
+        receiver = co_await sm.invoke_on(shard, [&meta] (stream_manager& sm) -> future<foreign_ptr<std::unique_ptr<sstable_receiver>>> {
+            auto r = std::make_unique<sstable_receiver>(sm.db().find_column_family(meta.table), meta);
+            co_await r->start(meta);
+            co_return make_foreign(std::move(r));
+        });
+        bool end_of_stream = false;
+        while (auto cmd_opt = co_await source()) {
+            const auto& cmd = std::get<0>(*cmd_opt);
+            if (cmd.cmd == stream_blob_cmd::end_of_stream) {
+                end_of_stream = true;
+                break;
+            }
+            co_await smp::submit_to(shard, [&r = *receiver, &cmd] {
+                return r.handle(cmd);
+            });
+            sm.local().update_progress(meta.ops_id, from, progress_info::direction::IN, cmd.data.size());
+        }
+        if (!end_of_stream) {
+            throw std::runtime_error("The stream ended before all the components were sent");
+        }
+        co_await smp::submit_to(shard, [&sm, &r = *receiver] {
+            r.finish(sm.local());
+        });
+        co_await sink(stream_blob_cmd_data{.cmd = stream_blob_cmd::ok});
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    if (ex) {
+        if (receiver) {
+            co_await smp::submit_to(shard, [&r = *receiver] {
+                return r.abort();
+            });
+        }
+        try {
+            co_await sink(stream_blob_cmd_data{.cmd = stream_blob_cmd::error});
+        } catch (...) {
+            // The sender will see the stream closed.
+        }
+    }
+    try {
+        co_await sink.close();
+    } catch (...) {
+        if (!ex) {
+            ex = std::current_exception();
+        }
+    }
+    if (ex) {
+        co_return coroutine::exception(std::move(ex));
+    }
+}
+
+static future<uint64_t> send_component(stream_manager& sm, const tablet_stream_files_request& req, locator::host_id dst,
+        rpc::sink<stream_blob_cmd_data>& sink, input_stream<char>& in, utils::crc32& crc) {
+    uint64_t size = 0;
+    while (auto buf = co_await in.read()) {
+        update_crc(crc, buf);
+        size += buf.size();
+        sm.update_progress(req.ops_id, dst, progress_info::direction::OUT, buf.size());
+        co_await sink(stream_blob_cmd_data{.cmd = stream_blob_cmd::data, .data = std::move(buf)});
+    }
+    co_return size;
+}
+
+// Sends the components of a sstable over a new STREAM_BLOB stream, and
+// waits until the receiver stages the sstable.
+// Returns the number of bytes sent.
+static future<uint64_t> send_sstable_files(stream_manager& sm, const tablet_stream_files_request& req, locator::host_id dst,
+        sstables::sstable_files_snapshot& snapshot) {
+    const auto& sst = *snapshot.sst;
+    const auto& component_map = sstables::sstable_version_constants::get_component_map(sst.get_version());
+    std::vector<std::pair<sstring, file*>> components;
+    for (auto& [type, f] : snapshot.files) {
+        // The receiver writes the TOC itself.
+        if (type != sstables::component_type::TOC) {
+            components.emplace_back(component_map.at(type), &f);
+        }
+    }
+    auto meta = stream_blob_meta{
+        .ops_id = req.ops_id,
+        .table = req.table,
+        .version = fmt::to_string(sst.get_version()),
+        .format = fmt::to_string(sst.get_format()),
+        .components = components | std::views::keys | std::ranges::to<std::vector<sstring>>(),
+        .dst_shard = req.dst_shard,
+        .session = req.session,
+    };
+    auto [sink, source] = co_await sm.ms().make_sink_and_source_for_stream_blob(std::move(meta), dst);
+    uint64_t bytes = 0;
+    std::exception_ptr ex;
+    try {
+        for (auto& [name, f] : components) {
+            co_await sink(stream_blob_cmd_data{.cmd = stream_blob_cmd::component, .component = name});
+            utils::crc32 crc;
+            file_input_stream_options options;
+            options.buffer_size = stream_blob_buffer_size;
+            options.read_ahead = 4;
+            // Closing the stream doesn't close the file, it's closed with the snapshot.
+            auto in = make_file_input_stream(*f, 0, options);
+            auto sent = co_await coroutine::as_future(send_component(sm, req, dst, sink, in, crc));
+            co_await in.close();
+            bytes += sent.get();
+            auto checksum = crc.get();
+            if (utils::get_local_injector().enter("stream_blob_corrupt_checksum")) {
+                checksum ^= 1;
+            }
+            co_await sink(stream_blob_cmd_data{.cmd = stream_blob_cmd::end_of_component, .checksum = checksum});
+            utils::get_local_injector().inject("stream_blob_fail_after_component",
+                    [] { throw std::runtime_error("stream_blob failed due to error injection"); });
+        }
+        co_await sink(stream_blob_cmd_data{.cmd = stream_blob_cmd::end_of_stream});
+        co_await sink.flush();
+        auto status = co_await source();
+        if (!status || std::get<0>(*status).cmd != stream_blob_cmd::ok) {
+            throw std::runtime_error(format("Failed to stream sstable {} to {}: the receiver failed", sst.get_filename(), dst));
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    if (ex) {
+        try {
+            co_await sink(stream_blob_cmd_data{.cmd = stream_blob_cmd::error});
+        } catch (...) {
+            // The receiver will see the stream closed.
+        }
+    }
+    try {
+        co_await sink.close();
+    } catch (...) {
+        if (!ex) {
+            ex = std::current_exception();
+        }
+    }
+    if (ex) {
+        co_return coroutine::exception(std::move(ex));
+    }
+    sslog.debug("[Stream #{}] Sent sstable {} to {}, {} bytes", req.ops_id, sst.get_filename(), dst, bytes);
+    co_return bytes;
+}
+
+static future<> close_files(utils::chunked_vector<sstables::sstable_files_snapshot>& snapshot) {
+    for (auto& s : snapshot) {
+        for (auto& [type, f] : s.files) {
+            try {
+                co_await f.close();
+            } catch (...) {
+                sslog.warn("Failed to close {}: {}", s.sst->component_basename(type), std::current_exception());
+            }
+        }
+    }
+}
+
+future<tablet_stream_files_response> stream_manager::send_tablet_files(locator::host_id dst, tablet_stream_files_request req) {
+    auto& table = db().find_column_family(req.table);
+    auto op = table.stream_in_progress();
+    auto cleanup = defer([this, &req] {
+        remove_progress(req.ops_id);
+    });
+    auto snapshot = co_await table.take_storage_snapshot(req.range);
+    auto contained = [&] (const sstables::shared_sstable& sst) {
+        return req.range.contains(sst->get_first_decorated_key().token(), dht::token_comparator())
+                && req.range.contains(sst->get_last_decorated_key().token(), dht::token_comparator());
+    };
+    bool injected_unsupported = utils::get_local_injector().enter("stream_blob_unsupported");
+    auto unsupported = std::ranges::find_if(snapshot, [&] (const sstables::sstable_files_snapshot& s) {
+        return injected_unsupported || s.sst->requires_view_building() || !contained(s.sst);
+    });
+    if (unsupported != snapshot.end()) {
+        sslog.info("[Stream #{}] Can't stream sstable {} of table {} range {} as files", req.ops_id,
+                unsupported->sst->get_filename(), req.table, req.range);
+        co_await close_files(snapshot);
+        co_return tablet_stream_files_response{.status = tablet_stream_files_status::unsupported};
+    }
+    uint64_t bytes = 0;
+    auto f = co_await coroutine::as_future(max_concurrent_for_each(snapshot, stream_blob_concurrency, [&] (sstables::sstable_files_snapshot& s) -> future<> {
+        bytes += co_await send_sstable_files(*this, req, dst, s);
+    }));
+    co_await close_files(snapshot);
+    if (f.failed()) {
+        co_return coroutine::exception(f.get_exception());
+    }
+    sslog.info("[Stream #{}] Sent {} sstables of table {} range {} to {}, {} bytes", req.ops_id,
+            snapshot.size(), req.table, req.range, dst, bytes);
+    co_return tablet_stream_files_response{.status = tablet_stream_files_status::ok, .stream_bytes = bytes};
+}
+
+void stream_manager::stage_sstable(plan_id ops_id, sstables::shared_sstable sst) {
+    auto it = _staged_sstables.find(ops_id);
+    if (it == _staged_sstables.end()) {
+        throw std::runtime_error(format("File streaming {} isn't in progress", ops_id));
+    }
+    it->second.push_back(std::move(sst));
+}
+
+future<> stream_manager::add_staged_sstables(plan_id ops_id, table_id table_id, service::frozen_topology_guard session) {
+    auto ssts = std::move(_staged_sstables.at(ops_id));
+    _staged_sstables.erase(ops_id);
+    auto& table = db().find_column_family(table_id);
+    auto op = table.stream_in_progress();
+    service::topology_guard guard(session);
+    try {
+        dht::auto_refreshing_sharder sharder(table.shared_from_this());
+        for (auto& sst : ssts) {
+            co_await sst->seal_sstable(false);
+            co_await sst->load(sharder, sstables::sstable_open_config{.current_shard_as_sstable_owner = true});
+        }
+        guard.check();
+    } catch (...) {
+        // Some of the sstables may be sealed now, make sure they're not left behind.
+        for (auto& sst : ssts) {
+            sst->mark_for_deletion();
+        }
+        throw;
+    }
+    co_await table.add_sstables_and_update_cache(ssts);
+    sslog.debug("[Stream #{}] Added {} sstables to table {}", ops_id, ssts.size(), table_id);
+}
+
+future<bool> stream_manager::stream_tablet_files(locator::host_id src, tablet_stream_files_request req, abort_source& as) {
+    sslog.info("[Stream #{}] Started file streaming of table {} range {} from {}", req.ops_id, req.table, req.range, src);
+    co_await container().invoke_on(req.dst_shard, [&req] (stream_manager& sm) {
+        sm._staged_sstables.emplace(req.ops_id, std::vector<sstables::shared_sstable>());
+    });
+    // The sender returns once all the sstables are received, and staged.
+    // Only then are they added to the table, together, so a failed transfer
+    // doesn't leave a part of the tablet's data behind.
+    auto f = co_await coroutine::as_future(coroutine::lambda([&] () -> future<tablet_stream_files_response> {
+        auto resp = co_await ser::streaming_rpc_verbs::send_tablet_stream_files(&ms(), src, as, req);
+        if (resp.status == tablet_stream_files_status::ok) {
+            co_await container().invoke_on(req.dst_shard, [&req] (stream_manager& sm) {
+                return sm.add_staged_sstables(req.ops_id, req.table, req.session);
+            });
+        }
+        co_return resp;
+    }));
+    // Drop what is left staged after a failure. The sstables aren't sealed,
+    // so they are deleted with the last reference. Sstables which are still
+    // being received fail to be staged, and are deleted as well.
+    co_await container().invoke_on(req.dst_shard, [&req] (stream_manager& sm) {
+        sm._staged_sstables.erase(req.ops_id);
+    });
+    co_await remove_progress_on_all_shards(req.ops_id);
+    auto resp = f.get();
+    if (resp.status == tablet_stream_files_status::unsupported) {
+        co_return false;
+    }
+    sslog.info("[Stream #{}] Finished file streaming of table {} range {} from {}, {} bytes", req.ops_id, req.table, req.range, src, resp.stream_bytes);
+    co_return true;
+}
+
+void stream_manager::init_stream_blob_handlers() {
+    auto& ms = _ms.local();
+    ser::streaming_rpc_verbs::register_tablet_stream_files(&ms, [this] (const rpc::client_info& cinfo, tablet_stream_files_request req) {
+        auto from = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
+        if (req.src_shard >= smp::count) {
+            return make_exception_future<tablet_stream_files_response>(std::runtime_error(format("Invalid source shard {}", req.src_shard)));
+        }
+        return container().invoke_on(req.src_shard, [from, req] (stream_manager& sm) {
+            return sm.send_tablet_files(from, req);
+        });
+    });
+    ms.register_stream_blob([this] (const rpc::client_info& cinfo, stream_blob_meta meta, rpc::source<stream_blob_cmd_data> source) {
+        auto from = cinfo.retrieve_auxiliary<locator::host_id>("host_id");
+        auto sink = _ms.local().make_sink_for_stream_blob(source);
+        // Start a new fiber.
+        (void)receive_sstable_files(container(), from, std::move(meta), source, sink).handle_exception([from] (std::exception_ptr ep) {
+            sslog.warn("Failed to receive sstable files from {}: {}", from, ep);
+        });
+        return make_ready_future<rpc::sink<stream_blob_cmd_data>>(sink);
+    });
+}
+
+future<> stream_manager::uninit_stream_blob_handlers() {
+    return _ms.local().unregister_stream_blob();
+}
+
+} // namespace streaming
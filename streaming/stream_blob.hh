@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <seastar/core/sstring.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include "dht/token.hh"
+#include "interval.hh"
+#include "schema/schema_fwd.hh"
+#include "streaming/stream_fwd.hh"
+#include "seastarx.hh"
+
+// File streaming copies the sstables of a tablet replica to another node as
+// whole component files, instead of decoding them into mutation fragments
+// and writing them again on the receiving side. It is used for tablet
+// migration, when all the sstables of the tablet replica are fully contained
+// in the tablet range, so that they can be attached to the pending replica
+// as they are.
+//
+// The pending replica asks the leaving replica to send the files of the
+// tablet with TABLET_STREAM_FILES. The leaving replica sends each sstable
+// over its own STREAM_BLOB stream. The receiver writes the components, checks
+// them against the checksums sent with them, and adds the sstable to the
+// table once all of its components were received.
+
+namespace streaming {
+
+enum class stream_blob_cmd : uint8_t {
+    // Sent by the receiver once the sstable was added to the table.
+    ok,
+    // Sent by either side when it fails.
+    error,
+    // Starts a new component, named by stream_blob_cmd_data::component.
+    component,
+    // A chunk of the current component.
+    data,
+    // Ends the current component, whose crc32 is stream_blob_cmd_data::checksum.
+    end_of_component,
+    // Sent after all the components of the sstable.
+    end_of_stream,
+};
+
+struct stream_blob_cmd_data {
+    stream_blob_cmd cmd;
+    sstring component;
+    temporary_buffer<char> data;
+    uint32_t checksum = 0;
+};
+
+// Sent when opening a STREAM_BLOB stream, describes the sstable sent over it.
+struct stream_blob_meta {
+    plan_id ops_id;
+    table_id table;
+    // The version and format of the sstable, e.g. "me" and "big".
+    sstring version;
+    sstring format;
+    // The names of the components which will be sent, e.g. "Data.db".
+    // The TOC is not sent, the receiver writes it from this list.
+    std::vector<sstring> components;
+    uint32_t dst_shard;
+    service::session_id session;
+};
+
+struct tablet_stream_files_request {
+    plan_id ops_id;
+    table_id table;
+    dht::token_range range;
+    // The shard of the leaving replica, which sends the files.
+    uint32_t src_shard;
+    // The shard of the pending replica, which receives the files.
+    uint32_t dst_shard;
+    service::session_id session;
+};
+
+enum class tablet_stream_files_status : uint8_t {
+    ok,
+    // The sstables can't be streamed as files, e.g. some of them aren't
+    // contained in the tablet range. Nothing was streamed.
+    unsupported,
+};
+
+struct tablet_stream_files_response {
+    tablet_stream_files_status status;
+    uint64_t stream_bytes = 0;
+};
+
+} // namespace streaming
@@ -12,6 +12,7 @@
 #include "streaming/stream_fwd.hh"
 #include "streaming/progress_info.hh"
 #include "streaming/stream_reason.hh"
+#include "streaming/stream_blob.hh"
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/distributed.hh>
 #include "utils/updateable_value.hh"
@@ -22,6 +23,7 @@
 #include "gms/application_state.hh"
 #include "service/topology_guard.hh"
 #include "readers/mutation_reader.hh"
+#include "sstables/shared_sstable.hh"
 #include <seastar/core/semaphore.hh>
 #include <seastar/core/metrics_registration.hh>
 
@@ -96,6 +98,9 @@ class stream_manager : public gms::i_endpoint_state_change_subscriber, public en
     semaphore _mutation_send_limiter{256};
     seastar::metrics::metric_groups _metrics;
     std::unordered_map<streaming::stream_reason, float> _finished_percentage;
+    // The sstables received by the file streaming in progress on this shard,
+    // by ops id. They are added to the table only once all of them are.
+    std::unordered_map<plan_id, std::vector<sstables::shared_sstable>> _staged_sstables;
 
     scheduling_group _streaming_group;
     utils::updateable_value<uint32_t> _io_throughput_mbs;
@@ -171,6 +176,17 @@ class stream_manager : public gms::i_endpoint_state_change_subscriber, public en
 
     reader_consumer_v2 make_streaming_consumer(
             uint64_t estimated_partitions, stream_reason, service::frozen_topology_guard);
+
+    // Streams the sstables of the tablet replica on `src` to the pending
+    // replica on this node as files, see stream_blob.hh. Returns false,
+    // without streaming anything, if they can't be streamed as files.
+    // The received sstables are added to the table only if all of them are
+    // received, the sstables received so far are deleted otherwise.
+    future<bool> stream_tablet_files(locator::host_id src, tablet_stream_files_request req, abort_source& as);
+
+    // Stages a sstable received by the file streaming `ops_id`.
+    // Throws if the streaming isn't in progress on this shard.
+    void stage_sstable(plan_id ops_id, sstables::shared_sstable sst);
 public:
     virtual future<> on_join(inet_address endpoint, endpoint_state_ptr ep_state, gms::permit_id) override { return make_ready_future(); }
     virtual future<> on_change(gms::inet_address, const gms::application_state_map& states, gms::permit_id) override  { return make_ready_future(); }
@@ -186,6 +202,10 @@ class stream_manager : public gms::i_endpoint_state_change_subscriber, public en
 
     void init_messaging_service_handler(abort_source& as);
     future<> uninit_messaging_service_handler();
+    void init_stream_blob_handlers();
+    future<> uninit_stream_blob_handlers();
+    future<tablet_stream_files_response> send_tablet_files(locator::host_id dst, tablet_stream_files_request req);
+    future<> add_staged_sstables(plan_id ops_id, table_id table, service::frozen_topology_guard session);
     future<> update_io_throughput(uint32_t value_mbs);
 
 public:
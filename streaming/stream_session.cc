@@ -278,13 +278,15 @@ void stream_manager::init_messaging_service_handler(abort_source& as) {
             return make_ready_future<>();
         }
     });
+    init_stream_blob_handlers();
 }
 
 future<> stream_manager::uninit_messaging_service_handler() {
     auto& ms = _ms.local();
     return when_all_succeed(
         ser::streaming_rpc_verbs::unregister(&ms),
-        ms.unregister_stream_mutation_fragments()).discard_result();
+        ms.unregister_stream_mutation_fragments(),
+        uninit_stream_blob_handlers()).discard_result();
 }
 
 stream_session::stream_session(stream_manager& mgr, locator::host_id peer_)
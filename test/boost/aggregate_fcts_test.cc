@@ -16,6 +16,8 @@
 #include <seastar/testing/test_case.hh>
 #include "test/lib/cql_test_env.hh"
 #include "test/lib/cql_assertions.hh"
+#include "transport/messages/result_message.hh"
+#include "exceptions/exceptions.hh"
 
 #include <seastar/core/future-util.hh>
 #include "types/set.hh"
@@ -271,4 +273,80 @@ SEASTAR_TEST_CASE(test_minmax_on_set) {
     });
 }
 
+SEASTAR_TEST_CASE(test_aggregate_approx_count_distinct) {
+    return do_with_cql_env_thread([&] (auto& e) {
+        e.execute_cql("CREATE TABLE test (p int, c int, v text, PRIMARY KEY (p, c));").get();
+        for (int p = 0; p < 10; ++p) {
+            for (int c = 0; c < 100; ++c) {
+                e.execute_cql(format("INSERT INTO test (p, c, v) VALUES ({}, {}, '{}');", p, c, c % 50)).get();
+            }
+        }
+        e.execute_cql("INSERT INTO test (p, c) VALUES (11, 0);").get();
+
+        auto count_of = [&] (sstring query) {
+            auto rows = dynamic_pointer_cast<cql_transport::messages::result_message::rows>(e.execute_cql(query).get());
+            BOOST_REQUIRE(rows);
+            const auto& rs = rows->rs().result_set().rows();
+            BOOST_REQUIRE_EQUAL(rs.size(), 1);
+            return value_cast<int64_t>(long_type->deserialize(*rs[0][0]));
+        };
+        // Small cardinalities are estimated almost exactly.
+        BOOST_REQUIRE_LE(std::abs(count_of("SELECT approx_count_distinct(v) FROM test;") - 50), 1);
+        BOOST_REQUIRE_LE(std::abs(count_of("SELECT approx_count_distinct(c) FROM test;") - 100), 2);
+        BOOST_REQUIRE_EQUAL(count_of("SELECT approx_count_distinct(p) FROM test WHERE p = 3;"), 1);
+        BOOST_REQUIRE_EQUAL(count_of("SELECT approx_count_distinct(v) FROM test WHERE p = 11;"), 0);
+
+        // Equal decimals and varints with different encodings are counted once.
+        e.execute_cql("CREATE TABLE numbers (p int, c int, d decimal, v varint, PRIMARY KEY (p, c));").get();
+        e.execute_cql("INSERT INTO numbers (p, c, d, v) VALUES (0, 0, 1.0, 1);").get();
+        e.execute_cql("INSERT INTO numbers (p, c, d, v) VALUES (0, 1, 1.00, blobAsVarint(0x0001));").get();
+        e.execute_cql("INSERT INTO numbers (p, c, d, v) VALUES (0, 2, 1, blobAsVarint(0x00000001));").get();
+        e.execute_cql("INSERT INTO numbers (p, c, d, v) VALUES (0, 3, 10, 10);").get();
+        e.execute_cql("INSERT INTO numbers (p, c, d, v) VALUES (0, 4, 10.0, 2);").get();
+        e.execute_cql("INSERT INTO numbers (p, c, d, v) VALUES (0, 5, 0.00, 0);").get();
+        e.execute_cql("INSERT INTO numbers (p, c, d, v) VALUES (0, 6, 0, blobAsVarint(0x0000));").get();
+        BOOST_REQUIRE_EQUAL(count_of("SELECT approx_count_distinct(d) FROM numbers;"), 3);
+        BOOST_REQUIRE_EQUAL(count_of("SELECT approx_count_distinct(v) FROM numbers;"), 4);
+    });
+}
+
+SEASTAR_TEST_CASE(test_aggregate_approx_percentile) {
+    return do_with_cql_env_thread([&] (auto& e) {
+        e.execute_cql("CREATE TABLE test (p int, c int, i int, d double, PRIMARY KEY (p, c));").get();
+        for (int c = 1; c <= 1000; ++c) {
+            e.execute_cql(format("INSERT INTO test (p, c, i, d) VALUES ({}, {}, {}, {});", c % 7, c, c, c / 10.0)).get();
+        }
+
+        auto percentile_of = [&] (sstring query) -> std::optional<double> {
+            auto rows = dynamic_pointer_cast<cql_transport::messages::result_message::rows>(e.execute_cql(query).get());
+            BOOST_REQUIRE(rows);
+            const auto& rs = rows->rs().result_set().rows();
+            BOOST_REQUIRE_EQUAL(rs.size(), 1);
+            if (!rs[0][0]) {
+                return std::nullopt;
+            }
+            return value_cast<double>(double_type->deserialize(*rs[0][0]));
+        };
+        BOOST_REQUIRE_CLOSE(*percentile_of("SELECT approx_percentile(i, 0.5) FROM test;"), 500, 2.0);
+        BOOST_REQUIRE_CLOSE(*percentile_of("SELECT approx_percentile(i, 0.99) FROM test;"), 990, 0.5);
+        BOOST_REQUIRE_CLOSE(*percentile_of("SELECT approx_percentile(d, 0.99) FROM test;"), 99, 0.5);
+        BOOST_REQUIRE_EQUAL(*percentile_of("SELECT approx_percentile(i, 1) FROM test;"), 1000);
+        BOOST_REQUIRE(!percentile_of("SELECT approx_percentile(i, 0.5) FROM test WHERE p = 100;"));
+        // A single partition has fewer values than the state buffers before
+        // adding them to the t-digest.
+        BOOST_REQUIRE_EQUAL(*percentile_of("SELECT approx_percentile(i, 0) FROM test WHERE p = 0;"), 7);
+        BOOST_REQUIRE_EQUAL(*percentile_of("SELECT approx_percentile(i, 1) FROM test WHERE p = 0;"), 994);
+        BOOST_REQUIRE_CLOSE(*percentile_of("SELECT approx_percentile(i, 0.5) FROM test WHERE p = 0;"), 500, 2.0);
+        // A single partition with more values than that, read in one go.
+        for (int c = 1; c <= 1200; ++c) {
+            e.execute_cql(format("INSERT INTO test (p, c, i) VALUES (50, {}, {});", c, c)).get();
+        }
+        BOOST_REQUIRE_CLOSE(*percentile_of("SELECT approx_percentile(i, 0.99) FROM test WHERE p = 50;"), 1188, 0.5);
+        BOOST_REQUIRE_EQUAL(*percentile_of("SELECT approx_percentile(i, 0) FROM test WHERE p = 50;"), 1);
+        BOOST_REQUIRE_EQUAL(*percentile_of("SELECT approx_percentile(i, 1) FROM test WHERE p = 50;"), 1200);
+
+        BOOST_REQUIRE_THROW(e.execute_cql("SELECT approx_percentile(i, 1.5) FROM test;").get(), exceptions::invalid_request_exception);
+    });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
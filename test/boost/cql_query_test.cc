@@ -26,6 +26,7 @@
 
 #include <seastar/core/future-util.hh>
 #include <seastar/core/sleep.hh>
+#include <seastar/core/coroutine.hh>
 #include "transport/messages/result_message.hh"
 #include "transport/messages/result_message_base.hh"
 #include "types/types.hh"
@@ -3228,6 +3229,77 @@ SEASTAR_TEST_CASE(test_allow_filtering_contains) {
     });
 }
 
+// Partitions of an IN query owned by the same replica are read with a single
+// multi-partition request. Check that the results are complete, and that the
+// limit is applied across all the partitions.
+SEASTAR_TEST_CASE(test_in_restriction_many_partitions) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        e.execute_cql("create table t (p int, c int, v int, primary key (p, c)) with speculative_retry = 'NONE';").get();
+        auto batched_reads = [&] {
+            return e.get_storage_proxy().local().get_stats().batched_data_reads;
+        };
+        const int partitions = 50;
+        std::vector<std::vector<bytes_opt>> expected;
+        sstring in_list;
+        for (int p = 0; p < partitions; ++p) {
+            for (int c = 0; c < 3; ++c) {
+                e.execute_cql(format("insert into t (p, c, v) values ({}, {}, {});", p, c, p * 10 + c)).get();
+                expected.push_back({int32_type->decompose(p), int32_type->decompose(c), int32_type->decompose(p * 10 + c)});
+            }
+            in_list += format("{}{}", p ? ", " : "", partitions - 1 - p);
+        }
+        // Keys which don't exist don't show up in the results.
+        in_list += ", 1000, 1001";
+
+        auto batched_before = batched_reads();
+        auto msg = e.execute_cql(format("select p, c, v from t where p in ({});", in_list)).get();
+        assert_that(msg).is_rows().with_rows_ignore_order(expected);
+        BOOST_REQUIRE_GT(batched_reads(), batched_before);
+
+        msg = e.execute_cql(format("select p, c, v from t where p in ({}) limit 7;", in_list)).get();
+        assert_that(msg).is_rows().with_size(7);
+
+        msg = e.execute_cql(format("select p, c, v from t where p in ({}) and c = 1;", in_list)).get();
+        assert_that(msg).is_rows().with_size(partitions);
+
+        // Reads of tables which speculate are batched too, a batch speculates
+        // as a whole.
+        for (auto retry : {"99.0PERCENTILE", "ALWAYS", "10ms"}) {
+            e.execute_cql(format("alter table t with speculative_retry = '{}';", retry)).get();
+            batched_before = batched_reads();
+            msg = e.execute_cql(format("select p, c, v from t where p in ({});", in_list)).get();
+            assert_that(msg).is_rows().with_rows_ignore_order(expected);
+            BOOST_REQUIRE_GT(batched_reads(), batched_before);
+        }
+    });
+}
+
+SEASTAR_TEST_CASE(test_unprepared_statements_and_schema_changes) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        auto i = [] (int v) { return int32_type->decompose(v); };
+        e.execute_cql("create table t (p int primary key, v int);").get();
+        // Execute each statement more than once, so that later executions
+        // can reuse the statement prepared by the first one.
+        for (int n = 0; n < 2; ++n) {
+            e.execute_cql("insert into t (p) values (1);").get();
+            e.execute_cql("update t set v = 1 where p = 1;").get();
+            auto msg = e.execute_cql("select * from t;").get();
+            assert_that(msg).is_rows().with_rows({{i(1), i(1)}});
+        }
+
+        e.execute_cql("alter table t add w int;").get();
+        auto msg = e.execute_cql("select * from t;").get();
+        assert_that(msg).is_rows().with_rows({{i(1), i(1), {}}});
+
+        e.execute_cql("drop table t;").get();
+        e.execute_cql("create table t (p int primary key, x text);").get();
+        e.execute_cql("insert into t (p) values (1);").get();
+        msg = e.execute_cql("select * from t;").get();
+        assert_that(msg).is_rows().with_rows({{i(1), {}}});
+        BOOST_REQUIRE_THROW(e.execute_cql("update t set v = 1 where p = 1;").get(), exceptions::invalid_request_exception);
+    });
+}
+
 SEASTAR_TEST_CASE(test_in_restriction_on_not_last_partition_key) {
     return do_with_cql_env_thread([] (cql_test_env& e) {
         e.execute_cql("CREATE TABLE t (a int,b int,c int,d int,PRIMARY KEY ((a, b), c));").get();
@@ -5292,7 +5364,101 @@ SEASTAR_TEST_CASE(test_parallelized_select_sum_group_by) {
             {int32_type->decompose(int32_t(0)), int32_type->decompose(int32_t((value_count - 1) * value_count / 2))}
         });
 
-        BOOST_CHECK_EQUAL(stat_parallelized, qp.get_cql_stats().select_parallelized);
+        BOOST_CHECK_EQUAL(stat_parallelized + 1, qp.get_cql_stats().select_parallelized);
+
+        // Grouping by a clustering column as well yields one group per row,
+        // in partition and clustering order.
+        msg = e.execute_cql("SELECT k, c, COUNT(*) FROM tbl GROUP BY k, c LIMIT 3;").get();
+        assert_that(msg).is_rows().with_rows({
+            {int32_type->decompose(int32_t(1)), int32_type->decompose(int32_t(0)), long_type->decompose(int64_t(1))},
+            {int32_type->decompose(int32_t(1)), int32_type->decompose(int32_t(1)), long_type->decompose(int64_t(1))},
+            {int32_type->decompose(int32_t(1)), int32_type->decompose(int32_t(2)), long_type->decompose(int64_t(1))}
+        });
+
+        BOOST_CHECK_EQUAL(stat_parallelized + 2, qp.get_cql_stats().select_parallelized);
+    });
+}
+
+SEASTAR_TEST_CASE(test_parallelized_select_group_by_too_many_groups) {
+    auto db_cfg_ptr = make_shared<db::config>();
+    auto& db_cfg = *db_cfg_ptr;
+    db_cfg.enable_parallelized_aggregation({true}, db::config::config_source::CommandLine);
+    db_cfg.parallelized_group_by_max_groups({1}, db::config::config_source::CommandLine);
+    return do_with_cql_env_thread([](cql_test_env& e) {
+        auto& qp = e.local_qp();
+        e.execute_cql("CREATE TABLE tbl (k int, c int, v int, PRIMARY KEY (k, c));").get();
+        for (int k = 0; k < 2; k++) {
+            for (int c = 0; c < 3; c++) {
+                e.execute_cql(format("INSERT INTO tbl (k, c, v) VALUES ({:d}, {:d}, {:d});", k, c, c)).get();
+            }
+        }
+
+        // Exceeding the group limit falls back to the paged algorithm, which
+        // must give the same answer.
+        auto stat_fallbacks = qp.get_cql_stats().select_parallelized_fallbacks;
+        auto msg = e.execute_cql("SELECT k, SUM(v) FROM tbl GROUP BY k;").get();
+        assert_that(msg).is_rows().with_rows({
+            {int32_type->decompose(int32_t(1)), int32_type->decompose(int32_t(3))},
+            {int32_type->decompose(int32_t(0)), int32_type->decompose(int32_t(3))}
+        });
+        BOOST_CHECK_EQUAL(stat_fallbacks + 1, qp.get_cql_stats().select_parallelized_fallbacks);
+    }, db_cfg_ptr);
+}
+
+SEASTAR_TEST_CASE(test_parallelized_select_group_by_paged) {
+    return with_parallelized_aggregation_enabled_thread([](cql_test_env& e) {
+        auto& qp = e.local_qp();
+        e.execute_cql("CREATE TABLE tbl (k int, c int, v int, PRIMARY KEY (k, c));").get();
+        const int partitions = 5;
+        for (int k = 0; k < partitions; k++) {
+            for (int c = 0; c < 3; c++) {
+                e.execute_cql(format("INSERT INTO tbl (k, c, v) VALUES ({:d}, {:d}, {:d});", k, c, c)).get();
+            }
+        }
+
+        const sstring query = "SELECT k, SUM(v) FROM tbl GROUP BY k;";
+        using rows_type = std::vector<std::vector<managed_bytes_opt>>;
+        auto fetch_pages = [&] (int32_t page_size) {
+            rows_type rows;
+            size_t pages = 0;
+            lw_shared_ptr<service::pager::paging_state> paging_state;
+            do {
+                auto qo = std::make_unique<cql3::query_options>(db::consistency_level::ONE, std::vector<cql3::raw_value>{},
+                        cql3::query_options::specific_options{page_size, paging_state, {}, api::new_timestamp()});
+                auto msg = e.execute_cql(query, std::move(qo)).get();
+                auto result = dynamic_pointer_cast<cql_transport::messages::result_message::rows>(msg);
+                BOOST_REQUIRE(result);
+                BOOST_REQUIRE_LE(result->rs().result_set().size(), size_t(page_size));
+                std::ranges::copy(result->rs().result_set().rows(), std::back_inserter(rows));
+                paging_state = has_more_pages(msg) ? extract_paging_state(msg) : nullptr;
+                ++pages;
+            } while (paging_state);
+            return std::pair(std::move(rows), pages);
+        };
+
+        // All the groups fit in a page, so they are returned by the
+        // parallelized algorithm.
+        auto stat_parallelized = qp.get_cql_stats().select_parallelized;
+        auto stat_fallbacks = qp.get_cql_stats().select_parallelized_fallbacks;
+        auto [expected, single_page] = fetch_pages(100);
+        BOOST_REQUIRE_EQUAL(expected.size(), size_t(partitions));
+        BOOST_REQUIRE_EQUAL(single_page, 1);
+        BOOST_CHECK_EQUAL(stat_parallelized + 1, qp.get_cql_stats().select_parallelized);
+        BOOST_CHECK_EQUAL(stat_fallbacks, qp.get_cql_stats().select_parallelized_fallbacks);
+
+        // The shards give up on the parallelized algorithm only when they
+        // find more groups than fit in a page.
+        auto [exact, exact_pages] = fetch_pages(partitions);
+        BOOST_REQUIRE(exact == expected);
+        BOOST_REQUIRE_EQUAL(exact_pages, 1);
+        BOOST_CHECK_EQUAL(stat_fallbacks, qp.get_cql_stats().select_parallelized_fallbacks);
+
+        // With smaller pages, the result is paged by the regular algorithm,
+        // and gives the same groups in the same order.
+        auto [rows, pages] = fetch_pages(2);
+        BOOST_REQUIRE(rows == expected);
+        BOOST_REQUIRE_GE(pages, 3);
+        BOOST_CHECK_EQUAL(stat_fallbacks + pages, qp.get_cql_stats().select_parallelized_fallbacks);
     });
 }
 
@@ -5938,4 +6104,48 @@ SEASTAR_TEST_CASE(test_schema_change_events) {
      });
 }
 
+// Executes a conditional insert of the key, and checks whether it applied.
+// Returns the shard to execute it on instead, if it's not this one.
+static future<std::optional<unsigned>> lwt_insert(cql_test_env& e, int k, bool applied) {
+    auto msg = co_await e.execute_cql(format("insert into t (p, v) values ({}, {}) if not exists", k, k));
+    if (auto shard = msg->move_to_shard()) {
+        co_return shard;
+    }
+    if (applied) {
+        assert_that(msg).is_rows().with_rows({{boolean_type->decompose(true)}});
+    } else {
+        assert_that(msg).is_rows().with_rows({{boolean_type->decompose(false), int32_type->decompose(k), int32_type->decompose(k)}});
+    }
+    co_return std::nullopt;
+}
+
+// Concurrent lightweight transactions on a shard update the paxos state
+// concurrently, check that none of the updates gets lost.
+SEASTAR_TEST_CASE(test_concurrent_lwt_paxos_state) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "create table t (p int primary key, v int)");
+        auto id = e.local_db().find_schema("ks", "t")->id();
+        static constexpr int keys = 100;
+
+        auto insert_all = [&e] (bool applied) {
+            parallel_for_each(std::views::iota(0, keys), [&e, applied] (int k) {
+                return lwt_insert(e, k, applied).then([&e, k, applied] (std::optional<unsigned> shard) {
+                    if (!shard) {
+                        return make_ready_future<>();
+                    }
+                    return smp::submit_to(*shard, [&e, k, applied] {
+                        return lwt_insert(e, k, applied).discard_result();
+                    });
+                });
+            }).get();
+        };
+        insert_all(true);
+        insert_all(false);
+
+        assert_that(cquery_nofail(e, "select count(*) from t")).is_rows().with_rows({{long_type->decompose(int64_t(keys))}});
+        assert_that(cquery_nofail(e, format("select count(*) from system.paxos where cf_id = {} allow filtering", id)))
+                .is_rows().with_rows({{long_type->decompose(int64_t(keys))}});
+    });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
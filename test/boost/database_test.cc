@@ -10,6 +10,7 @@
 #include <seastar/core/seastar.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/util/file.hh>
 
@@ -21,6 +22,7 @@
 #include <fmt/std.h>
 
 #include "test/lib/cql_test_env.hh"
+#include "test/lib/cql_assertions.hh"
 #include "test/lib/result_set_assertions.hh"
 #include "test/lib/log.hh"
 #include "test/lib/random_utils.hh"
@@ -1612,4 +1614,139 @@ SEASTAR_TEST_CASE(mutation_dump_generated_schema_deterministic_id_version) {
     return make_ready_future<>();
 }
 
+SEASTAR_TEST_CASE(test_query_result_cache) {
+    auto cfg = cql_test_config{};
+    cfg.db_config->query_result_cache_size_in_mb.set(1);
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        auto get_stats = [&] {
+            return e.db().map_reduce0([] (replica::database& db) {
+                return db.get_query_result_cache().get_stats();
+            }, replica::query_result_cache::stats{}, [] (replica::query_result_cache::stats a, const replica::query_result_cache::stats& b) {
+                a.lookups += b.lookups;
+                a.hits += b.hits;
+                a.inserts += b.inserts;
+                a.invalidations += b.invalidations;
+                return a;
+            }).get();
+        };
+
+        e.execute_cql("CREATE TABLE ks.cf (pk int, ck int, v int, PRIMARY KEY (pk, ck))").get();
+        e.execute_cql("INSERT INTO ks.cf (pk, ck, v) VALUES (0, 0, 0)").get();
+        e.execute_cql("INSERT INTO ks.cf (pk, ck, v) VALUES (0, 1, 1)").get();
+
+        // The partition is admitted on the second read, the data doesn't
+        // expire, so all the following reads hit, whatever their query time.
+        for (int i = 0; i < 10; ++i) {
+            auto msg = e.execute_cql("SELECT ck, v FROM ks.cf WHERE pk = 0").get();
+            assert_that(msg).is_rows().with_rows({
+                {int32_type->decompose(0), int32_type->decompose(0)},
+                {int32_type->decompose(1), int32_type->decompose(1)},
+            });
+            if (i == 4) {
+                seastar::sleep(std::chrono::milliseconds(1100)).get();
+            }
+        }
+        auto stats = get_stats();
+        BOOST_REQUIRE_GE(stats.lookups, 10);
+        BOOST_REQUIRE_GE(stats.inserts, 1);
+        BOOST_REQUIRE_GE(stats.hits, 8);
+
+        // A write drops the cached results, the next read has to see it.
+        e.execute_cql("UPDATE ks.cf SET v = 10 WHERE pk = 0 AND ck = 1").get();
+        BOOST_REQUIRE_EQUAL(get_stats().invalidations, stats.invalidations + 1);
+        for (int i = 0; i < 3; ++i) {
+            auto msg = e.execute_cql("SELECT ck, v FROM ks.cf WHERE pk = 0").get();
+            assert_that(msg).is_rows().with_rows({
+                {int32_type->decompose(0), int32_type->decompose(0)},
+                {int32_type->decompose(1), int32_type->decompose(10)},
+            });
+        }
+
+        // Different slices of the same partition are cached separately.
+        for (int i = 0; i < 3; ++i) {
+            auto msg = e.execute_cql("SELECT v FROM ks.cf WHERE pk = 0 AND ck = 0").get();
+            assert_that(msg).is_rows().with_rows({
+                {int32_type->decompose(0)},
+            });
+        }
+
+        // The result of a read of expiring data is only valid at its query
+        // time, a read at a later time misses.
+        e.execute_cql("INSERT INTO ks.cf (pk, ck, v) VALUES (1, 0, 0) USING TTL 3600").get();
+        auto read_expiring = [&] {
+            auto msg = e.execute_cql("SELECT v FROM ks.cf WHERE pk = 1").get();
+            assert_that(msg).is_rows().with_rows({
+                {int32_type->decompose(0)},
+            });
+        };
+        read_expiring();
+        read_expiring();
+        stats = get_stats();
+        seastar::sleep(std::chrono::milliseconds(1100)).get();
+        read_expiring();
+        BOOST_REQUIRE_EQUAL(get_stats().hits, stats.hits);
+        BOOST_REQUIRE_EQUAL(get_stats().inserts, stats.inserts + 1);
+    }, std::move(cfg));
+}
+
+SEASTAR_TEST_CASE(test_counter_shard_cache) {
+    auto cfg = cql_test_config{};
+    cfg.db_config->counter_cache_size_in_mb.set(1);
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        auto get_stats = [&] {
+            return e.db().map_reduce0([] (replica::database& db) {
+                return db.get_counter_shard_cache().get_stats();
+            }, replica::counter_shard_cache::stats{}, [] (replica::counter_shard_cache::stats a, const replica::counter_shard_cache::stats& b) {
+                a.lookups += b.lookups;
+                a.hits += b.hits;
+                a.invalidations += b.invalidations;
+                return a;
+            }).get();
+        };
+        auto require_counters = [&] (int64_t c0, int64_t c1) {
+            auto msg = e.execute_cql("SELECT ck, c FROM ks.cf WHERE pk = 0").get();
+            assert_that(msg).is_rows().with_rows({
+                {int32_type->decompose(0), long_type->decompose(c0)},
+                {int32_type->decompose(1), long_type->decompose(c1)},
+            });
+        };
+
+        e.execute_cql("CREATE TABLE ks.cf (pk int, ck int, c counter, PRIMARY KEY (pk, ck))").get();
+        for (int i = 0; i < 10; ++i) {
+            e.execute_cql("UPDATE ks.cf SET c = c + 1 WHERE pk = 0 AND ck = 0").get();
+            e.execute_cql("UPDATE ks.cf SET c = c + 2 WHERE pk = 0 AND ck = 1").get();
+        }
+        require_counters(10, 20);
+        auto stats = get_stats();
+        BOOST_REQUIRE_EQUAL(stats.lookups, 20);
+        BOOST_REQUIRE_GE(stats.hits, 18);
+
+        // The cached shards stay valid after the memtable is flushed.
+        e.db().invoke_on_all([] (replica::database& db) {
+            return db.flush_all_memtables();
+        }).get();
+        e.execute_cql("UPDATE ks.cf SET c = c + 1 WHERE pk = 0 AND ck = 0").get();
+        require_counters(11, 20);
+        BOOST_REQUIRE_EQUAL(get_stats().hits, stats.hits + 1);
+
+        // A deletion drops the cached shards, the next update has to start
+        // the counter over.
+        e.execute_cql("DELETE FROM ks.cf WHERE pk = 0 AND ck = 0").get();
+        stats = get_stats();
+        BOOST_REQUIRE_GE(stats.invalidations, 1);
+        e.execute_cql("UPDATE ks.cf SET c = c + 5 WHERE pk = 0 AND ck = 1").get();
+        auto msg = e.execute_cql("SELECT ck, c FROM ks.cf WHERE pk = 0").get();
+        assert_that(msg).is_rows().with_rows({
+            {int32_type->decompose(1), long_type->decompose(int64_t(25))},
+        });
+        BOOST_REQUIRE_EQUAL(get_stats().hits, stats.hits);
+
+        // So does truncation.
+        e.execute_cql("TRUNCATE ks.cf").get();
+        e.execute_cql("UPDATE ks.cf SET c = c + 3 WHERE pk = 0 AND ck = 0").get();
+        e.execute_cql("UPDATE ks.cf SET c = c + 4 WHERE pk = 0 AND ck = 1").get();
+        require_counters(3, 4);
+    }, std::move(cfg));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1156,4 +1156,53 @@ SEASTAR_TEST_CASE(test_filtering) {
     });
 }
 
+// Filters are compiled into a list of comparisons per query, with the
+// remaining factors evaluated generically. Check that both kinds mix
+// correctly, including bind variables, NULLs and reversed clustering order.
+SEASTAR_TEST_CASE(test_filtering_compiled_comparisons) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (p int, c int, v int, s int static, l list<int>, PRIMARY KEY (p, c)) WITH CLUSTERING ORDER BY (c DESC);");
+        for (int p = 0; p < 3; ++p) {
+            cquery_nofail(e, format("INSERT INTO t (p, s) VALUES ({}, {});", p, p * 10));
+            for (int c = 0; c < 4; ++c) {
+                cquery_nofail(e, format("INSERT INTO t (p, c, v, l) VALUES ({}, {}, {}, [{}]);", p, c, p + c, c));
+            }
+        }
+
+        auto msg = cquery_nofail(e, "SELECT p, c FROM t WHERE c > 1 AND v <= 3 ALLOW FILTERING;");
+        assert_that(msg).is_rows().with_rows_ignore_order({
+            {int32_type->decompose(0), int32_type->decompose(2)},
+            {int32_type->decompose(0), int32_type->decompose(3)},
+            {int32_type->decompose(1), int32_type->decompose(2)},
+        });
+
+        msg = cquery_nofail(e, "SELECT p, c FROM t WHERE s >= 10 AND c != 0 AND l CONTAINS 3 ALLOW FILTERING;");
+        assert_that(msg).is_rows().with_rows_ignore_order({
+            {int32_type->decompose(1), int32_type->decompose(3)},
+            {int32_type->decompose(2), int32_type->decompose(3)},
+        });
+
+        auto id = e.prepare("SELECT p, c FROM t WHERE s = ? AND v = ? ALLOW FILTERING;").get();
+        msg = e.execute_prepared(id, {
+            cql3::raw_value::make_value(int32_type->decompose(20)),
+            cql3::raw_value::make_value(int32_type->decompose(3)),
+        }).get();
+        assert_that(msg).is_rows().with_rows({
+            {int32_type->decompose(2), int32_type->decompose(1)},
+        });
+        msg = e.execute_prepared(id, {
+            cql3::raw_value::make_value(int32_type->decompose(0)),
+            cql3::raw_value::make_value(int32_type->decompose(3)),
+        }).get();
+        assert_that(msg).is_rows().with_rows({
+            {int32_type->decompose(0), int32_type->decompose(3)},
+        });
+        msg = e.execute_prepared(id, {
+            cql3::raw_value::make_value(int32_type->decompose(0)),
+            cql3::raw_value::make_null(),
+        }).get();
+        assert_that(msg).is_rows().is_empty();
+    });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#undef SEASTAR_TESTING_MAIN
+#include <seastar/testing/test_case.hh>
+#include <seastar/util/defer.hh>
+
+#include "test/lib/cql_test_env.hh"
+
+#include "gms/gossiper.hh"
+#include "gms/i_endpoint_state_change_subscriber.hh"
+#include "gms/version_generator.hh"
+
+BOOST_AUTO_TEST_SUITE(gossiper_test)
+
+namespace {
+
+// Records the application states passed to on_change().
+class change_recorder : public gms::i_endpoint_state_change_subscriber {
+public:
+    std::vector<gms::application_state_map> changes;
+
+    virtual future<> on_join(gms::inet_address, gms::endpoint_state_ptr, gms::permit_id) override { return make_ready_future(); }
+    virtual future<> on_change(gms::inet_address, const gms::application_state_map& states, gms::permit_id) override {
+        changes.push_back(states);
+        return make_ready_future();
+    }
+    virtual future<> on_alive(gms::inet_address, gms::endpoint_state_ptr, gms::permit_id) override { return make_ready_future(); }
+    virtual future<> on_dead(gms::inet_address, gms::endpoint_state_ptr, gms::permit_id) override { return make_ready_future(); }
+    virtual future<> on_remove(gms::inet_address, gms::permit_id) override { return make_ready_future(); }
+    virtual future<> on_restart(gms::inet_address, gms::endpoint_state_ptr, gms::permit_id) override { return make_ready_future(); }
+};
+
+} // anonymous namespace
+
+// In every gossip round most of the received endpoint states differ from the
+// local ones only by a newer heart beat. Such updates are applied in place on
+// shard 0, without replicating the endpoint state to the other shards nor
+// notifying the subscribers. Updates which carry an application state which
+// is newer than the local one, or missing locally, go through the full path.
+SEASTAR_TEST_CASE(test_heart_beat_only_update_is_applied_in_place) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        auto& g = e.gossiper().local();
+        const auto ep = gms::inet_address("127.0.0.2");
+        const auto host_id = locator::host_id::create_random_id();
+
+        // Generated before the endpoint state, so its version is lower than
+        // the versions of the endpoint's application states.
+        const auto old_severity = gms::versioned_value::severity(0.5);
+
+        // The endpoint has left, so the gossiper doesn't try to contact it.
+        auto left = gms::versioned_value::left({}, std::numeric_limits<int64_t>::max());
+        g.add_saved_endpoint(host_id, gms::loaded_endpoint_state{.endpoint = ep, .opt_status = std::move(left)}, gms::null_permit_id).get();
+
+        auto subscriber = make_shared<change_recorder>();
+        g.register_(subscriber);
+        auto unregister = defer([&] {
+            g.unregister_(subscriber).get();
+        });
+
+        // Returns the heart beat version of the endpoint on each shard.
+        auto heart_beat_versions = [&] {
+            return e.gossiper().map([ep] (gms::gossiper& g) {
+                return g.get_endpoint_state_ptr(ep)->get_heart_beat_state().get_heart_beat_version();
+            }).get();
+        };
+        // Returns the version of the endpoint's SEVERITY on each shard.
+        auto severity_versions = [&] {
+            return e.gossiper().map([ep] (gms::gossiper& g) {
+                auto value = g.get_endpoint_state_ptr(ep)->get_application_state_ptr(gms::application_state::SEVERITY);
+                return value ? std::make_optional(value->version()) : std::nullopt;
+            }).get();
+        };
+
+        // Applies a remote state of the endpoint with a newer heart beat, and
+        // the given application states. Returns whether it was applied in place.
+        auto apply = [&] (std::vector<std::pair<gms::application_state, gms::versioned_value>> states) {
+            auto local = g.get_endpoint_state_ptr(ep);
+            auto changes = subscriber->changes.size();
+            auto hbs = gms::heart_beat_state(local->get_heart_beat_state().get_generation(), gms::version_generator::get_next_version());
+            gms::endpoint_state remote(hbs);
+            remote.add_application_state(gms::application_state::HOST_ID, *local->get_application_state_ptr(gms::application_state::HOST_ID));
+            for (auto& [state, value] : states) {
+                remote.add_application_state(state, value);
+            }
+            std::map<gms::inet_address, gms::endpoint_state> map;
+            map.emplace(ep, std::move(remote));
+            g.apply_state_locally(std::move(map)).get();
+
+            auto applied = g.get_endpoint_state_ptr(ep);
+            auto versions = heart_beat_versions();
+            BOOST_REQUIRE(versions[this_shard_id()] == hbs.get_heart_beat_version());
+            // The heart beat is valid only on shard 0, the other shards see
+            // it only when the endpoint state is replicated.
+            bool in_place = applied.get() == local.get();
+            for (unsigned shard = 0; shard < smp::count; ++shard) {
+                if (shard != this_shard_id()) {
+                    BOOST_REQUIRE_EQUAL(versions[shard] == hbs.get_heart_beat_version(), !in_place);
+                }
+            }
+            BOOST_REQUIRE_EQUAL(subscriber->changes.size(), in_place ? changes : changes + 1);
+            return in_place;
+        };
+
+        // Only the heart beat is newer.
+        BOOST_REQUIRE(apply({}));
+        BOOST_REQUIRE(apply({}));
+
+        // An application state which is missing locally is applied, even
+        // though its version is lower than the local ones.
+        BOOST_REQUIRE(!apply({{gms::application_state::SEVERITY, old_severity}}));
+        BOOST_REQUIRE_EQUAL(subscriber->changes.back().size(), 1u);
+        BOOST_REQUIRE_EQUAL(subscriber->changes.back().at(gms::application_state::SEVERITY).value(), old_severity.value());
+        for (auto version : severity_versions()) {
+            BOOST_REQUIRE(version == old_severity.version());
+        }
+
+        // The application state is the same as the local one.
+        BOOST_REQUIRE(apply({{gms::application_state::SEVERITY, old_severity}}));
+
+        // The application state is newer than the local one.
+        const auto new_severity = gms::versioned_value::severity(1.0);
+        BOOST_REQUIRE(!apply({{gms::application_state::SEVERITY, new_severity}}));
+        BOOST_REQUIRE_EQUAL(subscriber->changes.back().size(), 1u);
+        BOOST_REQUIRE_EQUAL(subscriber->changes.back().at(gms::application_state::SEVERITY).value(), new_severity.value());
+        for (auto version : severity_versions()) {
+            BOOST_REQUIRE(version == new_severity.version());
+        }
+
+        // An older application state is ignored.
+        BOOST_REQUIRE(apply({{gms::application_state::SEVERITY, old_severity}}));
+    });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
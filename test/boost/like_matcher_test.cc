@@ -443,3 +443,37 @@ BOOST_AUTO_TEST_CASE(test_reset) {
     BOOST_TEST(matches(m, u8"alpha"));
     BOOST_TEST(!matches(m, u8"omega"));
 }
+
+BOOST_AUTO_TEST_CASE(test_long_text) {
+    const std::string filler(100, 'x');
+    auto substring = matcher(u8"%needle%");
+    BOOST_TEST(matches(substring, (filler + "needle" + filler).c_str()));
+    BOOST_TEST(matches(substring, (filler + "needle").c_str()));
+    BOOST_TEST(matches(substring, ("needle" + filler).c_str()));
+    BOOST_TEST(!matches(substring, (filler + "needl" + filler + "eedle").c_str()));
+    BOOST_TEST(!matches(substring, (filler + "neexle" + filler).c_str()));
+
+    auto prefix = matcher(u8"xxx%");
+    BOOST_TEST(matches(prefix, filler.c_str()));
+    BOOST_TEST(!matches(prefix, ("y" + filler).c_str()));
+
+    auto suffix = matcher(u8"%xxy");
+    BOOST_TEST(matches(suffix, (filler + "y").c_str()));
+    BOOST_TEST(!matches(suffix, (filler + "yx").c_str()));
+}
+
+BOOST_AUTO_TEST_CASE(test_underscore_between_percents) {
+    auto m = matcher(u8"%a_c%e_%");
+    BOOST_TEST(matches(m, u8"abcef"));
+    BOOST_TEST(matches(m, u8"xxaШcyyeШ"));
+    BOOST_TEST(matches(m, u8"aacacaceeee"));
+    BOOST_TEST(!matches(m, u8"acef"));
+    BOOST_TEST(!matches(m, u8"abce"));
+    BOOST_TEST(!matches(m, u8"ebcaf"));
+
+    auto first = matcher(u8"%_b_%");
+    BOOST_TEST(matches(first, u8"ШbШ"));
+    BOOST_TEST(matches(first, u8"bbbb"));
+    BOOST_TEST(!matches(first, u8"bb"));
+    BOOST_TEST(!matches(first, u8""));
+}
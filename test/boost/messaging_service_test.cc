@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#define BOOST_TEST_MODULE messaging_service
+
+#include <boost/test/unit_test.hpp>
+#include <set>
+
+#include "message/messaging_service.hh"
+
+using netw::messaging_service;
+
+// Checks that every port picked by local_shard for dst_shard leads to
+// dst_shard, lies in local_shard's part of the port range, and that `seq`
+// goes over all such ports.
+static void check_shard_aware_ports(unsigned local_shard, unsigned local_shard_count, unsigned dst_shard, unsigned dst_shard_count) {
+    const unsigned range = (messaging_service::shard_aware_max_port - messaging_service::shard_aware_min_port + 1) / local_shard_count;
+    const unsigned begin = messaging_service::shard_aware_min_port + range * local_shard;
+    std::set<uint16_t> expected;
+    for (unsigned port = begin; port < begin + range; ++port) {
+        if (port % dst_shard_count == dst_shard) {
+            expected.insert(port);
+        }
+    }
+    BOOST_REQUIRE(!expected.empty());
+
+    std::set<uint16_t> picked;
+    for (unsigned seq = 0; seq < 2 * expected.size(); ++seq) {
+        auto port = messaging_service::shard_aware_port(local_shard, local_shard_count, dst_shard, dst_shard_count, seq);
+        BOOST_REQUIRE(port);
+        BOOST_REQUIRE_EQUAL(*port % dst_shard_count, dst_shard);
+        BOOST_REQUIRE_GE(*port, begin);
+        BOOST_REQUIRE_LT(*port, begin + range);
+        picked.insert(*port);
+    }
+    BOOST_REQUIRE(picked == expected);
+}
+
+BOOST_AUTO_TEST_CASE(test_shard_aware_port_same_shard_count) {
+    for (unsigned shard_count : {1, 2, 8}) {
+        for (unsigned local_shard = 0; local_shard < shard_count; ++local_shard) {
+            for (unsigned dst_shard = 0; dst_shard < shard_count; ++dst_shard) {
+                check_shard_aware_ports(local_shard, shard_count, dst_shard, shard_count);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_shard_aware_port_more_local_shards) {
+    // More local shards than shards of the destination node, with local
+    // ranges which don't start at a multiple of the destination shard count.
+    for (auto [local_shard_count, dst_shard_count] : {std::pair{3u, 2u}, {64u, 5u}, {7u, 3u}}) {
+        for (unsigned local_shard = 0; local_shard < local_shard_count; ++local_shard) {
+            for (unsigned dst_shard = 0; dst_shard < dst_shard_count; ++dst_shard) {
+                check_shard_aware_ports(local_shard, local_shard_count, dst_shard, dst_shard_count);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_shard_aware_port_more_destination_shards) {
+    for (auto [local_shard_count, dst_shard_count] : {std::pair{2u, 7u}, {5u, 64u}}) {
+        for (unsigned local_shard = 0; local_shard < local_shard_count; ++local_shard) {
+            for (unsigned dst_shard = 0; dst_shard < dst_shard_count; ++dst_shard) {
+                check_shard_aware_ports(local_shard, local_shard_count, dst_shard, dst_shard_count);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_shard_aware_port_uneven_ranges) {
+    // The port range isn't divisible by the local shard count. The last
+    // local shard's part still ends within the range.
+    const unsigned local_shard_count = 3;
+    for (unsigned dst_shard = 0; dst_shard < 4; ++dst_shard) {
+        for (unsigned seq = 0; seq < 5000; ++seq) {
+            auto port = messaging_service::shard_aware_port(local_shard_count - 1, local_shard_count, dst_shard, 4, seq);
+            BOOST_REQUIRE(port);
+            BOOST_REQUIRE_LE(*port, messaging_service::shard_aware_max_port);
+        }
+    }
+    check_shard_aware_ports(local_shard_count - 1, local_shard_count, 3, 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_shard_aware_port_unavailable) {
+    // The destination shard isn't known.
+    BOOST_REQUIRE(!messaging_service::shard_aware_port(0, 1, 0, 0, 0));
+    BOOST_REQUIRE(!messaging_service::shard_aware_port(0, 1, 4, 4, 0));
+    // A local shard's part of the range is smaller than the shard count of the
+    // destination, so some of its shards can't be reached.
+    BOOST_REQUIRE(!messaging_service::shard_aware_port(0, 1024, 0, 32, 0));
+}
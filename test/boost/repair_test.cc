@@ -21,8 +21,12 @@
 #undef SEASTAR_TESTING_MAIN
 #include <seastar/testing/test_case.hh>
 #include "test/lib/sstable_utils.hh"
+#include "test/lib/key_utils.hh"
 #include "readers/mutation_fragment_v1_stream.hh"
 #include "schema/schema_registry.hh"
+#include "test/lib/simple_schema.hh"
+
+#include <seastar/core/byteorder.hh>
 
 BOOST_AUTO_TEST_SUITE(repair_test)
 
@@ -140,6 +144,144 @@ SEASTAR_TEST_CASE(flush_repair_rows_on_wire_to_sstable) {
     });
 }
 
+// Sends the rows to a sink collecting the commands, and reads the rows back
+// from the commands, the way the receiving side of the RPC stream does.
+static repair_rows_on_wire send_and_receive_rows_on_wire(repair_rows_on_wire rows, bool compress, std::vector<repair_row_on_wire_with_cmd>& cmds) {
+    send_rows_on_wire([&cmds] (const repair_row_on_wire_with_cmd& cmd) {
+        cmds.push_back(cmd);
+        return make_ready_future<>();
+    }, std::move(rows), compress).get();
+    BOOST_REQUIRE(!cmds.empty());
+    BOOST_REQUIRE(cmds.back().cmd == repair_stream_cmd::end_of_current_rows);
+    repair_rows_on_wire received;
+    for (auto it = cmds.begin(); it != std::prev(cmds.end()); ++it) {
+        if (it->cmd == repair_stream_cmd::compressed_row_data) {
+            BOOST_REQUIRE(compress);
+            received.splice(received.end(), decompress_rows(it->compressed_rows));
+        } else {
+            BOOST_REQUIRE(it->cmd == repair_stream_cmd::row_data);
+            received.push_back(it->row);
+        }
+    }
+    return received;
+}
+
+using flattened_rows_on_wire = std::vector<std::pair<partition_key, const frozen_mutation_fragment*>>;
+
+static flattened_rows_on_wire flatten_rows_on_wire(const repair_rows_on_wire& rows) {
+    flattened_rows_on_wire ret;
+    for (auto& row : rows) {
+        for (auto& mf : row.get_mutation_fragments()) {
+            ret.emplace_back(row.get_key(), &mf);
+        }
+    }
+    return ret;
+}
+
+SEASTAR_TEST_CASE(test_send_rows_on_wire_compressed) {
+    return seastar::async([&] {
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+        reader_permit permit = semaphore.make_permit();
+        simple_schema ss;
+        schema_ptr s = ss.schema();
+        position_in_partition::equal_compare eq(*s);
+
+        // The first partition spans several batches. Each of its rows is sent
+        // twice in a row, as rows from different nodes are, first with a
+        // large value and then with a small one, so that batches end with the
+        // first of the two and the partition is split between them.
+        const uint32_t rows_nr = 20;
+        const sstring large_value(20 * 1024, 'a');
+        auto small_value = [] (uint32_t ck) { return format("small{}", ck); };
+        std::list<frozen_mutation_fragment> split_mfs;
+        for (uint32_t ck = 0; ck < rows_nr; ++ck) {
+            split_mfs.push_back(freeze(*s, ss.make_row(permit, ss.make_ckey(ck), large_value)));
+            split_mfs.push_back(freeze(*s, ss.make_row(permit, ss.make_ckey(ck), small_value(ck))));
+        }
+        // The second partition has a row too large to be batched.
+        std::list<frozen_mutation_fragment> large_mfs;
+        large_mfs.push_back(freeze(*s, ss.make_row(permit, ss.make_ckey(0), "v")));
+        large_mfs.push_back(freeze(*s, ss.make_row(permit, ss.make_ckey(1), sstring(compressed_rows_batch_size + 1024, 'x'))));
+        large_mfs.push_back(freeze(*s, ss.make_row(permit, ss.make_ckey(2), "v")));
+        auto split_pk = ss.make_pkey(0).key();
+        auto large_pk = ss.make_pkey(1).key();
+
+        repair_rows_on_wire input;
+        input.push_back(partition_key_and_mutation_fragments(split_pk, std::move(split_mfs)));
+        input.push_back(partition_key_and_mutation_fragments(large_pk, std::move(large_mfs)));
+        repair_rows_on_wire input_copy = input;
+        auto expected = flatten_rows_on_wire(input_copy);
+
+        std::vector<repair_row_on_wire_with_cmd> cmds;
+        repair_rows_on_wire received = send_and_receive_rows_on_wire(std::move(input), true, cmds);
+
+        // The rows are received as they were sent.
+        auto actual = flatten_rows_on_wire(received);
+        BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i) {
+            BOOST_REQUIRE(actual[i].first.equal(*s, expected[i].first));
+            BOOST_REQUIRE(actual[i].second->representation() == expected[i].second->representation());
+        }
+
+        // The large row is sent on its own, everything else in batches.
+        size_t batches = 0;
+        size_t split_rows = 0;
+        std::optional<repair_row_on_wire> last_batch_row;
+        for (auto& cmd : cmds) {
+            if (cmd.cmd == repair_stream_cmd::row_data) {
+                BOOST_REQUIRE(cmd.row.get_key().equal(*s, large_pk));
+                BOOST_REQUIRE_EQUAL(cmd.row.get_mutation_fragments().size(), 1);
+                BOOST_REQUIRE_GE(cmd.row.get_mutation_fragments().front().representation().size(), compressed_rows_batch_size);
+            } else if (cmd.cmd == repair_stream_cmd::compressed_row_data) {
+                ++batches;
+                auto batch = decompress_rows(cmd.compressed_rows);
+                BOOST_REQUIRE(!batch.empty());
+                // Count the rows whose two fragments are in different batches.
+                if (last_batch_row && last_batch_row->get_key().equal(*s, batch.front().get_key())) {
+                    auto last_mf = last_batch_row->get_mutation_fragments().back().unfreeze(*s, permit);
+                    auto first_mf = batch.front().get_mutation_fragments().front().unfreeze(*s, permit);
+                    if (eq(last_mf.position(), first_mf.position())) {
+                        ++split_rows;
+                    }
+                }
+                last_batch_row = batch.back();
+            }
+        }
+        BOOST_REQUIRE_EQUAL(std::ranges::count(cmds, repair_stream_cmd::row_data, &repair_row_on_wire_with_cmd::cmd), 1);
+        BOOST_REQUIRE_GE(batches, 3);
+        BOOST_REQUIRE_GE(split_rows, 1);
+
+        // The follower merges the fragments of a row, even if they were in
+        // different batches.
+        uint64_t seed = tests::random::get_int<uint64_t>();
+        auto rows = to_repair_rows_list(std::move(received), s, seed, repair_master::no, permit, repair_hasher(seed, s)).get();
+        BOOST_REQUIRE_EQUAL(rows.size(), rows_nr + 3);
+        auto row_it = rows.begin();
+        for (uint32_t ck = 0; ck < rows_nr; ++ck, ++row_it) {
+            BOOST_REQUIRE(row_it->get_dk_with_hash()->dk.key().equal(*s, split_pk));
+            auto& cr = row_it->get_mutation_fragment().as_clustering_row();
+            BOOST_REQUIRE(cr.key().equal(*s, ss.make_ckey(ck)));
+            BOOST_REQUIRE_EQUAL(ss.get_value(*s, cr).first, small_value(ck));
+        }
+
+        // Without compression, each partition is sent on its own.
+        cmds.clear();
+        received = send_and_receive_rows_on_wire(std::move(input_copy), false, cmds);
+        BOOST_REQUIRE_EQUAL(cmds.size(), 3);
+        actual = flatten_rows_on_wire(received);
+        BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+    });
+}
+
+SEASTAR_TEST_CASE(test_decompress_rows_rejects_oversized_batch) {
+    return seastar::async([&] {
+        bytes oversized(sizeof(uint32_t) + 16, int8_t(0));
+        write_le<uint32_t>(reinterpret_cast<char*>(oversized.data()), max_compressed_rows_batch_size + 1);
+        BOOST_REQUIRE_THROW(decompress_rows(oversized), std::runtime_error);
+        BOOST_REQUIRE_THROW(decompress_rows(bytes(2, int8_t(0))), std::runtime_error);
+    });
+}
+
 SEASTAR_TEST_CASE(test_reader_with_different_strategies) {
     // The test generates random mutations and persists them into the database.
     // It then tries to read them back with different repair_reader read_strategies.
@@ -242,6 +384,55 @@ SEASTAR_TEST_CASE(test_reader_with_different_strategies) {
     });
 }
 
+SEASTAR_TEST_CASE(test_reader_skips_repaired_sstables) {
+    // Incremental repair marks the sstables it synced as repaired, and the
+    // following repairs read only the memtables and the unrepaired sstables.
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        e.execute_cql("CREATE TABLE ks.t (pk int PRIMARY KEY, v int)").get();
+        auto& cf = e.local_db().find_column_family("ks", "t");
+        auto s = cf.schema();
+        auto keys = tests::generate_partition_keys(3, s);
+        auto insert = [&] (const dht::decorated_key& key) {
+            mutation m(s, key);
+            m.set_clustered_cell(clustering_key::make_empty(), bytes("v"), data_value(int32_t(0)), api::new_timestamp());
+            e.get_storage_proxy().local().mutate_locally(m, tracing::trace_state_ptr(), db::commitlog::force_sync::no).get();
+        };
+
+        insert(keys[0]);
+        cf.flush().get();
+        for (auto& sst : *cf.get_sstables()) {
+            sst->mutate_repaired_at(1000).get();
+        }
+        insert(keys[1]);
+        cf.flush().get();
+        insert(keys[2]);
+
+        auto read_keys = [&] (bool unrepaired_only) {
+            auto reader = repair_reader(e.db(), cf, s, make_reader_permit(e), dht::token_range::make_open_ended_both_sides(),
+                    s->get_sharder(), this_shard_id(), 0, repair_reader::read_strategy::local, gc_clock::now(), unrepaired_only);
+            std::vector<dht::decorated_key> result;
+            while (auto mf = reader.read_mutation_fragment().get()) {
+                if (mf->is_partition_start()) {
+                    result.push_back(mf->as_partition_start().key());
+                }
+            }
+            reader.on_end_of_stream().get();
+            reader.close().get();
+            return result;
+        };
+        auto require_keys = [&] (const std::vector<dht::decorated_key>& result, std::vector<dht::decorated_key> expected) {
+            BOOST_REQUIRE_EQUAL(result.size(), expected.size());
+            for (size_t i = 0; i < result.size(); ++i) {
+                BOOST_REQUIRE(result[i].equal(*s, expected[i]));
+            }
+        };
+
+        require_keys(read_keys(false), keys);
+        // The partition in the repaired sstable is skipped.
+        require_keys(read_keys(true), {keys[1], keys[2]});
+    });
+}
+
 SEASTAR_TEST_CASE(repair_rows_size_considers_external_memory) {
     return seastar::async([&] {
         tests::reader_concurrency_semaphore_wrapper semaphore;
@@ -16,6 +16,7 @@
 #include "test/lib/select_statement_utils.hh"
 #include "transport/messages/result_message.hh"
 #include "service/pager/paging_state.hh"
+#include "service/storage_proxy.hh"
 #include "types/map.hh"
 #include "types/list.hh"
 #include "types/set.hh"
@@ -2006,4 +2007,221 @@ SEASTAR_TEST_CASE(test_returning_failure_from_ghost_rows_deletion) {
     });
 }
 
+SEASTAR_TEST_CASE(test_covering_index) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        auto& qp = e.local_qp();
+        cquery_nofail(e, "CREATE TABLE users (userid int, name text, email text, country text, PRIMARY KEY (userid));");
+        cquery_nofail(e, "CREATE INDEX ON users (email) INCLUDE (name);");
+        cquery_nofail(e, "INSERT INTO users (userid, name, email, country) VALUES (0, 'Bondie Easseby', 'beassebyv@house.gov', 'France');");
+        cquery_nofail(e, "INSERT INTO users (userid, name, email, country) VALUES (1, 'Demetri Curror', 'dcurrorw@techcrunch.com', 'France');");
+
+        // Selecting only the key, the indexed column and the included columns
+        // is answered from the index.
+        eventually([&] {
+            auto covered_reads = qp.get_cql_stats().secondary_index_covered_reads;
+            auto msg = cquery_nofail(e, "SELECT userid, name, email FROM users WHERE email = 'dcurrorw@techcrunch.com';");
+            assert_that(msg).is_rows().with_rows({
+                { int32_type->decompose(1), utf8_type->decompose(sstring("Demetri Curror")), utf8_type->decompose(sstring("dcurrorw@techcrunch.com")) },
+            });
+            BOOST_REQUIRE_EQUAL(qp.get_cql_stats().secondary_index_covered_reads, covered_reads + 1);
+        });
+
+        // Updates of the included column are reflected in the index.
+        cquery_nofail(e, "UPDATE users SET name = 'Demetri C.' WHERE userid = 1;");
+        eventually([&] {
+            auto msg = cquery_nofail(e, "SELECT name FROM users WHERE email = 'dcurrorw@techcrunch.com';");
+            assert_that(msg).is_rows().with_rows({
+                { utf8_type->decompose(sstring("Demetri C.")) },
+            });
+        });
+
+        // Columns not stored in the index are read from the base table.
+        auto covered_reads = qp.get_cql_stats().secondary_index_covered_reads;
+        auto msg = cquery_nofail(e, "SELECT name, country FROM users WHERE email = 'beassebyv@house.gov';");
+        assert_that(msg).is_rows().with_rows({
+            { utf8_type->decompose(sstring("Bondie Easseby")), utf8_type->decompose(sstring("France")) },
+        });
+        msg = cquery_nofail(e, "SELECT * FROM users WHERE email = 'beassebyv@house.gov';");
+        assert_that(msg).is_rows().with_size(1);
+        msg = cquery_nofail(e, "SELECT toJson(name) FROM users WHERE email = 'beassebyv@house.gov';");
+        assert_that(msg).is_rows().with_size(1);
+        BOOST_REQUIRE_EQUAL(qp.get_cql_stats().secondary_index_covered_reads, covered_reads);
+
+        // The included columns are described together with the index, and are
+        // protected from being dropped.
+        msg = cquery_nofail(e, "DESC INDEX users_email_idx;");
+        assert_that(msg).is_rows().with_size(1);
+        BOOST_REQUIRE_THROW(e.execute_cql("ALTER TABLE users DROP name;").get(), exceptions::invalid_request_exception);
+        cquery_nofail(e, "DROP INDEX users_email_idx;");
+        cquery_nofail(e, "ALTER TABLE users DROP name;");
+    });
+}
+
+SEASTAR_TEST_CASE(test_covering_index_paging) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (p int, c int, v int, w int, PRIMARY KEY (p, c));");
+        cquery_nofail(e, "CREATE INDEX ON t (v) INCLUDE (w);");
+        for (int i = 0; i < 10; ++i) {
+            cquery_nofail(e, format("INSERT INTO t (p, c, v, w) VALUES ({}, {}, 1, {});", i % 3, i, i * 10));
+        }
+        eventually([&] {
+            auto msg = cquery_nofail(e, "SELECT p, c, w FROM t WHERE v = 1;");
+            assert_that(msg).is_rows().with_size(10);
+        });
+
+        auto qo = std::make_unique<cql3::query_options>(db::consistency_level::LOCAL_ONE, std::vector<cql3::raw_value>{},
+                cql3::query_options::specific_options{3, nullptr, {}, api::new_timestamp()});
+        size_t rows = 0;
+        lw_shared_ptr<service::pager::paging_state> paging_state;
+        do {
+            auto msg = e.execute_cql("SELECT p, c, w FROM t WHERE v = 1;", std::move(qo)).get();
+            auto rows_msg = dynamic_pointer_cast<cql_transport::messages::result_message::rows>(msg);
+            BOOST_REQUIRE(rows_msg);
+            rows += rows_msg->rs().result_set().size();
+            paging_state = rows_msg->rs().get_metadata().paging_state()
+                    ? make_lw_shared<service::pager::paging_state>(*rows_msg->rs().get_metadata().paging_state())
+                    : nullptr;
+            qo = std::make_unique<cql3::query_options>(db::consistency_level::LOCAL_ONE, std::vector<cql3::raw_value>{},
+                    cql3::query_options::specific_options{3, paging_state, {}, api::new_timestamp()});
+        } while (paging_state);
+        BOOST_REQUIRE_EQUAL(rows, 10);
+    });
+}
+
+SEASTAR_TEST_CASE(test_covering_index_validation) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (p int, c int, s int static, v int, w int, m map<int, int>, PRIMARY KEY (p, c));");
+        BOOST_REQUIRE_THROW(e.execute_cql("CREATE INDEX ON t (v) INCLUDE (c);").get(), exceptions::invalid_request_exception);
+        BOOST_REQUIRE_THROW(e.execute_cql("CREATE INDEX ON t (v) INCLUDE (v);").get(), exceptions::invalid_request_exception);
+        BOOST_REQUIRE_THROW(e.execute_cql("CREATE INDEX ON t (v) INCLUDE (s);").get(), exceptions::invalid_request_exception);
+        BOOST_REQUIRE_THROW(e.execute_cql("CREATE INDEX ON t (v) INCLUDE (w, w);").get(), exceptions::invalid_request_exception);
+        BOOST_REQUIRE_THROW(e.execute_cql("CREATE INDEX ON t (v) INCLUDE (nonexistent);").get(), exceptions::invalid_request_exception);
+        BOOST_REQUIRE_THROW(e.execute_cql("CREATE INDEX ON t (c) INCLUDE (w);").get(), exceptions::invalid_request_exception);
+        BOOST_REQUIRE_THROW(e.execute_cql("CREATE INDEX ON t (values(m)) INCLUDE (w);").get(), exceptions::invalid_request_exception);
+        cquery_nofail(e, "CREATE INDEX ON t (v) INCLUDE (w, m);");
+        cquery_nofail(e, "CREATE INDEX ON t ((p), v) INCLUDE (w);");
+    });
+}
+
+// A column included in a covering index can't be dropped while the index
+// exists. Dropping other columns doesn't affect the covered reads.
+SEASTAR_TEST_CASE(test_covering_index_drop_included_column) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        auto& qp = e.local_qp();
+        using exception_predicate::message_contains;
+        cquery_nofail(e, "CREATE TABLE t (p int PRIMARY KEY, v int, w int, x int, y int);");
+        cquery_nofail(e, "CREATE INDEX t_v_idx ON t (v) INCLUDE (w, x);");
+        cquery_nofail(e, "INSERT INTO t (p, v, w, x, y) VALUES (0, 1, 2, 3, 4);");
+
+        auto require_covered = [&] {
+            eventually([&] {
+                auto covered_reads = qp.get_cql_stats().secondary_index_covered_reads;
+                auto msg = cquery_nofail(e, "SELECT p, w, x FROM t WHERE v = 1;");
+                assert_that(msg).is_rows().with_rows({
+                    { int32_type->decompose(0), int32_type->decompose(2), int32_type->decompose(3) },
+                });
+                BOOST_REQUIRE_EQUAL(qp.get_cql_stats().secondary_index_covered_reads, covered_reads + 1);
+            });
+        };
+        require_covered();
+
+        BOOST_REQUIRE_EXCEPTION(e.execute_cql("ALTER TABLE t DROP w;").get(), exceptions::invalid_request_exception,
+                message_contains("included in secondary index t_v_idx"));
+        BOOST_REQUIRE_EXCEPTION(e.execute_cql("ALTER TABLE t DROP (y, x);").get(), exceptions::invalid_request_exception,
+                message_contains("included in secondary index t_v_idx"));
+        // The failed drops didn't change the table nor the index.
+        auto msg = cquery_nofail(e, "SELECT w, x, y FROM t WHERE p = 0;");
+        assert_that(msg).is_rows().with_rows({
+            { int32_type->decompose(2), int32_type->decompose(3), int32_type->decompose(4) },
+        });
+        require_covered();
+
+        // A column which isn't included can be dropped.
+        cquery_nofail(e, "ALTER TABLE t DROP y;");
+        require_covered();
+
+        // Once the index is replaced by one which doesn't include the column,
+        // the column can be dropped, and the new index covers the remaining ones.
+        cquery_nofail(e, "DROP INDEX t_v_idx;");
+        cquery_nofail(e, "CREATE INDEX t_v_idx ON t (v) INCLUDE (x);");
+        cquery_nofail(e, "ALTER TABLE t DROP w;");
+        eventually([&] {
+            auto covered_reads = qp.get_cql_stats().secondary_index_covered_reads;
+            auto msg = cquery_nofail(e, "SELECT p, x FROM t WHERE v = 1;");
+            assert_that(msg).is_rows().with_rows({
+                { int32_type->decompose(0), int32_type->decompose(3) },
+            });
+            BOOST_REQUIRE_EQUAL(qp.get_cql_stats().secondary_index_covered_reads, covered_reads + 1);
+        });
+    });
+}
+
+SEASTAR_TEST_CASE(test_index_rows_of_one_partition_fetched_together) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (p int, c int, v int, PRIMARY KEY (p, c)) WITH CLUSTERING ORDER BY (c DESC);");
+        cquery_nofail(e, "CREATE INDEX ON t (v);");
+        cquery_nofail(e, "CREATE INDEX ON t ((p), v);");
+        for (int p = 0; p < 4; ++p) {
+            for (int c = 0; c < 10; ++c) {
+                cquery_nofail(e, format("INSERT INTO t (p, c, v) VALUES ({}, {}, {});", p, c, c % 2));
+            }
+        }
+
+        auto expected = [] (int p) {
+            std::vector<std::vector<bytes_opt>> rows;
+            for (int c = 9; c >= 0; c -= 2) {
+                rows.push_back({int32_type->decompose(p), int32_type->decompose(c)});
+            }
+            return rows;
+        };
+        eventually([&] {
+            // Global index
+            auto msg = cquery_nofail(e, "SELECT p, c FROM t WHERE v = 1;");
+            assert_that(msg).is_rows().with_size(20);
+            msg = cquery_nofail(e, "SELECT p, c FROM t WHERE v = 1 AND p = 2;");
+            assert_that(msg).is_rows().with_rows(expected(2));
+            // Local index
+            msg = cquery_nofail(e, "SELECT p, c FROM t WHERE p = 3 AND v = 1;");
+            assert_that(msg).is_rows().with_rows(expected(3));
+        });
+
+        // Aggregation reads the posting list in internal pages, each read
+        // while the base rows of the previous one are fetched.
+        for (int page_size : {1, 3, 7, 100}) {
+            cql3::statements::set_internal_paging_size_guard g(page_size);
+            auto msg = cquery_nofail(e, "SELECT count(*) FROM t WHERE v = 1;");
+            assert_that(msg).is_rows().with_rows({{long_type->decompose(int64_t(20))}});
+            msg = cquery_nofail(e, "SELECT count(*), max(c) FROM t WHERE p = 1 AND v = 0;");
+            assert_that(msg).is_rows().with_rows({{long_type->decompose(int64_t(5)), int32_type->decompose(8)}});
+        }
+    });
+}
+
+// Partitions whose matching rows have the same clustering keys are read with
+// a single multi-partition read, which is sent to the replica in batches.
+SEASTAR_TEST_CASE(test_index_rows_of_many_partitions_fetched_together) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        cquery_nofail(e, "CREATE TABLE t (p int, c int, v int, PRIMARY KEY (p, c));");
+        cquery_nofail(e, "CREATE INDEX ON t (v);");
+        const int partitions = 50;
+        std::vector<std::vector<bytes_opt>> expected;
+        for (int p = 0; p < partitions; ++p) {
+            for (int c = 0; c < 3; ++c) {
+                cquery_nofail(e, format("INSERT INTO t (p, c, v) VALUES ({}, {}, {});", p, c, c % 2));
+            }
+            expected.push_back({int32_type->decompose(p), int32_type->decompose(1)});
+        }
+
+        auto batched_reads = [&] {
+            return e.get_storage_proxy().local().get_stats().batched_data_reads;
+        };
+        eventually([&] {
+            auto batched_before = batched_reads();
+            auto msg = cquery_nofail(e, "SELECT p, c FROM t WHERE v = 1;");
+            assert_that(msg).is_rows().with_rows_ignore_order(expected);
+            BOOST_REQUIRE_GT(batched_reads(), batched_before);
+        });
+    });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
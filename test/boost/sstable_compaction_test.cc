@@ -3581,6 +3581,67 @@ SEASTAR_TEST_CASE(compaction_strategy_aware_major_compaction_test) {
     });
 }
 
+SEASTAR_TEST_CASE(repaired_and_unrepaired_sstables_are_compacted_apart_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        auto s = schema_builder(some_keyspace, some_column_family)
+                .with_column("id", utf8_type, column_kind::partition_key)
+                .with_column("value", int32_type)
+                .build();
+
+        auto cf = env.make_table_for_tests(s);
+        auto close_cf = deferred_stop(cf);
+        cf->set_compaction_strategy(sstables::compaction_strategy_type::size_tiered);
+        auto& cm = cf->get_compaction_manager();
+
+        const auto key = tests::generate_partition_key(s);
+        int32_t value = 0;
+        auto add_sstables = [&] (int count, uint64_t repaired_at) {
+            std::unordered_set<sstables::shared_sstable> ssts;
+            for (auto i = 0; i < count; ++i) {
+                ++value;
+                mutation m(s, key);
+                m.set_clustered_cell(clustering_key::make_empty(), bytes("value"), data_value(value), api::timestamp_type(value));
+                auto sst = make_sstable_containing(env.make_sstable(s), {std::move(m)});
+                sst->mutate_repaired_at(repaired_at).get();
+                cf->add_sstable_and_update_cache(sst).get();
+                ssts.insert(sst);
+            }
+            return ssts;
+        };
+        auto as_set = [] (const std::vector<sstables::shared_sstable>& ssts) {
+            return ssts | std::ranges::to<std::unordered_set>();
+        };
+
+        auto min_threshold = s->min_compaction_threshold();
+        auto unrepaired = add_sstables(min_threshold, 0);
+        auto repaired = add_sstables(min_threshold, 1000);
+
+        // Regular compaction picks the unrepaired sstables first, then the
+        // repaired ones, and never the two together.
+        BOOST_REQUIRE(as_set(cm.get_sstables_for_compaction(cf.as_table_state()).sstables) == unrepaired);
+        cm.run_with_sstables_compacting(unrepaired | std::ranges::to<std::vector>(), [&] (const std::vector<sstables::shared_sstable>& compacting) {
+            BOOST_REQUIRE(as_set(compacting) == unrepaired);
+            BOOST_REQUIRE(as_set(cm.get_sstables_for_compaction(cf.as_table_state()).sstables) == repaired);
+            // Sstables which are compacting already are left out.
+            return cm.run_with_sstables_compacting(compacting, [] (const std::vector<sstables::shared_sstable>& compacting) {
+                BOOST_REQUIRE(compacting.empty());
+                return make_ready_future<>();
+            });
+        }).get();
+        BOOST_REQUIRE(as_set(cm.get_sstables_for_compaction(cf.as_table_state()).sstables) == unrepaired);
+
+        // Major compaction compacts the two sets separately.
+        cf->compact_all_sstables(tasks::task_info{}).get();
+        auto ssts = *cf->get_sstables() | std::ranges::to<std::vector>();
+        BOOST_REQUIRE_EQUAL(ssts.size(), 2);
+        BOOST_REQUIRE_EQUAL(std::ranges::count_if(ssts, std::mem_fn(&sstables::sstable::is_repaired)), 1);
+        for (auto& sst : ssts) {
+            BOOST_REQUIRE(!unrepaired.contains(sst) && !repaired.contains(sst));
+            BOOST_REQUIRE_EQUAL(sst->get_repaired_at(), sst->is_repaired() ? 1000 : 0);
+        }
+    });
+}
+
 SEASTAR_TEST_CASE(backlog_tracker_correctness_after_changing_compaction_strategy) {
     return test_env::do_with_async([] (test_env& env) {
         auto builder = schema_builder("tests", "backlog_tracker_correctness_after_changing_compaction_strategy")
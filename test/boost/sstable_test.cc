@@ -412,6 +412,52 @@ SEASTAR_TEST_CASE(statistics_rewrite) {
 
         sstp = env.reusable_sst(uncompressed_schema(), uncompressed_dir_copy.native()).get();
         BOOST_REQUIRE(sstp->get_sstable_level() == 10);
+
+        BOOST_REQUIRE(!sstp->is_repaired());
+        sstp->mutate_repaired_at(1234).get();
+
+        sstp = env.reusable_sst(uncompressed_schema(), uncompressed_dir_copy.native()).get();
+        BOOST_REQUIRE_EQUAL(sstp->get_repaired_at(), 1234);
+        BOOST_REQUIRE(sstp->is_repaired());
+        BOOST_REQUIRE_EQUAL(sstp->get_sstable_level(), 10);
+    });
+}
+
+SEASTAR_TEST_CASE(copy_sstable_components) {
+    return test_env::do_with_async([] (test_env& env) {
+        auto src = env.reusable_sst(uncompressed_schema(), uncompressed_dir()).get();
+        auto files = src->readable_file_for_all_components().get();
+
+        std::vector<component_type> components;
+        for (const auto& [c, f] : files) {
+            if (c != component_type::TOC) {
+                components.push_back(c);
+            }
+        }
+        auto dst = env.make_sstable(uncompressed_schema(), env.tempdir().path().native(), generation_from_value(2),
+                src->get_version(), src->get_format());
+        dst->open_for_copy(components);
+        for (auto c : components) {
+            auto in = make_file_input_stream(files.at(c));
+            auto out = output_stream<char>(dst->make_component_sink(c, file_output_stream_options()).get());
+            while (auto buf = in.read().get()) {
+                out.write(buf.get(), buf.size()).get();
+            }
+            in.close().get();
+            out.close().get();
+        }
+        for (auto& [c, f] : files) {
+            f.close().get();
+        }
+        dst->seal_sstable(false).get();
+
+        dst = env.reusable_sst(uncompressed_schema(), env.tempdir().path().native(), generation_from_value(2), src->get_version()).get();
+        BOOST_REQUIRE_EQUAL(dst->data_size(), src->data_size());
+        BOOST_REQUIRE(dst->get_first_decorated_key().equal(*uncompressed_schema(), src->get_first_decorated_key()));
+        BOOST_REQUIRE(dst->get_last_decorated_key().equal(*uncompressed_schema(), src->get_last_decorated_key()));
+        for (auto c : components) {
+            BOOST_REQUIRE(tests::compare_files(sstables::test(src).filename(c).native(), sstables::test(dst).filename(c).native()).get());
+        }
     });
 }
 
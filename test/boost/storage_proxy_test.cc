@@ -15,6 +15,7 @@
 
 #include "test/lib/cql_test_env.hh"
 #include "service/storage_proxy.hh"
+#include "service/replica_load_tracker.hh"
 #include "query_ranges_to_vnodes.hh"
 #include "schema/schema_builder.hh"
 
@@ -136,4 +137,38 @@ SEASTAR_THREAD_TEST_CASE(test_split_stats) {
     stats2->register_metrics_for("DC1", ep1);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_replica_load_tracker) {
+    using namespace std::chrono_literals;
+    service::replica_load_tracker tracker;
+    auto fast = locator::host_id::create_random_id();
+    auto slow = locator::host_id::create_random_id();
+    auto loaded = locator::host_id::create_random_id();
+    auto unknown = locator::host_id::create_random_id();
+
+    auto respond = [&] (locator::host_id ep, std::chrono::microseconds response_time, service::replica_load load) {
+        tracker.on_request(ep);
+        tracker.on_load_report(ep, load);
+        tracker.on_response(ep, response_time);
+    };
+    for (int i = 0; i < 10; ++i) {
+        respond(fast, 1000us, {.queue_length = 0, .service_time = 500us});
+        respond(slow, 4000us, {.queue_length = 0, .service_time = 3500us});
+        // Fast right now, but with a long queue.
+        respond(loaded, 1000us, {.queue_length = 2, .service_time = 500us});
+    }
+
+    std::vector<locator::host_id> replicas{slow, loaded, fast, unknown};
+    tracker.sort_by_score(replicas);
+    // Replicas which weren't measured yet are tried first.
+    BOOST_REQUIRE(replicas == (std::vector<locator::host_id>{unknown, fast, slow, loaded}));
+
+    // Reads outstanding to the fast replica make it less attractive.
+    tracker.on_request(fast);
+    tracker.on_request(fast);
+    BOOST_REQUIRE_GT(tracker.score(fast), tracker.score(slow));
+    tracker.on_failure(fast);
+    tracker.on_failure(fast);
+    BOOST_REQUIRE_LT(tracker.score(fast), tracker.score(slow));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
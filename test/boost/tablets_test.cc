@@ -3102,6 +3102,132 @@ SEASTAR_THREAD_TEST_CASE(test_load_balancing_resize_requests) {
     }).get();
 }
 
+SEASTAR_THREAD_TEST_CASE(test_load_balancing_evens_out_measured_load) {
+    do_with_cql_env_thread([] (auto& e) {
+        inet_address ip1("192.168.0.1");
+
+        auto host1 = host_id(next_uuid());
+
+        auto table1 = table_id(next_uuid());
+
+        unsigned shard_count = 2;
+
+        semaphore sem(1);
+        shared_token_metadata stm([&sem] () noexcept { return get_units(sem, 1); }, locator::token_metadata::config{
+            locator::topology::config{
+                .this_endpoint = ip1,
+                .this_host_id = host1,
+                .local_dc_rack = locator::endpoint_dc_rack::default_location
+            }
+        });
+
+        // Tablet counts are balanced, but both hot tablets are on shard 0.
+        stm.mutate_token_metadata([&] (locator::token_metadata& tm) -> future<> {
+            tm.update_topology(host1, locator::endpoint_dc_rack::default_location, node::state::normal, shard_count);
+            co_await tm.update_normal_tokens(std::unordered_set{token(tests::d2t(1. / 2))}, host1);
+
+            tablet_map tmap(4);
+            for (auto tid : tmap.tablet_ids()) {
+                tmap.set_tablet(tid, tablet_info {
+                    tablet_replica_set {
+                        tablet_replica {host1, shard_id(tid.value() / 2)},
+                    }
+                });
+            }
+            tablet_metadata tmeta;
+            tmeta.set_tablet_map(table1, std::move(tmap));
+            tm.set_tablets(std::move(tmeta));
+        }).get();
+
+        locator::load_stats load_stats;
+        for (auto tid : {0, 1}) {
+            load_stats.tablets[global_tablet_id{table1, tablet_id(tid)}] = tablet_load_stats{ .reads = 1000, .read_bytes = 1 << 20 };
+        }
+        for (auto tid : {2, 3}) {
+            load_stats.tablets[global_tablet_id{table1, tablet_id(tid)}] = tablet_load_stats{ .reads = 10 };
+        }
+
+        rebalance_tablets(e.get_tablet_allocator().local(), stm, make_lw_shared(std::move(load_stats)));
+
+        auto& tmap = stm.get()->tablets().get_tablet_map(table1);
+        std::vector<unsigned> tablets_per_shard(shard_count);
+        std::vector<unsigned> hot_tablets_per_shard(shard_count);
+        for (auto tid : tmap.tablet_ids()) {
+            auto shard = tmap.get_tablet_info(tid).replicas[0].shard;
+            tablets_per_shard[shard]++;
+            if (tid.value() < 2) {
+                hot_tablets_per_shard[shard]++;
+            }
+        }
+        BOOST_REQUIRE(tablets_per_shard == std::vector<unsigned>({2, 2}));
+        BOOST_REQUIRE(hot_tablets_per_shard == std::vector<unsigned>({1, 1}));
+    }).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_load_balancing_splits_hot_tablets) {
+    do_with_cql_env_thread([] (auto& e) {
+        inet_address ip1("192.168.0.1");
+        inet_address ip2("192.168.0.2");
+
+        auto host1 = host_id(next_uuid());
+        auto host2 = host_id(next_uuid());
+
+        auto table1 = add_table(e).get();
+
+        unsigned shard_count = 2;
+
+        semaphore sem(1);
+        shared_token_metadata stm([&sem] () noexcept { return get_units(sem, 1); }, locator::token_metadata::config{
+                locator::topology::config{
+                        .this_endpoint = ip1,
+                        .this_host_id = host1,
+                        .local_dc_rack = locator::endpoint_dc_rack::default_location
+                }
+        });
+
+        stm.mutate_token_metadata([&] (token_metadata& tm) -> future<> {
+            tm.update_topology(host1, locator::endpoint_dc_rack::default_location, node::state::normal, shard_count);
+            tm.update_topology(host2, locator::endpoint_dc_rack::default_location, node::state::normal, shard_count);
+            co_await tm.update_normal_tokens(std::unordered_set{token(tests::d2t(1. / 2))}, host1);
+            co_await tm.update_normal_tokens(std::unordered_set{token(tests::d2t(2. / 2))}, host2);
+
+            tablet_map tmap(1);
+            tmap.set_tablet(tmap.first_tablet(), tablet_info {
+                    tablet_replica_set {
+                            tablet_replica {host1, 0},
+                    }
+            });
+            tablet_metadata tmeta;
+            tmeta.set_tablet_map(table1, std::move(tmap));
+            tm.set_tablets(std::move(tmeta));
+        }).get();
+
+        auto make_load_stats = [&] (uint64_t reads) {
+            return make_lw_shared<const locator::load_stats>(locator::load_stats{
+                .tables = {
+                    { table1, table_load_stats{ .size_in_bytes = 0 }},
+                },
+                .tablets = {
+                    { global_tablet_id{table1, tablet_id(0)}, tablet_load_stats{ .reads = reads }},
+                },
+            });
+        };
+
+        // The table is small, but a single shard serves all of its requests.
+        {
+            auto plan = e.get_tablet_allocator().local().balance_tablets(stm.get(), make_load_stats(1000)).get();
+            BOOST_REQUIRE(plan.resize_plan().resize.contains(table1));
+            BOOST_REQUIRE(std::holds_alternative<locator::resize_decision::split>(plan.resize_plan().resize.at(table1).way));
+        }
+
+        // Low load doesn't count as hot.
+        {
+            auto plan = e.get_tablet_allocator().local().balance_tablets(stm.get(), make_load_stats(10)).get();
+            BOOST_REQUIRE(!plan.resize_plan().resize.contains(table1));
+        }
+    }).get();
+}
+
 SEASTAR_THREAD_TEST_CASE(test_tablet_range_splitter) {
     simple_schema ss;
 
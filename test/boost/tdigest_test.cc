@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+
+#define BOOST_TEST_MODULE core
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "utils/tdigest.hh"
+
+// Returns the exact value at quantile q of sorted values, using the same
+// rank definition as tdigest::quantile().
+static double exact_quantile(const std::vector<double>& sorted, double q) {
+    auto idx = std::min(sorted.size() - 1, size_t(q * sorted.size()));
+    return sorted[idx];
+}
+
+BOOST_AUTO_TEST_CASE(test_empty) {
+    utils::tdigest d;
+    BOOST_REQUIRE(d.empty());
+    BOOST_REQUIRE(std::isnan(d.quantile(0.5)));
+    BOOST_REQUIRE_THROW(d.quantile(1.5), std::out_of_range);
+    BOOST_REQUIRE_THROW(d.quantile(-0.1), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(test_single_value) {
+    utils::tdigest d;
+    d.add(42);
+    BOOST_REQUIRE_EQUAL(d.quantile(0), 42);
+    BOOST_REQUIRE_EQUAL(d.quantile(0.5), 42);
+    BOOST_REQUIRE_EQUAL(d.quantile(1), 42);
+}
+
+BOOST_AUTO_TEST_CASE(test_accuracy) {
+    std::mt19937_64 rnd(0);
+    std::exponential_distribution<double> dist(1.0);
+    utils::tdigest d;
+    std::vector<double> values;
+    for (int i = 0; i < 100000; ++i) {
+        auto v = dist(rnd);
+        values.push_back(v);
+        d.add(v);
+    }
+    std::ranges::sort(values);
+    BOOST_REQUIRE_EQUAL(d.total_weight(), values.size());
+    BOOST_REQUIRE_EQUAL(d.quantile(0), values.front());
+    BOOST_REQUIRE_EQUAL(d.quantile(1), values.back());
+    for (auto q : {0.5, 0.9, 0.99, 0.999}) {
+        auto expected = exact_quantile(values, q);
+        BOOST_REQUIRE_CLOSE(d.quantile(q), expected, 1.0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_merge_and_serialization) {
+    std::mt19937_64 rnd(1);
+    std::uniform_real_distribution<double> dist(0, 1000);
+    std::vector<double> values;
+    // Simulate partial digests computed on different shards, shipped in
+    // serialized form and merged on the coordinator.
+    utils::tdigest merged;
+    for (int shard = 0; shard < 8; ++shard) {
+        utils::tdigest partial;
+        for (int i = 0; i < 10000 + shard; ++i) {
+            auto v = dist(rnd);
+            values.push_back(v);
+            partial.add(v);
+        }
+        merged.merge(utils::tdigest::deserialize(partial.serialize()));
+    }
+    std::ranges::sort(values);
+    BOOST_REQUIRE_EQUAL(merged.total_weight(), values.size());
+    for (auto q : {0.01, 0.5, 0.99}) {
+        BOOST_REQUIRE_CLOSE(merged.quantile(q), exact_quantile(values, q), 1.0);
+    }
+
+    // Serialization is bounded by the compression, not by the number of values.
+    BOOST_REQUIRE_LT(merged.serialize().size(), 16 * 1024);
+}
+
+BOOST_AUTO_TEST_CASE(test_deserialize_malformed) {
+    utils::tdigest d;
+    d.add(1);
+    auto serialized = d.serialize();
+    BOOST_REQUIRE_THROW(utils::tdigest::deserialize(bytes_view(serialized).substr(0, 12)), std::runtime_error);
+    BOOST_REQUIRE_THROW(utils::tdigest::deserialize(bytes_view(serialized).substr(0, serialized.size() - 3)), std::runtime_error);
+}
@@ -10,9 +10,12 @@
 
 #include <fmt/ranges.h>
 #include <fmt/std.h>
+#include <seastar/core/later.hh>
 
 #include "transport/request.hh"
 #include "transport/response.hh"
+#include "transport/zstd_compressor.hh"
+#include "utils/base64.hh"
 
 #include "test/lib/random_utils.hh"
 #include "test/lib/test_utils.hh"
@@ -160,3 +163,165 @@ SEASTAR_THREAD_TEST_CASE(test_response_request_reader) {
     BOOST_CHECK_EQUAL(req.read_short(), 1);
     BOOST_CHECK_EQUAL(req.read_string(), "zed");
 }
+
+SEASTAR_THREAD_TEST_CASE(test_zstd_compressor) {
+    using algorithm = cql_transport::zstd_compressor::algorithm;
+
+    auto dict_text = std::string_view("SELECT * FROM ks.cf WHERE pk = ? AND ck = ?; INSERT INTO ks.cf (pk, ck, v) VALUES (?, ?, ?);");
+    auto dict = cql_transport::zstd_compressor::make_dict(base64_encode(bytes(reinterpret_cast<const int8_t*>(dict_text.data()), dict_text.size())));
+    BOOST_REQUIRE(dict);
+    BOOST_REQUIRE(std::ranges::equal((*dict)->data, std::as_bytes(std::span(dict_text))));
+    BOOST_REQUIRE(!cql_transport::zstd_compressor::make_dict(""));
+
+    auto in = bytes(bytes::initialized_later(), 4096);
+    for (size_t i = 0; i < in.size(); ++i) {
+        in[i] = dict_text[i % dict_text.size()];
+    }
+
+    for (float max_cpu_fraction : {1.0f, 0.0f}) {
+        for (auto d : {utils::dict_ptr(), dict}) {
+            auto budget = cql_transport::zstd_cpu_budget(utils::updateable_value<float>(max_cpu_fraction));
+            auto compressor = cql_transport::zstd_compressor(budget, d);
+            BOOST_CHECK_EQUAL(compressor.dict(), d ? &**d : nullptr);
+            // The dictionary is charged with the tables built from it.
+            if (d) {
+                BOOST_CHECK_GT(compressor.dict_memory_usage(), dict_text.size());
+            } else {
+                BOOST_CHECK_EQUAL(compressor.dict_memory_usage(), 0u);
+            }
+
+            // With no CPU budget for zstd, the compressor falls back to lz4.
+            auto algo = compressor.choose_algorithm();
+            BOOST_CHECK(algo == (max_cpu_fraction > 0 ? algorithm::zstd : algorithm::lz4));
+            BOOST_CHECK_EQUAL(budget.fallbacks(), max_cpu_fraction > 0 ? 0u : 1u);
+
+            auto compressed = bytes(bytes::initialized_later(), cql_transport::zstd_compressor::compress_bound(algo, in.size()));
+            compressed.resize(compressor.compress(algo, in, compressed));
+            BOOST_CHECK_EQUAL(compressed[0], int8_t(algo));
+            BOOST_CHECK_LT(compressed.size(), in.size());
+            BOOST_CHECK_EQUAL(cql_transport::zstd_compressor::uncompressed_size(compressed), in.size());
+
+            auto decompressed = bytes(bytes::initialized_later(), in.size());
+            compressor.decompress(compressed, decompressed);
+            BOOST_CHECK_EQUAL(decompressed, in);
+        }
+    }
+
+    auto bad_tag = bytes(1, int8_t(0x7f));
+    BOOST_CHECK_THROW(cql_transport::zstd_compressor::uncompressed_size(bad_tag), exceptions::protocol_exception);
+
+    // Dictionaries sent by the client are limited in size and have to be valid base64.
+    auto max_dict_size = cql_transport::zstd_compressor::max_dict_size;
+    BOOST_CHECK_LE(base64_encode(bytes(max_dict_size, int8_t('x'))).size(), std::numeric_limits<uint16_t>::max());
+    BOOST_CHECK(cql_transport::zstd_compressor::make_dict(base64_encode(bytes(max_dict_size, int8_t('x')))));
+    BOOST_CHECK_THROW(cql_transport::zstd_compressor::make_dict(base64_encode(bytes(max_dict_size + 1, int8_t('x')))),
+            exceptions::protocol_exception);
+    BOOST_CHECK_THROW(cql_transport::zstd_compressor::make_dict("not base64!"), exceptions::protocol_exception);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_queueing_delay_estimator) {
+    using namespace std::chrono_literals;
+    using clock_type = cql_transport::queueing_delay_estimator::clock_type;
+
+    auto estimator = cql_transport::queueing_delay_estimator();
+    auto start = clock_type::now();
+    for (int i = 0; i < 100; ++i) {
+        estimator.on_request_start();
+    }
+    // Nothing completed yet, so the capacity is unknown.
+    BOOST_REQUIRE(!estimator.estimated_delay(start));
+
+    for (int i = 0; i < 25; ++i) {
+        estimator.on_request_finish(start + 50ms);
+    }
+    // 25 requests completed in the first window, i.e. 250 per second, which
+    // is averaged with the initial 0. 75 requests in flight need 0.6s.
+    auto delay = estimator.estimated_delay(start + 100ms);
+    BOOST_REQUIRE(delay);
+    BOOST_CHECK_CLOSE(delay->count(), 0.6, 5);
+
+    // With few requests in flight, the delay isn't estimated.
+    for (int i = 0; i < 70; ++i) {
+        estimator.on_request_finish(start + 150ms);
+    }
+    BOOST_REQUIRE_EQUAL(estimator.in_flight(), 5u);
+    BOOST_REQUIRE(!estimator.estimated_delay(start + 150ms));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_response_queue) {
+    // Writes are chained on a future and send at most max_batch responses,
+    // like in cql_server::connection.
+    constexpr size_t max_batch = 4;
+    cql_transport::response_queue<int> queue;
+    future<> ready = make_ready_future<>();
+    std::vector<std::vector<int>> batches;
+    std::optional<promise<>> write_done;
+    bool writing = false;
+
+    std::function<void()> schedule_write;
+    auto write_batch = [&] () -> future<> {
+        queue.start_write();
+        std::vector<int> batch;
+        while (!queue.empty() && batch.size() < max_batch) {
+            batch.push_back(queue.pop());
+        }
+        batches.push_back(std::move(batch));
+        writing = true;
+        write_done.emplace();
+        co_await write_done->get_future();
+        writing = false;
+        if (queue.finish_write()) {
+            schedule_write();
+        }
+    };
+    schedule_write = [&] {
+        ready = ready.then([&] { return write_batch(); });
+    };
+    int next = 0;
+    auto push = [&] {
+        if (queue.push(next++)) {
+            schedule_write();
+        }
+    };
+    auto run_tasks = [] {
+        for (int i = 0; i < 10; ++i) {
+            seastar::yield().get();
+        }
+    };
+
+    push();
+    run_tasks();
+    BOOST_REQUIRE(writing);
+    // Responses arriving while a batch is written don't join it.
+    for (int i = 0; i < 10; ++i) {
+        push();
+    }
+    // Chained after the write of the responses above, like the continuations
+    // of a request's response.
+    bool resolved = false;
+    ready = ready.finally([&] { resolved = true; });
+
+    // Keep responses arriving while batches are written. The continuation
+    // above must run nevertheless.
+    for (int i = 0; i < 10 && !resolved; ++i) {
+        write_done->set_value();
+        run_tasks();
+        push();
+        push();
+    }
+    BOOST_REQUIRE(resolved);
+
+    while (writing) {
+        write_done->set_value();
+        run_tasks();
+    }
+    ready.get();
+
+    std::vector<int> written;
+    for (auto& batch : batches) {
+        BOOST_REQUIRE_LE(batch.size(), max_batch);
+        written.insert(written.end(), batch.begin(), batch.end());
+    }
+    auto expected = std::views::iota(0, next) | std::ranges::to<std::vector<int>>();
+    BOOST_REQUIRE(written == expected);
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <seastar/testing/perf_tests.hh>
+#include <seastar/testing/test_runner.hh>
+
+#include <boost/regex/icu.hpp>
+#include <cstring>
+#include <random>
+
+#include "bytes.hh"
+#include "utils/like_matcher.hh"
+
+// Matches a set of random texts against LIKE patterns of every kind which
+// like_matcher handles specially. The `regex_*` cases match the same texts
+// with an ICU regex, the way like_matcher used to, as a baseline.
+class like_matcher_test {
+public:
+    static constexpr size_t count = 1000;
+private:
+    std::vector<bytes> _texts;
+public:
+    like_matcher_test() {
+        auto eng = seastar::testing::local_random_engine;
+        auto len_dist = std::uniform_int_distribution<size_t>(10, 100);
+        auto char_dist = std::uniform_int_distribution<int>('a', 'z');
+        _texts.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            bytes text(bytes::initialized_later(), len_dist(eng));
+            std::generate(text.begin(), text.end(), [&] { return char_dist(eng); });
+            _texts.push_back(std::move(text));
+        }
+    }
+
+    size_t run(const like_matcher& m) const {
+        for (const auto& text : _texts) {
+            perf_tests::do_not_optimize(m(text));
+        }
+        return count;
+    }
+
+    size_t run(const boost::u32regex& re) const {
+        for (const auto& text : _texts) {
+            perf_tests::do_not_optimize(boost::u32regex_match(text.begin(), text.end(), re));
+        }
+        return count;
+    }
+};
+
+static like_matcher make_matcher(const char* pattern) {
+    return like_matcher(bytes(reinterpret_cast<const int8_t*>(pattern), std::strlen(pattern)));
+}
+
+static boost::u32regex make_regex(const char* re) {
+    return boost::make_u32regex(re, boost::u32regex::basic | boost::u32regex::optimize);
+}
+
+PERF_TEST_F(like_matcher_test, exact) {
+    static const auto m = make_matcher("abcdefgh");
+    return run(m);
+}
+
+PERF_TEST_F(like_matcher_test, prefix) {
+    static const auto m = make_matcher("ab%");
+    return run(m);
+}
+
+PERF_TEST_F(like_matcher_test, suffix) {
+    static const auto m = make_matcher("%yz");
+    return run(m);
+}
+
+PERF_TEST_F(like_matcher_test, substring) {
+    static const auto m = make_matcher("%qrs%");
+    return run(m);
+}
+
+PERF_TEST_F(like_matcher_test, general) {
+    static const auto m = make_matcher("a%b_c%d");
+    return run(m);
+}
+
+PERF_TEST_F(like_matcher_test, regex_prefix) {
+    static const auto re = make_regex("ab.*");
+    return run(re);
+}
+
+PERF_TEST_F(like_matcher_test, regex_substring) {
+    static const auto re = make_regex(".*qrs.*");
+    return run(re);
+}
+
+PERF_TEST_F(like_matcher_test, regex_general) {
+    static const auto re = make_regex("a.*b.c.*d");
+    return run(re);
+}
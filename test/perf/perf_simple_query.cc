@@ -72,12 +72,14 @@ struct test_config {
     bool query_single_key;
     unsigned duration_in_seconds;
     bool counters;
+    bool lwt;
     bool flush_memtables;
     unsigned memtable_partitions = 0;
     unsigned operations_per_shard = 0;
     bool stop_on_error;
     sstring timeout;
     bool bypass_cache;
+    bool filter;
     std::optional<unsigned> initial_tablets;
 };
 
@@ -105,6 +107,8 @@ std::ostream& operator<<(std::ostream& os, const test_config& cfg) {
            << ", frontend=" << cfg.frontend
            << ", query_single_key=" << (cfg.query_single_key ? "yes" : "no")
            << ", counters=" << (cfg.counters ? "yes" : "no")
+           << ", lwt=" << (cfg.lwt ? "yes" : "no")
+           << ", filter=" << (cfg.filter ? "yes" : "no")
            << "}";
 }
 
@@ -140,6 +144,11 @@ static bytes make_random_key(test_config& cfg) {
 static std::vector<perf_result> test_read(cql_test_env& env, test_config& cfg) {
     create_partitions(env, cfg);
     sstring query = "select \"C0\", \"C1\", \"C2\", \"C3\", \"C4\" from cf where \"KEY\" = ?";
+    if (cfg.filter) {
+        // Restrictions on regular columns which match every row, to measure
+        // the cost of evaluating them.
+        query += " and \"C0\" >= 0x00 and \"C1\" != 0x00 and \"C2\" < 0xff allow filtering";
+    }
     if (cfg.bypass_cache) {
         query += " bypass cache";
     }
@@ -172,6 +181,29 @@ static std::vector<perf_result> test_write(cql_test_env& env, test_config& cfg)
         }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard, cfg.stop_on_error);
 }
 
+// Conditional inserts. The first insert of a key applies, the following ones
+// don't, so with enough operations per key this mostly measures the paxos
+// rounds which don't write anything. Contention is controlled with the
+// number of partitions (or --query-single-key).
+static std::vector<perf_result> test_lwt_insert(cql_test_env& env, test_config& cfg) {
+    sstring usings;
+    if (!cfg.timeout.empty()) {
+        usings += " USING TIMEOUT " + cfg.timeout;
+    }
+    sstring query = format("INSERT INTO cf (\"KEY\", \"C0\", \"C1\", \"C2\", \"C3\", \"C4\") VALUES (?, "
+            "0x8f75da6b3dcec90c8a404fb9a5f6b0621e62d39c69ba5758e5f41b78311fbb26cc7a,"
+            "0xa8761a2127160003033a8f4f3d1069b7833ebe24ef56b3beee728c2b686ca516fa51,"
+            "0x583449ce81bfebc2e1a695eb59aad5fcc74d6d7311fc6197b10693e1a161ca2e1c64,"
+            "0x62bcb1dbc0ff953abc703bcb63ea954f437064c0c45366799658bd6b91d0f92908d7,"
+            "0x222fcbe31ffa1e689540e1499b87fa3f9c781065fccd10e4772b4c7039c2efd0fb27) "
+            "IF NOT EXISTS{}", usings);
+    auto id = env.prepare(query).get();
+    return time_parallel([&env, &cfg, id] {
+            bytes key = make_random_key(cfg);
+            return env.execute_prepared(id, {{cql3::raw_value::make_value(std::move(key))}}).discard_result();
+        }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard, cfg.stop_on_error);
+}
+
 static std::vector<perf_result> test_delete(cql_test_env& env, test_config& cfg) {
     create_partitions(env, cfg);
     sstring usings;
@@ -448,6 +480,8 @@ static std::vector<perf_result> do_cql_test(cql_test_env& env, test_config& cfg)
     case test_config::run_mode::write:
         if (cfg.counters) {
             return test_counter_update(env, cfg);
+        } else if (cfg.lwt) {
+            return test_lwt_insert(env, cfg);
         } else {
             return test_write(env, cfg);
         }
@@ -494,6 +528,9 @@ void write_json_result(std::string result_file, const test_config& cfg, const ag
     if (cfg.counters) {
         test_type += "_counters";
     }
+    if (cfg.lwt) {
+        test_type += "_lwt";
+    }
     results["test_properties"]["type"] = test_type;
 
     // <version>-<release>
@@ -546,6 +583,8 @@ int scylla_simple_query_main(int argc, char** argv) {
         ("concurrency", bpo::value<unsigned>()->default_value(100), "workers per core")
         ("operations-per-shard", bpo::value<unsigned>(), "run this many operations per shard (overrides duration)")
         ("counters", "test counters")
+        ("lwt", "test conditional inserts (INSERT ... IF NOT EXISTS) in the write test")
+        ("lwt-background-learn", bpo::value<bool>()->default_value(false), "value for lwt_background_learn config entry")
         ("tablets", "use tablets")
         ("initial-tablets", bpo::value<unsigned>()->default_value(128), "initial number of tablets")
         ("flush", "flush memtables before test")
@@ -556,6 +595,7 @@ int scylla_simple_query_main(int argc, char** argv) {
         ("stop-on-error", bpo::value<bool>()->default_value(true), "stop after encountering the first error")
         ("timeout", bpo::value<std::string>()->default_value(""), "use timeout")
         ("bypass-cache", "use bypass cache when querying")
+        ("filter", "test reading with restrictions on regular columns (ALLOW FILTERING)")
         ("audit", bpo::value<std::string>(), "value for audit config entry")
         ("audit-keyspaces", bpo::value<std::string>(), "value for audit_keyspaces config entry")
         ("audit-tables", bpo::value<std::string>(), "value for audit_tables config entry")
@@ -578,6 +618,7 @@ int scylla_simple_query_main(int argc, char** argv) {
             const auto enable_cache = app.configuration()["enable-cache"].as<bool>();
             std::cout << "enable-cache=" << enable_cache << '\n';
             db_cfg->enable_cache(enable_cache);
+            db_cfg->lwt_background_learn(app.configuration()["lwt-background-learn"].as<bool>());
             cql_test_config cfg(db_cfg);
             if (app.configuration().contains("tablets")) {
                 cfg.db_config->enable_tablets.set(true);
@@ -594,6 +635,7 @@ int scylla_simple_query_main(int argc, char** argv) {
             cfg.concurrency = app.configuration()["concurrency"].as<unsigned>();
             cfg.query_single_key = app.configuration().contains("query-single-key");
             cfg.counters = app.configuration().contains("counters");
+            cfg.lwt = app.configuration().contains("lwt");
             cfg.flush_memtables = app.configuration().contains("flush");
             if (app.configuration().contains("tablets")) {
                 cfg.initial_tablets = app.configuration()["initial-tablets"].as<unsigned>();
@@ -619,6 +661,7 @@ int scylla_simple_query_main(int argc, char** argv) {
             cfg.stop_on_error = app.configuration()["stop-on-error"].as<bool>();
             cfg.timeout = app.configuration()["timeout"].as<std::string>();
             cfg.bypass_cache = app.configuration().contains("bypass-cache");
+            cfg.filter = app.configuration().contains("filter");
             audit::audit::create_audit(env.local_db().get_config(), env.get_shared_token_metadata()).handle_exception([&] (auto&& e) {
                 fmt::print("audit creation failed: {}", e);
             }).get();
@@ -170,6 +170,8 @@ struct params {
     int shards;
     int scale1 = 1;
     int scale2 = 1;
+    // The number of tablets of the first table which serve more requests than the others.
+    int hot_tablets = 0;
 };
 
 struct table_balance {
@@ -182,6 +184,8 @@ constexpr auto nr_tables = 2;
 
 struct cluster_balance {
     table_balance tables[nr_tables];
+    // The measured load of the most loaded shard relative to the average shard load.
+    double load_overcommit = 0;
 };
 
 struct results {
@@ -204,7 +208,7 @@ template<>
 struct fmt::formatter<cluster_balance> : fmt::formatter<string_view> {
     template <typename FormatContext>
     auto format(const cluster_balance& r, FormatContext& ctx) const {
-        return fmt::format_to(ctx.out(), "{{table1={}, table2={}}}", r.tables[0], r.tables[1]);
+        return fmt::format_to(ctx.out(), "{{table1={}, table2={}, load={:.2f}}}", r.tables[0], r.tables[1], r.load_overcommit);
     }
 };
 
@@ -214,11 +218,11 @@ struct fmt::formatter<params> : fmt::formatter<string_view> {
     auto format(const params& p, FormatContext& ctx) const {
         auto tablets1_per_shard = double(p.tablets1.value_or(0)) * p.rf1 / (p.nodes * p.shards);
         auto tablets2_per_shard = double(p.tablets2.value_or(0)) * p.rf2 / (p.nodes * p.shards);
-        return fmt::format_to(ctx.out(), "{{iterations={}, nodes={}, tablets1={} ({:0.1f}/sh), tablets2={} ({:0.1f}/sh), rf1={}, rf2={}, shards={}}}",
+        return fmt::format_to(ctx.out(), "{{iterations={}, nodes={}, tablets1={} ({:0.1f}/sh), tablets2={} ({:0.1f}/sh), rf1={}, rf2={}, shards={}, hot_tablets={}}}",
                          p.iterations, p.nodes,
                          p.tablets1.value_or(0), tablets1_per_shard,
                          p.tablets2.value_or(0), tablets2_per_shard,
-                         p.rf1, p.rf2, p.shards);
+                         p.rf1, p.rf2, p.shards, p.hot_tablets);
     }
 };
 
@@ -251,6 +255,9 @@ future<results> test_load_balancing_with_many_tables(params p, bool tablet_aware
             add_host();
         }
 
+        // Set once tables are allocated.
+        locator::load_stats_ptr load_stats;
+
         semaphore sem(1);
         auto stm = shared_token_metadata([&sem]() noexcept { return get_units(sem, 1); }, locator::token_metadata::config {
                 locator::topology::config {
@@ -265,7 +272,7 @@ future<results> test_load_balancing_with_many_tables(params p, bool tablet_aware
                 add_host();
                 return add_host_to_topology(tm, hosts.size() - 1);
             }).get();
-            global_res.stats += rebalance_tablets(e.get_tablet_allocator().local(), stm);
+            global_res.stats += rebalance_tablets(e.get_tablet_allocator().local(), stm, load_stats);
         };
 
         auto decommission = [&] (host_id host) {
@@ -278,7 +285,7 @@ future<results> test_load_balancing_with_many_tables(params p, bool tablet_aware
                 return make_ready_future<>();
             }).get();
 
-            global_res.stats += rebalance_tablets(e.get_tablet_allocator().local(), stm);
+            global_res.stats += rebalance_tablets(e.get_tablet_allocator().local(), stm, load_stats);
 
             stm.mutate_token_metadata([&] (token_metadata& tm) {
                 tm.remove_endpoint(host);
@@ -312,6 +319,22 @@ future<results> test_load_balancing_with_many_tables(params p, bool tablet_aware
         allocate(s1, p.rf1, p.tablets1);
         allocate(s2, p.rf2, p.tablets2);
 
+        if (p.hot_tablets) {
+            // Hot tablets are spread evenly over the token ring of the first table.
+            locator::load_stats stats;
+            const tablet_load_stats cold = { .reads = 100, .writes = 100 };
+            const tablet_load_stats hot = { .reads = 10000, .writes = 10000 };
+            for (auto s : {s1, s2}) {
+                auto& tmap = stm.get()->tablets().get_tablet_map(s->id());
+                auto hot_every = s == s1 ? std::max<size_t>(tmap.tablet_count() / p.hot_tablets, 1) : 0;
+                for (auto tid : tmap.tablet_ids()) {
+                    bool is_hot = hot_every && tid.value() % hot_every == 0;
+                    stats.tablets[global_tablet_id{s->id(), tid}] = is_hot ? hot : cold;
+                }
+            }
+            load_stats = make_lw_shared<const locator::load_stats>(std::move(stats));
+        }
+
         auto check_balance = [&] () -> cluster_balance {
             cluster_balance res;
 
@@ -358,11 +381,31 @@ future<results> test_load_balancing_with_many_tables(params p, bool tablet_aware
                 };
             }
 
+            if (load_stats) {
+                std::unordered_map<tablet_replica, double> shard_load;
+                for (auto& [tablet, stats] : load_stats->tablets) {
+                    auto& tmap = stm.get()->tablets().get_tablet_map(tablet.table);
+                    for (auto& r : tmap.get_tablet_info(tablet.tablet).replicas) {
+                        shard_load[r] += stats.load();
+                    }
+                }
+                double max_load = 0;
+                double total_load = 0;
+                for (auto& [replica, load] : shard_load) {
+                    max_load = std::max(max_load, load);
+                    total_load += load;
+                }
+                auto avg_load = total_load / (hosts.size() * shard_count);
+                res.load_overcommit = max_load / avg_load;
+                testlog.info("Shard load overcommit: {:.2f}, max={:.2f}, avg={:.2f}", res.load_overcommit, max_load, avg_load);
+            }
+
             for (int i = 0; i < nr_tables; i++) {
                 auto t = res.tables[i];
                 global_res.worst.tables[i].shard_overcommit = std::max(global_res.worst.tables[i].shard_overcommit, t.shard_overcommit);
                 global_res.worst.tables[i].node_overcommit = std::max(global_res.worst.tables[i].node_overcommit, t.node_overcommit);
             }
+            global_res.worst.load_overcommit = std::max(global_res.worst.load_overcommit, res.load_overcommit);
 
             testlog.info("Overcommit: {}", res);
             return res;
@@ -374,7 +417,7 @@ future<results> test_load_balancing_with_many_tables(params p, bool tablet_aware
 
         check_balance();
 
-        rebalance_tablets(e.get_tablet_allocator().local(), stm);
+        rebalance_tablets(e.get_tablet_allocator().local(), stm, load_stats);
 
         global_res.init = global_res.worst = check_balance();
 
@@ -445,6 +488,10 @@ future<> run_simulations(const boost::program_options::variables_map& app_cfg) {
             .scale2 = scale2,
         };
 
+        if (app_cfg.contains("hot-tablets")) {
+            p.hot_tablets = app_cfg["hot-tablets"].as<int>();
+        }
+
         auto name = format("#{}", i);
         co_await run_simulation(p, name);
     }
@@ -464,6 +511,7 @@ int scylla_tablet_load_balancing_main(int argc, char** argv) {
             ("rf1", bpo::value<int>(), "Replication factor for the first table.")
             ("rf2", bpo::value<int>(), "Replication factor for the second table.")
             ("shards", bpo::value<int>(), "Number of shards per node.")
+            ("hot-tablets", bpo::value<int>(), "Number of tablets of the first table which receive 100x more requests than others.")
             ("verbose", "Enables standard logging")
             ;
     return app.run(argc, argv, [&] {
@@ -491,6 +539,9 @@ int scylla_tablet_load_balancing_main(int argc, char** argv) {
                         .rf2 = app.configuration()["rf2"].as<int>(),
                         .shards = app.configuration()["shards"].as<int>(),
                     };
+                    if (app.configuration().contains("hot-tablets")) {
+                        p.hot_tablets = app.configuration()["hot-tablets"].as<int>();
+                    }
                     run_simulation(p).get();
                 }
             } catch (seastar::abort_requested_exception&) {
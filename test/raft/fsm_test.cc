@@ -2366,3 +2366,95 @@ BOOST_AUTO_TEST_CASE(test_state_change_notifications) {
     BOOST_CHECK(output.state_changed);
     BOOST_CHECK(fsm.is_leader());
 }
+
+static std::vector<raft::append_request> append_requests_to(const raft::fsm_output& output, server_id to) {
+    std::vector<raft::append_request> requests;
+    for (const auto& [id, m] : output.messages) {
+        if (auto req = std::get_if<raft::append_request>(&m); req && id == to) {
+            requests.push_back(*req);
+        }
+    }
+    return requests;
+}
+
+BOOST_AUTO_TEST_CASE(test_pipeline_in_flight_limit) {
+    // Check that the leader keeps at most max_in_flight_append_requests
+    // requests in flight to a follower in PIPELINE mode, and that the
+    // entries added while the limit is reached go out in one request.
+    server_id A_id = id(), B_id = id();
+    raft::log log(raft::snapshot_descriptor{.idx = index_t{0}, .config = config_from_ids({A_id, B_id})});
+    raft::fsm_config cfg{.append_request_threshold = 100000, .enable_prevoting = false, .max_in_flight_append_requests = 3};
+    fsm_debug A(A_id, term_t{}, server_id{}, log, trivial_failure_detector, cfg);
+    fsm_debug B(B_id, term_t{}, server_id{}, log, trivial_failure_detector, cfg);
+    raft_routing_map routes{{A_id, &A}, {B_id, &B}};
+    election_timeout(A);
+    communicate(A, B);
+    BOOST_REQUIRE(A.is_leader());
+    A.add_entry(log_entry::dummy{});
+    A.tick();
+    communicate(A, B);
+    BOOST_REQUIRE(A.get_progress(B_id).state == raft::follower_progress::state::PIPELINE);
+
+    // Deliver the requests to B, but hold its replies.
+    size_t requests = 0;
+    for (int i = 0; i < 10; ++i) {
+        A.add_entry(log_entry::dummy{});
+        auto output = A.get_output();
+        for (auto& req : append_requests_to(output, B_id)) {
+            BOOST_CHECK_EQUAL(req.entries.size(), 1);
+            requests++;
+        }
+        deliver(routes, A_id, std::move(output.messages));
+    }
+    BOOST_CHECK_EQUAL(requests, 3);
+    BOOST_CHECK_EQUAL(A.get_progress(B_id).in_flight, 3);
+
+    auto replies = B.get_output().messages;
+    BOOST_REQUIRE_EQUAL(replies.size(), 3);
+    deliver(routes, B_id, std::move(replies[0]));
+    auto append = append_requests_to(A.get_output(), B_id);
+    BOOST_REQUIRE_EQUAL(append.size(), 1);
+    BOOST_CHECK_EQUAL(append[0].entries.size(), 7);
+    BOOST_CHECK_EQUAL(A.get_progress(B_id).in_flight, 3);
+}
+
+// Count the round trips a leader of a three node cluster needs to commit
+// `n` entries, when every entry fills a whole append request, as the large
+// commands of topology changes do. All messages of a round are delivered
+// before the next one starts.
+static size_t replication_round_trips(size_t n, size_t max_in_flight) {
+    server_id A_id = id(), B_id = id(), C_id = id();
+    raft::log log(raft::snapshot_descriptor{.idx = index_t{0}, .config = config_from_ids({A_id, B_id, C_id})});
+    raft::fsm_config cfg{.append_request_threshold = 1, .enable_prevoting = false, .max_in_flight_append_requests = max_in_flight};
+    fsm_debug A(A_id, term_t{}, server_id{}, log, trivial_failure_detector, cfg);
+    fsm_debug B(B_id, term_t{}, server_id{}, log, trivial_failure_detector, cfg);
+    fsm_debug C(C_id, term_t{}, server_id{}, log, trivial_failure_detector, cfg);
+    raft_routing_map routes{{A_id, &A}, {B_id, &B}, {C_id, &C}};
+    election_timeout(A);
+    communicate(A, B, C);
+    BOOST_REQUIRE(A.is_leader());
+
+    for (size_t i = 0; i < n; ++i) {
+        A.add_entry(log_entry::dummy{});
+    }
+    auto last_idx = A.log_last_idx();
+    size_t round_trips = 0;
+    while (A.commit_idx() < last_idx) {
+        BOOST_REQUIRE_LE(round_trips, n);
+        ++round_trips;
+        deliver(routes, A_id, A.get_output().messages);
+        deliver(routes, B_id, B.get_output().messages);
+        deliver(routes, C_id, C.get_output().messages);
+    }
+    return round_trips;
+}
+
+BOOST_AUTO_TEST_CASE(test_pipelined_replication_round_trips) {
+    constexpr size_t entries = 1000;
+    for (size_t max_in_flight : {1, 10, 100}) {
+        auto round_trips = replication_round_trips(entries, max_in_flight);
+        BOOST_TEST_MESSAGE(fmt::format("{} entries, max_in_flight_append_requests={}: {} round trips",
+                entries, max_in_flight, round_trips));
+        BOOST_CHECK_LE(round_trips, entries / max_in_flight + 1);
+    }
+}
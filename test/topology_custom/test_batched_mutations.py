@@ -0,0 +1,129 @@
+#
+# Copyright (C) 2025-present ScyllaDB
+#
+# SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+#
+from test.pylib.manager_client import ManagerClient
+from test.pylib.rest_client import ScyllaMetrics
+from test.pylib.util import wait_for_cql_and_get_hosts
+from test.topology.conftest import skip_mode
+from cassandra import ConsistencyLevel, WriteTimeout
+from cassandra.query import SimpleStatement
+
+import asyncio
+import logging
+import pytest
+import time
+
+logger = logging.getLogger(__name__)
+
+# Writes to the other replica are batched by the coordinator for that long.
+# Long enough to be measured by the test, short enough to not time the writes out.
+batching_window_us = 200000
+
+
+def mutation_batches(metrics: ScyllaMetrics) -> int:
+    return int(metrics.get('scylla_storage_proxy_coordinator_mutation_batches') or 0)
+
+
+def batched_mutations(metrics: ScyllaMetrics) -> int:
+    return int(metrics.get('scylla_storage_proxy_coordinator_batched_mutations') or 0)
+
+
+async def setup_cluster(manager: ManagerClient, window_us: int, config: dict = {}):
+    """Starts a two node cluster, with a table replicated on both nodes.
+       Returns the servers and the host of the first one, which coordinates the writes of the tests."""
+    cmdline = ['--smp', '1', '--hinted-handoff-enabled', '0', '--write-request-timeout-in-ms', '2000']
+    servers = await manager.servers_add(2, cmdline=cmdline, config=config | {'write_rpc_batching_window_in_us': window_us})
+    cql = manager.get_cql()
+    hosts = await wait_for_cql_and_get_hosts(cql, servers, time.time() + 60)
+    host = next(h for h in hosts if h.address == servers[0].ip_addr)
+    await cql.run_async("CREATE KEYSPACE ks WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 2} AND tablets = {'enabled': false}")
+    await cql.run_async("CREATE TABLE ks.t (pk int, ck int, v int, PRIMARY KEY (pk, ck))")
+    return servers, host
+
+
+async def insert(manager: ManagerClient, host, ck: int, timeout: str = ""):
+    using = f" USING TIMEOUT {timeout}" if timeout else ""
+    stmt = SimpleStatement(f"INSERT INTO ks.t (pk, ck, v) VALUES (0, {ck}, {ck}){using}", consistency_level=ConsistencyLevel.ALL)
+    await manager.get_cql().run_async(stmt, host=host)
+
+
+async def assert_rows(manager: ManagerClient, cks: list[int]):
+    stmt = SimpleStatement("SELECT ck FROM ks.t WHERE pk = 0", consistency_level=ConsistencyLevel.ALL)
+    rows = await manager.get_cql().run_async(stmt)
+    assert sorted(r.ck for r in rows) == sorted(cks)
+
+
+@pytest.mark.asyncio
+async def test_batch_sent_when_window_ends(manager: ManagerClient) -> None:
+    """A lone write waits for the batching window to end, and is then sent in a batch of its own."""
+    servers, host = await setup_cluster(manager, batching_window_us)
+    before = await manager.metrics.query(servers[0].ip_addr)
+
+    start = time.monotonic()
+    await insert(manager, host, 1)
+    elapsed = time.monotonic() - start
+
+    after = await manager.metrics.query(servers[0].ip_addr)
+    assert elapsed >= batching_window_us / 1e6
+    assert mutation_batches(after) - mutation_batches(before) >= 1
+    assert batched_mutations(after) - batched_mutations(before) >= 1
+    await assert_rows(manager, [1])
+
+
+@pytest.mark.asyncio
+async def test_full_batch_sent_before_window_ends(manager: ManagerClient) -> None:
+    """A batch which fills up is sent right away. The window is longer than the write
+       timeout, so the writes would time out if the batch waited for it."""
+    servers, host = await setup_cluster(manager, 60 * 1000 * 1000)
+    before = await manager.metrics.query(servers[0].ip_addr)
+
+    # Batches are sent once they hold 128 writes.
+    cks = list(range(128))
+    await asyncio.gather(*(insert(manager, host, ck) for ck in cks))
+
+    after = await manager.metrics.query(servers[0].ip_addr)
+    assert mutation_batches(after) - mutation_batches(before) >= 1
+    assert batched_mutations(after) - batched_mutations(before) >= len(cks)
+    await assert_rows(manager, cks)
+
+
+@pytest.mark.asyncio
+async def test_writes_in_batch_time_out_separately(manager: ManagerClient) -> None:
+    """Writes in the same batch are acknowledged separately, each according to its own timeout:
+       a write timing out while waiting for the batch doesn't affect the other writes in it."""
+    servers, host = await setup_cluster(manager, batching_window_us)
+    before = await manager.metrics.query(servers[0].ip_addr)
+
+    cks = list(range(10))
+    writes = [insert(manager, host, ck) for ck in cks]
+    short_write = insert(manager, host, 100, timeout="50ms")
+    results = await asyncio.gather(*writes, short_write, return_exceptions=True)
+
+    assert all(r is None for r in results[:-1]), results
+    assert isinstance(results[-1], WriteTimeout), results[-1]
+    after = await manager.metrics.query(servers[0].ip_addr)
+    assert batched_mutations(after) - batched_mutations(before) >= len(cks) + 1
+    # The timed out write was applied locally only, so it's not checked.
+    stmt = SimpleStatement("SELECT ck FROM ks.t WHERE pk = 0 AND ck < 100", consistency_level=ConsistencyLevel.ALL)
+    rows = await manager.get_cql().run_async(stmt)
+    assert sorted(r.ck for r in rows) == cks
+
+
+@pytest.mark.asyncio
+@skip_mode('release', "error injections aren't enabled in release mode")
+async def test_no_batches_without_cluster_feature(manager: ManagerClient) -> None:
+    """Until all nodes support BATCHED_MUTATIONS, writes are sent with MUTATION,
+       even if batching is enabled."""
+    config = {'error_injections_at_startup': [{'name': 'suppress_features', 'value': 'BATCHED_MUTATIONS'}]}
+    servers, host = await setup_cluster(manager, batching_window_us, config)
+    before = await manager.metrics.query(servers[0].ip_addr)
+
+    cks = list(range(10))
+    await asyncio.gather(*(insert(manager, host, ck) for ck in cks))
+
+    after = await manager.metrics.query(servers[0].ip_addr)
+    assert mutation_batches(after) == mutation_batches(before)
+    assert batched_mutations(after) == batched_mutations(before)
+    await assert_rows(manager, cks)
@@ -0,0 +1,178 @@
+#
+# Copyright (C) 2025-present ScyllaDB
+#
+# SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+#
+from test.pylib.manager_client import ManagerClient
+from test.pylib.tablets import get_tablet_replica
+from test.pylib.util import wait_for, wait_for_cql_and_get_hosts
+from test.topology.conftest import skip_mode
+from cassandra import ConsistencyLevel
+from cassandra.query import SimpleStatement
+
+import asyncio
+import glob
+import logging
+import os
+import pytest
+import time
+
+logger = logging.getLogger(__name__)
+
+keys = range(256)
+
+
+async def setup_cluster(manager: ManagerClient, with_view: bool = False, file_stream: bool = True):
+    """Starts a two node cluster, with a single tablet replicated on one of the nodes and flushed to sstables.
+       Returns the servers, the source and the destination of the tablet migration."""
+    config = {'enable_tablets': True}
+    if file_stream:
+        config['enable_file_stream'] = True
+    servers = await manager.servers_add(2, config=config)
+    for s in servers:
+        await manager.api.disable_tablet_balancing(s.ip_addr)
+    cql = manager.get_cql()
+    await wait_for_cql_and_get_hosts(cql, servers, time.time() + 60)
+    await cql.run_async("CREATE KEYSPACE ks WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1} AND tablets = {'initial': 1}")
+    await cql.run_async("CREATE TABLE ks.t (pk int PRIMARY KEY, v int)")
+    if with_view:
+        await cql.run_async("CREATE MATERIALIZED VIEW ks.t_by_v AS SELECT * FROM ks.t WHERE pk IS NOT NULL AND v IS NOT NULL PRIMARY KEY (v, pk)")
+    await asyncio.gather(*[cql.run_async(f"INSERT INTO ks.t (pk, v) VALUES ({k}, {k})") for k in keys])
+    for s in servers:
+        await manager.api.keyspace_flush(s.ip_addr, "ks", "t")
+
+    host_ids = [await manager.get_host_id(s.server_id) for s in servers]
+    replica = await get_tablet_replica(manager, servers[0], "ks", "t", 0)
+    src = servers[host_ids.index(replica[0])]
+    dst = servers[1 - host_ids.index(replica[0])]
+    return servers, src, dst
+
+
+async def move_tablet(manager: ManagerClient, servers, src, dst):
+    src_host_id = await manager.get_host_id(src.server_id)
+    dst_host_id = await manager.get_host_id(dst.server_id)
+    replica = await get_tablet_replica(manager, servers[0], "ks", "t", 0)
+    assert replica[0] == src_host_id
+    await manager.api.move_tablet(servers[0].ip_addr, "ks", "t", replica[0], replica[1], dst_host_id, 0, 0)
+    replica = await get_tablet_replica(manager, servers[0], "ks", "t", 0)
+    assert replica[0] == dst_host_id
+
+
+async def check_data(manager: ManagerClient):
+    stmt = SimpleStatement("SELECT pk, v FROM ks.t", consistency_level=ConsistencyLevel.ONE)
+    rows = await manager.get_cql().run_async(stmt)
+    assert sorted((r.pk, r.v) for r in rows) == [(k, k) for k in keys]
+
+
+async def wait_for_no_unsealed_sstables(manager: ManagerClient, server):
+    """Waits until every sstable in the table directory of the server is sealed, i.e. has a TOC,
+       and none is being written, i.e. has a temporary TOC. An unsealed sstable left by a failed
+       transfer is deleted asynchronously."""
+    workdir = await manager.server_get_workdir(server.server_id)
+    table_dir = glob.glob(os.path.join(workdir, "data", "ks", "t-*"))[0]
+
+    async def all_sealed():
+        sstables = {}
+        for path in glob.glob(os.path.join(table_dir, "*-*-*-*")):
+            prefix, component = os.path.basename(path).rsplit('-', 1)
+            sstables.setdefault(prefix, set()).add(component)
+        unsealed = [p for p, components in sstables.items() if 'TOC.txt' not in components or 'TemporaryTOC.txt' in components]
+        if unsealed:
+            logger.info(f"Unsealed sstables on {server.ip_addr}: {unsealed}")
+            return None
+        return True
+    await wait_for(all_sealed, time.time() + 60)
+
+
+@pytest.mark.asyncio
+async def test_tablet_migration_streams_files(manager: ManagerClient) -> None:
+    servers, src, dst = await setup_cluster(manager)
+    log = await manager.server_open_log(dst.server_id)
+    mark = await log.mark()
+
+    await move_tablet(manager, servers, src, dst)
+
+    assert await log.grep(r"File streaming for tablet migration of .* finished", from_mark=mark)
+    assert not await log.grep(r"streaming mutations instead", from_mark=mark)
+    await check_data(manager)
+    await wait_for_no_unsealed_sstables(manager, dst)
+
+
+@pytest.mark.asyncio
+@skip_mode('release', "error injections aren't enabled in release mode")
+async def test_file_stream_checksum_mismatch(manager: ManagerClient) -> None:
+    """A component whose checksum doesn't match fails the transfer, the sstable being received
+       is deleted, and the retried streaming succeeds."""
+    servers, src, dst = await setup_cluster(manager)
+    log = await manager.server_open_log(dst.server_id)
+    mark = await log.mark()
+    await manager.api.enable_injection(src.ip_addr, "stream_blob_corrupt_checksum", one_shot=True)
+
+    await move_tablet(manager, servers, src, dst)
+
+    assert await log.grep(r"Checksum mismatch", from_mark=mark)
+    assert await log.grep(r"File streaming for tablet migration of .* finished", from_mark=mark)
+    await check_data(manager)
+    await wait_for_no_unsealed_sstables(manager, dst)
+
+
+@pytest.mark.asyncio
+@skip_mode('release', "error injections aren't enabled in release mode")
+async def test_file_stream_aborted(manager: ManagerClient) -> None:
+    """The sender fails after a component was received. The unsealed sstable, with the component
+       already written, is deleted, and the retried streaming succeeds."""
+    servers, src, dst = await setup_cluster(manager)
+    log = await manager.server_open_log(dst.server_id)
+    mark = await log.mark()
+    await manager.api.enable_injection(src.ip_addr, "stream_blob_fail_after_component", one_shot=True)
+
+    await move_tablet(manager, servers, src, dst)
+
+    assert await log.grep(r"Failed to receive sstable files from .*The sender failed", from_mark=mark)
+    assert await log.grep(r"File streaming for tablet migration of .* finished", from_mark=mark)
+    await check_data(manager)
+    await wait_for_no_unsealed_sstables(manager, dst)
+
+
+@pytest.mark.asyncio
+@skip_mode('release', "error injections aren't enabled in release mode")
+async def test_file_stream_unsupported_falls_back_to_mutations(manager: ManagerClient) -> None:
+    """When the leaving replica can't send its sstables as files, e.g. because some of them
+       aren't contained in the tablet range, the mutations of the tablet are streamed instead."""
+    servers, src, dst = await setup_cluster(manager)
+    log = await manager.server_open_log(dst.server_id)
+    mark = await log.mark()
+    await manager.api.enable_injection(src.ip_addr, "stream_blob_unsupported", one_shot=True)
+
+    await move_tablet(manager, servers, src, dst)
+
+    assert await log.grep(r"File streaming for tablet migration of .* isn't possible, streaming mutations instead", from_mark=mark)
+    assert not await log.grep(r"File streaming for tablet migration of .* finished", from_mark=mark)
+    await check_data(manager)
+
+
+@pytest.mark.asyncio
+async def test_no_file_stream_with_views(manager: ManagerClient) -> None:
+    """Sstables streamed as files would bypass view building, so tables with views stream mutations."""
+    servers, src, dst = await setup_cluster(manager, with_view=True)
+    log = await manager.server_open_log(dst.server_id)
+    mark = await log.mark()
+
+    await move_tablet(manager, servers, src, dst)
+
+    assert not await log.grep(r"Started file streaming", from_mark=mark)
+    assert await log.grep(r"Streaming for tablet migration of .* finished", from_mark=mark)
+    await check_data(manager)
+
+
+@pytest.mark.asyncio
+async def test_no_file_stream_by_default(manager: ManagerClient) -> None:
+    servers, src, dst = await setup_cluster(manager, file_stream=False)
+    log = await manager.server_open_log(dst.server_id)
+    mark = await log.mark()
+
+    await move_tablet(manager, servers, src, dst)
+
+    assert not await log.grep(r"Started file streaming", from_mark=mark)
+    assert await log.grep(r"Streaming for tablet migration of .* finished", from_mark=mark)
+    await check_data(manager)
@@ -0,0 +1,152 @@
+#
+# Copyright (C) 2025-present ScyllaDB
+#
+# SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+#
+from test.pylib.manager_client import ManagerClient
+from test.pylib.rest_client import ScyllaMetrics
+from test.pylib.util import wait_for, wait_for_cql_and_get_hosts
+from test.topology.conftest import skip_mode
+from cassandra import ConsistencyLevel
+from cassandra.query import SimpleStatement
+
+import asyncio
+import logging
+import pytest
+import time
+
+logger = logging.getLogger(__name__)
+
+
+def background_learns(metrics: ScyllaMetrics) -> int:
+    return int(metrics.get('scylla_storage_proxy_coordinator_cas_background_learn') or 0)
+
+
+async def setup_cluster(manager: ManagerClient, background_learn: bool = True):
+    """Starts a three node cluster, with a table replicated on all nodes.
+       Returns the servers and the host of the first one, which coordinates the transactions of the tests."""
+    servers = await manager.servers_add(3, config={'lwt_background_learn': background_learn})
+    cql = manager.get_cql()
+    hosts = await wait_for_cql_and_get_hosts(cql, servers, time.time() + 60)
+    host = next(h for h in hosts if h.address == servers[0].ip_addr)
+    await cql.run_async("CREATE KEYSPACE ks WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 3} AND tablets = {'enabled': false}")
+    await cql.run_async("CREATE TABLE ks.t (pk int PRIMARY KEY, v int)")
+    return servers, host
+
+
+async def cas(manager: ManagerClient, host, stmt: str, cl: ConsistencyLevel = ConsistencyLevel.ANY) -> bool:
+    """Runs a conditional statement with the given commit consistency level, and returns whether it applied."""
+    stmt = SimpleStatement(stmt, consistency_level=cl, serial_consistency_level=ConsistencyLevel.SERIAL)
+    rows = await manager.get_cql().run_async(stmt, host=host)
+    return rows[0].applied
+
+
+async def read_v(manager: ManagerClient, host, cl: ConsistencyLevel):
+    stmt = SimpleStatement("SELECT v FROM ks.t WHERE pk = 0", consistency_level=cl)
+    rows = await manager.get_cql().run_async(stmt, host=host)
+    return rows[0].v if rows else None
+
+
+async def wait_for_learned_v(manager: ManagerClient, host, v: int):
+    """Waits until the decision writing v is learned, i.e. applied to the table itself
+       and visible to a non-serial read. The accept only writes it to system.paxos."""
+    async def learned():
+        return True if await read_v(manager, host, ConsistencyLevel.ALL) == v else None
+    await wait_for(learned, time.time() + 60, period=0.1)
+
+
+@pytest.mark.asyncio
+async def test_applied_decision_learned_in_background(manager: ManagerClient) -> None:
+    """A transaction which applies with commit consistency level ANY is learned in the background.
+       The decision is then eventually applied to the table, and seen by the following reads."""
+    servers, host = await setup_cluster(manager)
+    before = await manager.metrics.query(servers[0].ip_addr)
+
+    assert await cas(manager, host, "INSERT INTO ks.t (pk, v) VALUES (0, 1) IF NOT EXISTS")
+
+    after = await manager.metrics.query(servers[0].ip_addr)
+    assert background_learns(after) - background_learns(before) == 1
+    # A serial read completes the decision if it wasn't learned yet.
+    assert await read_v(manager, host, ConsistencyLevel.SERIAL) == 1
+    await wait_for_learned_v(manager, host, 1)
+    # The next transaction on the key sees the decision.
+    assert await cas(manager, host, "UPDATE ks.t SET v = 2 WHERE pk = 0 IF v = 1")
+    await wait_for_learned_v(manager, host, 2)
+
+
+@pytest.mark.asyncio
+async def test_unapplied_decision_learned_in_background(manager: ManagerClient) -> None:
+    """A transaction whose condition isn't met learns an empty decision, in the background.
+       The transactions following it on the key through the same coordinator aren't affected."""
+    servers, host = await setup_cluster(manager)
+    assert await cas(manager, host, "INSERT INTO ks.t (pk, v) VALUES (0, 1) IF NOT EXISTS", ConsistencyLevel.QUORUM)
+    assert await read_v(manager, host, ConsistencyLevel.QUORUM) == 1
+    before = await manager.metrics.query(servers[0].ip_addr)
+
+    # The commit consistency level doesn't matter, as nothing is written.
+    assert not await cas(manager, host, "INSERT INTO ks.t (pk, v) VALUES (0, 2) IF NOT EXISTS", ConsistencyLevel.QUORUM)
+    assert not await cas(manager, host, "UPDATE ks.t SET v = 3 WHERE pk = 0 IF v = 2", ConsistencyLevel.QUORUM)
+    assert await cas(manager, host, "UPDATE ks.t SET v = 3 WHERE pk = 0 IF v = 1", ConsistencyLevel.QUORUM)
+
+    after = await manager.metrics.query(servers[0].ip_addr)
+    assert background_learns(after) - background_learns(before) == 2
+    # The applied write waited for the learn.
+    assert await read_v(manager, host, ConsistencyLevel.QUORUM) == 3
+
+
+@pytest.mark.asyncio
+async def test_applied_decision_with_stronger_consistency_waits_for_learn(manager: ManagerClient) -> None:
+    """A transaction which applies with a commit consistency level other than ANY waits for the learn,
+       which is what makes it visible to non-serial reads at that consistency level."""
+    servers, host = await setup_cluster(manager)
+    before = await manager.metrics.query(servers[0].ip_addr)
+
+    assert await cas(manager, host, "INSERT INTO ks.t (pk, v) VALUES (0, 1) IF NOT EXISTS", ConsistencyLevel.QUORUM)
+
+    after = await manager.metrics.query(servers[0].ip_addr)
+    assert background_learns(after) == background_learns(before)
+    assert await read_v(manager, host, ConsistencyLevel.QUORUM) == 1
+
+
+@pytest.mark.asyncio
+async def test_no_background_learn_when_disabled(manager: ManagerClient) -> None:
+    servers, host = await setup_cluster(manager, background_learn=False)
+    before = await manager.metrics.query(servers[0].ip_addr)
+
+    assert await cas(manager, host, "INSERT INTO ks.t (pk, v) VALUES (0, 1) IF NOT EXISTS")
+    assert not await cas(manager, host, "INSERT INTO ks.t (pk, v) VALUES (0, 2) IF NOT EXISTS")
+
+    after = await manager.metrics.query(servers[0].ip_addr)
+    assert background_learns(after) == background_learns(before)
+    assert await read_v(manager, host, ConsistencyLevel.ALL) == 1
+
+
+@pytest.mark.asyncio
+@skip_mode('release', "error injections aren't enabled in release mode")
+async def test_applied_after_preempted_unapplied_round_waits_for_learn(manager: ManagerClient) -> None:
+    """A transaction whose condition isn't met in its first round, which is pre-empted by another
+       transaction making the condition true, applies in the next round. The empty decision of the
+       first round would be learned with ANY, but the write is learned with the commit consistency
+       level of the transaction, not in the background."""
+    servers, host = await setup_cluster(manager)
+    hosts = await wait_for_cql_and_get_hosts(manager.get_cql(), servers, time.time() + 60)
+    other_host = next(h for h in hosts if h.address == servers[1].ip_addr)
+    assert await cas(manager, host, "INSERT INTO ks.t (pk, v) VALUES (0, 1) IF NOT EXISTS", ConsistencyLevel.QUORUM)
+    before = await manager.metrics.query(servers[0].ip_addr)
+    log = await manager.server_open_log(servers[0].server_id)
+    mark = await log.mark()
+
+    # Stop the transaction after it found the condition not met, before its accept.
+    await manager.api.enable_injection(servers[0].ip_addr, "cas_wait_before_accept", one_shot=True)
+    update = asyncio.create_task(cas(manager, host, "UPDATE ks.t SET v = 3 WHERE pk = 0 IF v = 2", ConsistencyLevel.QUORUM))
+    await log.wait_for("cas_wait_before_accept: waiting", from_mark=mark)
+    # Another coordinator pre-empts it with a newer ballot, and makes the condition true.
+    assert await cas(manager, other_host, "UPDATE ks.t SET v = 2 WHERE pk = 0 IF v = 1", ConsistencyLevel.QUORUM)
+    await manager.api.message_injection(servers[0].ip_addr, "cas_wait_before_accept")
+
+    # The first round saw v = 1, so the update applied in a retried round.
+    assert await update
+    after = await manager.metrics.query(servers[0].ip_addr)
+    assert background_learns(after) == background_learns(before)
+    # The write was learned by a quorum before the transaction returned.
+    assert await read_v(manager, host, ConsistencyLevel.QUORUM) == 3
@@ -0,0 +1,77 @@
+#
+# Copyright (C) 2025-present ScyllaDB
+#
+# SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+#
+from test.pylib.manager_client import ManagerClient
+from test.pylib.rest_client import ScyllaMetrics
+from test.pylib.util import wait_for, wait_for_cql_and_get_hosts
+from cassandra import ConsistencyLevel
+from cassandra.query import SimpleStatement
+
+import asyncio
+import logging
+import pytest
+import time
+
+logger = logging.getLogger(__name__)
+
+keys = range(256)
+
+
+def cross_shard_ops(metrics: ScyllaMetrics) -> int:
+    return int(metrics.get('scylla_storage_proxy_replica_cross_shard_ops') or 0)
+
+
+def replica_reads(metrics: ScyllaMetrics) -> int:
+    return int(metrics.get('scylla_storage_proxy_replica_reads') or 0)
+
+
+async def setup_cluster(manager: ManagerClient, shard_aware: bool):
+    """Starts a coordinator, and a replica which shards the vnode tables with other
+       murmur3_partitioner_ignore_msb_bits than the coordinator does.
+       Returns the replica, and the host of the coordinator."""
+    config = {'enable_shard_aware_rpc_connections': shard_aware}
+    coordinator = await manager.server_add(config=config)
+    replica = await manager.server_add(config=config | {'murmur3_partitioner_ignore_msb_bits': 4})
+    cql = manager.get_cql()
+    hosts = await wait_for_cql_and_get_hosts(cql, [coordinator, replica], time.time() + 60)
+    host = next(h for h in hosts if h.address == coordinator.ip_addr)
+    await cql.run_async("CREATE KEYSPACE ks WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 1} AND tablets = {'enabled': false}")
+    await cql.run_async("CREATE TABLE ks.t (pk int PRIMARY KEY, v int)")
+    return replica, host
+
+
+async def run_round(manager: ManagerClient, replica, host):
+    """Writes and reads every key through the coordinator. Returns the number of the
+       operations the replica received on another shard than the one owning the data,
+       and the number of the reads it received."""
+    cql = manager.get_cql()
+    before = await manager.metrics.query(replica.ip_addr)
+    await asyncio.gather(*[cql.run_async(SimpleStatement(f"INSERT INTO ks.t (pk, v) VALUES ({k}, {k})", consistency_level=ConsistencyLevel.ONE), host=host) for k in keys])
+    await asyncio.gather(*[cql.run_async(SimpleStatement(f"SELECT v FROM ks.t WHERE pk = {k}", consistency_level=ConsistencyLevel.ONE), host=host) for k in keys])
+    after = await manager.metrics.query(replica.ip_addr)
+    return cross_shard_ops(after) - cross_shard_ops(before), replica_reads(after) - replica_reads(before)
+
+
+@pytest.mark.asyncio
+async def test_requests_land_on_owning_shard(manager: ManagerClient) -> None:
+    replica, host = await setup_cluster(manager, shard_aware=True)
+
+    # The requests are sent over the connection to the node until the
+    # connections to the shards are connected.
+    async def no_cross_shard_ops():
+        cross_shard, reads = await run_round(manager, replica, host)
+        logger.info(f"Replica received {reads} reads, {cross_shard} operations on another shard")
+        assert reads > 0
+        return True if cross_shard == 0 else None
+    await wait_for(no_cross_shard_ops, time.time() + 60, period=0.1)
+
+
+@pytest.mark.asyncio
+async def test_requests_cross_shards_without_shard_aware_connections(manager: ManagerClient) -> None:
+    replica, host = await setup_cluster(manager, shard_aware=False)
+
+    cross_shard, reads = await run_round(manager, replica, host)
+    assert reads > 0
+    assert cross_shard > 0
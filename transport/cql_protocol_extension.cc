@@ -10,6 +10,7 @@
 #include "transport/cql_protocol_extension.hh"
 #include "cql3/result_set.hh"
 #include "exceptions/exceptions.hh"
+#include "transport/zstd_compressor.hh"
 
 #include <map>
 
@@ -18,7 +19,8 @@ namespace cql_transport {
 static const std::map<cql_protocol_extension, seastar::sstring> EXTENSION_NAMES = {
     {cql_protocol_extension::LWT_ADD_METADATA_MARK, "SCYLLA_LWT_ADD_METADATA_MARK"},
     {cql_protocol_extension::RATE_LIMIT_ERROR, "SCYLLA_RATE_LIMIT_ERROR"},
-    {cql_protocol_extension::TABLETS_ROUTING_V1, "TABLETS_ROUTING_V1"}
+    {cql_protocol_extension::TABLETS_ROUTING_V1, "TABLETS_ROUTING_V1"},
+    {cql_protocol_extension::ZSTD_DICT_COMPRESSION, "SCYLLA_ZSTD_DICT_COMPRESSION"}
 };
 
 cql_protocol_extension_enum_set supported_cql_protocol_extensions() {
@@ -35,6 +37,8 @@ std::vector<seastar::sstring> additional_options_for_proto_ext(cql_protocol_exte
             return {format("LWT_OPTIMIZATION_META_BIT_MASK={:d}", cql3::prepared_metadata::LWT_FLAG_MASK)};
         case cql_protocol_extension::RATE_LIMIT_ERROR:
             return {format("ERROR_CODE={}", exceptions::exception_code::RATE_LIMIT_ERROR)};
+        case cql_protocol_extension::ZSTD_DICT_COMPRESSION:
+            return {format("MAX_DICT_SIZE={:d}", zstd_compressor::max_dict_size)};
         default:
             return {};
     }
@@ -81,7 +81,8 @@ class response {
 
     // Make a non-owning scattered_message of the response. Remains valid as long
     // as the response object is alive.
-    scattered_message<char> make_message(uint8_t version, cql_compression compression);
+    // `zstd` has to be provided with cql_compression::zstd.
+    scattered_message<char> make_message(uint8_t version, cql_compression compression, zstd_compressor* zstd = nullptr);
 
     cql_binary_opcode opcode() const {
         return _opcode;
@@ -90,9 +91,10 @@ class response {
         return _body.size();
     }
 private:
-    void compress(cql_compression compression);
+    void compress(cql_compression compression, zstd_compressor* zstd);
     void compress_lz4();
     void compress_snappy();
+    void compress_zstd(zstd_compressor& zstd);
 
     template <typename CqlFrameHeaderType>
     sstring make_frame_one(uint8_t version, size_t length) {
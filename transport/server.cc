@@ -29,6 +29,7 @@
 #include "service/qos/service_level_controller.hh"
 #include "db/consistency_level_type.hh"
 #include "db/write_type.hh"
+#include "transport/zstd_compressor.hh"
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/seastar.hh>
@@ -149,6 +150,16 @@ sstring to_string(cql_binary_opcode op) {
     return format("Unknown CQL binary opcode {}", static_cast<unsigned>(op));
 }
 
+static sstring to_string(cql_compression c) {
+    switch (c) {
+    case cql_compression::none:   return "none";
+    case cql_compression::lz4:    return "lz4";
+    case cql_compression::snappy: return "snappy";
+    case cql_compression::zstd:   return "zstd";
+    }
+    throw std::invalid_argument("unknown compression");
+}
+
 sstring to_string(const event::status_change::status_type t) {
     using type = event::status_change::status_type;
     switch (t) {
@@ -191,6 +202,29 @@ event::event_type parse_event_type(const sstring& value)
     }
 }
 
+void queueing_delay_estimator::maybe_close_window(clock_type::time_point now) {
+    auto elapsed = std::chrono::duration<double>(now - _window_start);
+    if (elapsed < window) {
+        return;
+    }
+    // Windows in which the group was idle say nothing about its capacity.
+    if (_completed_in_window || _in_flight) {
+        static constexpr double alpha = 0.5;
+        double rate = _completed_in_window / elapsed.count();
+        _completion_rate = alpha * rate + (1 - alpha) * _completion_rate;
+    }
+    _completed_in_window = 0;
+    _window_start = now;
+}
+
+std::optional<std::chrono::duration<double>> queueing_delay_estimator::estimated_delay(clock_type::time_point now) {
+    maybe_close_window(now);
+    if (_in_flight < min_requests_in_flight || _completion_rate == 0) {
+        return std::nullopt;
+    }
+    return std::chrono::duration<double>(_in_flight / _completion_rate);
+}
+
 cql_sg_stats::cql_sg_stats(maintenance_socket_enabled used_by_maintenance_socket)
     : _cql_requests_stats(static_cast<uint8_t>(cql_binary_opcode::OPCODES_COUNT))
 {
@@ -255,8 +289,10 @@ cql_server::cql_server(distributed<cql3::query_processor>& qp, auth::service& au
     , _config(std::move(config))
     , _max_request_size(_config.max_request_size)
     , _max_concurrent_requests(db_cfg.max_concurrent_requests_per_shard)
+    , _queueing_delay_shedding_ratio(db_cfg.cql_queueing_delay_shedding_ratio)
     , _cql_duplicate_bind_variable_names_refer_to_same_variable(db_cfg.cql_duplicate_bind_variable_names_refer_to_same_variable)
     , _memory_available(ml.get_semaphore())
+    , _zstd_cpu_budget(std::make_unique<zstd_cpu_budget>(utils::updateable_value<float>(db_cfg.native_transport_zstd_max_cpu_fraction)))
     , _notifier(std::make_unique<event_notifier>(*this))
     , _auth_service(auth_service)
     , _sl_controller(sl_controller)
@@ -293,6 +329,19 @@ cql_server::cql_server(distributed<cql3::query_processor>& qp, auth::service& au
         sm::make_counter("requests_shed", _stats.requests_shed,
                         sm::description("Holds an incrementing counter with the requests that were shed due to overload (threshold configured via max_concurrent_requests_per_shard). "
                                             "The first derivative of this value shows how often we shed requests due to overload in the \"CQL transport\" component.")),
+        sm::make_counter("requests_shed_queueing_delay", _stats.requests_shed_queueing_delay,
+                        sm::description("Holds an incrementing counter with the requests that were shed before being parsed, because the estimated queueing delay of their "
+                                            "scheduling group exceeded the timeout (threshold configured via cql_queueing_delay_shedding_ratio). Included in requests_shed.")),
+        sm::make_counter("response_batches", _stats.response_batches,
+                        sm::description("Counts the writes of responses to client connections. Responses which are ready at the same time are sent in a single write, "
+                                            "so the ratio of responses_batched to this counter is the average number of responses per write.")),
+        sm::make_counter("responses_batched", _stats.responses_batched,
+                        sm::description("Counts the responses sent to client connections, as parts of response batches.")),
+        sm::make_counter("response_batch_bytes", _stats.response_batch_bytes,
+                        sm::description("Counts the bytes of responses sent to client connections, as parts of response batches.")),
+        sm::make_counter("zstd_compression_fallbacks", [this] { return _zstd_cpu_budget->fallbacks(); },
+                        sm::description("Counts the responses compressed with lz4 instead of zstd, because the CPU time spent on zstd compression "
+                                            "exceeded native_transport_zstd_max_cpu_fraction.")),
         sm::make_gauge("requests_memory_available", [this] { return _memory_available.current(); },
                         sm::description(
                             seastar::format("Holds the amount of available memory for admitting new requests (max is {}B)."
@@ -655,6 +704,14 @@ client_data cql_server::connection::make_client_data() const {
         cd.connection_stage = client_connection_stage::authenticating;
     }
     cd.scheduling_group_name = _current_scheduling_group.name();
+    if (_compression != cql_compression::none) {
+        cd.compression = to_string(_compression);
+        if (_zstd_compressor && _zstd_compressor->dict()) {
+            cd.compression = *cd.compression + "+dict";
+        }
+        cd.uncompressed_bytes_sent = _uncompressed_bytes_sent;
+        cd.compressed_bytes_sent = _compressed_bytes_sent;
+    }
     return cd;
 }
 
@@ -700,6 +757,17 @@ future<> cql_server::connection::process_request() {
                 return make_ready_future<>();
             });
         }
+        if (allow_shedding && should_shed_on_queueing_delay(f.opcode)) {
+            ++_server._stats.requests_shed;
+            ++_server._stats.requests_shed_queueing_delay;
+            return _read_buf.skip(f.length).then([this, stream = f.stream] {
+                const char* message = "request shed due to coordinator overload (estimated queueing delay exceeds the timeout)";
+                clogger.debug("{}: {}, stream {}", _client_state.get_remote_address(), message, uint16_t(stream));
+                write_response(make_error(stream, exceptions::exception_code::OVERLOADED,
+                    message, tracing::trace_state_ptr()));
+                return make_ready_future<>();
+            });
+        }
 
         tracing_request_type tracing_requested = tracing_request_type::not_requested;
         if (f.flags & cql_frame_flags::tracing) {
@@ -770,6 +838,8 @@ future<> cql_server::connection::process_request() {
 
             ++_server._stats.requests_served;
             ++_server._stats.requests_serving;
+            auto& delay_estimator = _server.get_queueing_delay_estimator();
+            delay_estimator.on_request_start();
 
             _pending_requests_gate.enter();
             auto leave = defer([this] {
@@ -791,7 +861,8 @@ future<> cql_server::connection::process_request() {
                     _process_request_stage(this, istream, op, stream, seastar::ref(_client_state), tracing_requested, mem_permit) :
                     process_request_one(istream, op, stream, seastar::ref(_client_state), tracing_requested, mem_permit);
 
-            future<> request_response_future = request_process_future.then_wrapped([this, buf = std::move(buf), mem_permit, leave = std::move(leave), stream] (future<foreign_ptr<std::unique_ptr<cql_server::response>>> response_f) mutable {
+            future<> request_response_future = request_process_future.then_wrapped([this, buf = std::move(buf), mem_permit, leave = std::move(leave), stream, delay_estimator = &delay_estimator] (future<foreign_ptr<std::unique_ptr<cql_server::response>>> response_f) mutable {
+                delay_estimator->on_request_finish(lowres_clock::now());
                 try {
                     if (response_f.failed()) {
                         const auto message = format("request processing failed, error [{}]", response_f.get_exception());
@@ -881,6 +952,20 @@ future<fragmented_temporary_buffer> cql_server::connection::read_and_decompress_
                     return output_len;
                 });
             });
+        } else if (_compression == cql_compression::zstd) {
+            return _buffer_reader.read_exactly(_read_buf, length).then([this] (fragmented_temporary_buffer buf) {
+                auto input_buffer = input_buffer_guard();
+                auto output_buffer = output_buffer_guard();
+                auto in = input_buffer.get_linearized_view(fragmented_temporary_buffer::view(buf));
+                size_t uncomp_len = zstd_compressor::uncompressed_size(in);
+                if (uncomp_len > _server._max_request_size) {
+                    throw std::runtime_error(fmt::format("CQL frame uncompressed size too large: {}", uncomp_len));
+                }
+                return output_buffer.make_fragmented_temporary_buffer(uncomp_len, [this, &in] (bytes_mutable_view out) {
+                    _zstd_compressor->decompress(in, out);
+                    return out.size();
+                });
+            });
         } else {
             throw exceptions::protocol_exception(format("Unknown compression algorithm"));
         }
@@ -899,6 +984,21 @@ future<std::unique_ptr<cql_server::response>> cql_server::connection::process_st
              _compression = cql_compression::lz4;
          } else if (compression == "snappy") {
              _compression = cql_compression::snappy;
+         } else if (compression == "zstd") {
+             // The value of the extension option is the dictionary the
+             // client wants the connection to use, if any.
+             auto dict_opt = options.find(protocol_extension_name(cql_protocol_extension::ZSTD_DICT_COMPRESSION));
+             if (dict_opt == options.end()) {
+                 throw exceptions::protocol_exception(format("zstd compression requires the {} protocol extension",
+                         protocol_extension_name(cql_protocol_extension::ZSTD_DICT_COMPRESSION)));
+             }
+             _compression = cql_compression::zstd;
+             _zstd_compressor = std::make_unique<zstd_compressor>(*_server._zstd_cpu_budget, zstd_compressor::make_dict(dict_opt->second));
+             // The dictionary is built before the client authenticates, and is
+             // kept for as long as the connection is. Charge it to the memory
+             // of the requests, so a flood of connections with dictionaries
+             // throttles the requests instead of exhausting the shard's memory.
+             _zstd_dict_memory = consume_units(_server._memory_available, _zstd_compressor->dict_memory_usage());
          } else {
              throw exceptions::protocol_exception(format("Unknown compression algorithm: {}", compression));
          }
@@ -948,6 +1048,24 @@ future<std::unique_ptr<cql_server::response>> cql_server::connection::process_st
     co_return res;
 }
 
+bool cql_server::connection::should_shed_on_queueing_delay(uint8_t op) {
+    auto ratio = _server._queueing_delay_shedding_ratio();
+    if (ratio <= 0 || (op != uint8_t(cql_binary_opcode::QUERY)
+            && op != uint8_t(cql_binary_opcode::EXECUTE)
+            && op != uint8_t(cql_binary_opcode::BATCH))) {
+        return false;
+    }
+    auto delay = _server.get_queueing_delay_estimator().estimated_delay(lowres_clock::now());
+    if (!delay) {
+        return false;
+    }
+    // The request would most likely time out before it is served. Shedding
+    // it now saves the work of parsing, preparing and admitting it.
+    auto& timeouts = _client_state.get_timeout_config();
+    auto timeout = std::chrono::duration<double>(std::min(timeouts.read_timeout, timeouts.write_timeout));
+    return *delay > timeout * ratio;
+}
+
 void cql_server::connection::update_scheduling_group() {
     switch_tenant([this] (noncopyable_function<future<> ()> process_loop) -> future<> {
         auto shg = co_await _server._sl_controller.get_user_scheduling_group(_client_state.user());
@@ -1632,18 +1750,61 @@ cql_server::connection::make_schema_change_event(const event::schema_change& eve
 
 void cql_server::connection::write_response(foreign_ptr<std::unique_ptr<cql_server::response>>&& response, service_permit permit, cql_compression compression)
 {
-    _ready_to_respond = _ready_to_respond.then([this, compression, response = std::move(response), permit = std::move(permit)] () mutable {
-        auto message = response->make_message(_version, compression);
-        message.on_delete([response = std::move(response)] { });
-        return _write_buf.write(std::move(message)).then([this] {
-            return _write_buf.flush();
-        });
+    if (_pending_responses.push(pending_response{std::move(response), std::move(permit), compression})) {
+        schedule_response_write();
+    }
+}
+
+void cql_server::connection::schedule_response_write() {
+    _ready_to_respond = _ready_to_respond.then_wrapped([this] (future<> f) {
+        if (f.failed()) {
+            // Responses are not sent after a failed write, like with any
+            // other continuation of _ready_to_respond.
+            _pending_responses.clear();
+            return f;
+        }
+        return write_response_batch();
     });
 }
 
-scattered_message<char> cql_server::response::make_message(uint8_t version, cql_compression compression) {
+future<> cql_server::connection::write_response_batch() {
+    _pending_responses.start_write();
+    if (_pending_responses.empty()) {
+        co_return;
+    }
+    try {
+        net::packet batch;
+        size_t count = 0;
+        while (!_pending_responses.empty() && count < max_response_batch_count && batch.len() < max_response_batch_bytes) {
+            auto r = _pending_responses.pop();
+            if (r.compression != cql_compression::none) {
+                _uncompressed_bytes_sent += r.response->size();
+            }
+            auto message = r.response->make_message(_version, r.compression, _zstd_compressor.get());
+            if (r.compression != cql_compression::none) {
+                _compressed_bytes_sent += r.response->size();
+            }
+            message.on_delete([response = std::move(r.response), permit = std::move(r.permit)] { });
+            batch.append(std::move(message).release());
+            ++count;
+        }
+        ++_server._stats.response_batches;
+        _server._stats.responses_batched += count;
+        _server._stats.response_batch_bytes += batch.len();
+        co_await _write_buf.write(std::move(batch));
+        co_await _write_buf.flush();
+    } catch (...) {
+        _pending_responses.clear();
+        throw;
+    }
+    if (_pending_responses.finish_write()) {
+        schedule_response_write();
+    }
+}
+
+scattered_message<char> cql_server::response::make_message(uint8_t version, cql_compression compression, zstd_compressor* zstd) {
     if (compression != cql_compression::none) {
-        compress(compression);
+        compress(compression, zstd);
     }
     scattered_message<char> msg;
     auto frame = make_frame(version, _body.size());
@@ -1654,7 +1815,7 @@ scattered_message<char> cql_server::response::make_message(uint8_t version, cql_
     return msg;
 }
 
-void cql_server::response::compress(cql_compression compression)
+void cql_server::response::compress(cql_compression compression, zstd_compressor* zstd)
 {
     switch (compression) {
     case cql_compression::lz4:
@@ -1663,6 +1824,9 @@ void cql_server::response::compress(cql_compression compression)
     case cql_compression::snappy:
         compress_snappy();
         break;
+    case cql_compression::zstd:
+        compress_zstd(*zstd);
+        break;
     default:
         throw std::invalid_argument("Invalid CQL compression algorithm");
     }
@@ -1705,6 +1869,19 @@ void cql_server::response::compress_snappy()
     });
 }
 
+void cql_server::response::compress_zstd(zstd_compressor& zstd)
+{
+    auto input_buffer = input_buffer_guard();
+    auto output_buffer = output_buffer_guard();
+
+    auto in = input_buffer.get_linearized_view(_body);
+    auto algo = zstd.choose_algorithm();
+    size_t output_len = zstd_compressor::compress_bound(algo, in.size());
+    _body = output_buffer.make_bytes_ostream(output_len, [&zstd, algo, &in] (bytes_mutable_view out) {
+        return zstd.compress(algo, in, out);
+    });
+}
+
 void cql_server::response::serialize(const event::schema_change& event, uint8_t version)
 {
     write_string(to_string(event.change));
@@ -18,6 +18,7 @@
 #include "service/qos/qos_configuration_change_subscriber.hh"
 #include "timeout_config.hh"
 #include <seastar/core/semaphore.hh>
+#include <deque>
 #include <memory>
 #include <type_traits>
 #include <boost/intrusive/list.hpp>
@@ -70,12 +71,16 @@ namespace cql_transport {
 
 class request_reader;
 class response;
+class zstd_compressor;
+class zstd_cpu_budget;
 enum class cql_binary_opcode : uint8_t;
 
 enum class cql_compression {
     none,
     lz4,
     snappy,
+    // Negotiated with the SCYLLA_ZSTD_DICT_COMPRESSION protocol extension.
+    zstd,
 };
 
 enum cql_frame_flags {
@@ -118,6 +123,95 @@ struct cql_server_config {
     smp_service_group bounce_request_smp_service_group = default_smp_service_group();
 };
 
+/**
+ * Estimates how long a new request of a scheduling group would take to be
+ * served, from the number of requests of the group which are in flight and
+ * the rate at which they were recently completed (by Little's law).
+ *
+ * The rate is measured per scheduling group, so it reflects the shares of
+ * the group's service level, as well as everything the requests wait for
+ * (e.g. the reader concurrency semaphore).
+ */
+class queueing_delay_estimator {
+public:
+    using clock_type = lowres_clock;
+    static constexpr std::chrono::milliseconds window = std::chrono::milliseconds(100);
+    // With few requests in flight, the completion rate reflects the arrival
+    // rate rather than the capacity of the node, so the delay isn't estimated.
+    static constexpr uint32_t min_requests_in_flight = 16;
+private:
+    uint32_t _in_flight = 0;
+    uint64_t _completed_in_window = 0;
+    clock_type::time_point _window_start = clock_type::now();
+    // Exponentially weighted moving average of the completion rate, per second.
+    double _completion_rate = 0;
+
+    void maybe_close_window(clock_type::time_point now);
+public:
+    void on_request_start() noexcept {
+        ++_in_flight;
+    }
+    void on_request_finish(clock_type::time_point now) {
+        maybe_close_window(now);
+        --_in_flight;
+        ++_completed_in_window;
+    }
+    uint32_t in_flight() const noexcept {
+        return _in_flight;
+    }
+    // Returns std::nullopt if the delay can't be estimated.
+    std::optional<std::chrono::duration<double>> estimated_delay(clock_type::time_point now);
+};
+
+/**
+ * Responses of a connection which are ready to be sent, in the order they
+ * were produced.
+ *
+ * Writes are chained on the future of the connection's responses, and every
+ * write sends a single batch of bounded size. The responses which are left
+ * in the queue after a batch, or queued while it is written, are sent by
+ * another write chained after it, so the future keeps resolving while
+ * responses keep coming.
+ */
+template <typename Response>
+class response_queue {
+    std::deque<Response> _queue;
+    // Set while a write, which didn't start yet, is chained.
+    bool _write_scheduled = false;
+public:
+    // Returns true if the caller has to chain a write for the response.
+    bool push(Response r) {
+        _queue.push_back(std::move(r));
+        return !std::exchange(_write_scheduled, true);
+    }
+    // Called by a chained write when it starts, before it pops its batch.
+    void start_write() noexcept {
+        _write_scheduled = false;
+    }
+    bool empty() const noexcept {
+        return _queue.empty();
+    }
+    Response pop() {
+        auto r = std::move(_queue.front());
+        _queue.pop_front();
+        return r;
+    }
+    // Called by a write once its batch was sent. Returns true if the caller
+    // has to chain another write, for the responses left in the queue.
+    bool finish_write() noexcept {
+        if (_queue.empty() || _write_scheduled) {
+            return false;
+        }
+        _write_scheduled = true;
+        return true;
+    }
+    // Drops the queued responses, after a failed write.
+    void clear() noexcept {
+        _queue.clear();
+        _write_scheduled = false;
+    }
+};
+
 /**
  * CQL op-code stats collected for each scheduling group
  */
@@ -132,10 +226,12 @@ struct cql_sg_stats {
     request_kind_stats& get_cql_opcode_stats(cql_binary_opcode op) { return _cql_requests_stats[static_cast<uint8_t>(op)]; }
     void register_metrics();
     void rename_metrics();
+    queueing_delay_estimator& get_queueing_delay_estimator() { return _queueing_delay_estimator; }
 private:
     bool _use_metrics = false;
     seastar::metrics::metric_groups _metrics;
     std::vector<request_kind_stats> _cql_requests_stats;
+    queueing_delay_estimator _queueing_delay_estimator;
 };
 
 struct connection_service_level_params {
@@ -155,6 +251,12 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
         uint32_t requests_serving = 0;
         uint64_t requests_blocked_memory = 0;
         uint64_t requests_shed = 0;
+        // Requests shed because of the estimated queueing delay, included in requests_shed.
+        uint64_t requests_shed_queueing_delay = 0;
+        // Each batch of responses is sent with a single write and flush.
+        uint64_t response_batches = 0;
+        uint64_t responses_batched = 0;
+        uint64_t response_batch_bytes = 0;
 
         std::unordered_map<exceptions::exception_code, uint64_t> errors;
     };
@@ -167,8 +269,10 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
     cql_server_config _config;
     size_t _max_request_size;
     utils::updateable_value<uint32_t> _max_concurrent_requests;
+    utils::updateable_value<float> _queueing_delay_shedding_ratio;
     utils::updateable_value<bool> _cql_duplicate_bind_variable_names_refer_to_same_variable;
     semaphore& _memory_available;
+    std::unique_ptr<zstd_cpu_budget> _zstd_cpu_budget;
     seastar::metrics::metric_groups _metrics;
     std::unique_ptr<event_notifier> _notifier;
 private:
@@ -200,6 +304,9 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
     cql_sg_stats::request_kind_stats& get_cql_opcode_stats(cql_binary_opcode op) {
         return scheduling_group_get_specific<cql_sg_stats>(_stats_key).get_cql_opcode_stats(op);
     }
+    queueing_delay_estimator& get_queueing_delay_estimator() {
+        return scheduling_group_get_specific<cql_sg_stats>(_stats_key).get_queueing_delay_estimator();
+    }
 
     future<utils::chunked_vector<client_data>> get_client_data();
     future<> update_connections_scheduling_group();
@@ -217,6 +324,15 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
         fragmented_temporary_buffer::reader _buffer_reader;
         cql_protocol_version_type _version = 0;
         cql_compression _compression = cql_compression::none;
+        // Set if _compression is cql_compression::zstd.
+        std::unique_ptr<zstd_compressor> _zstd_compressor;
+        // The memory of the dictionary of _zstd_compressor, taken from the
+        // requests' memory for the lifetime of the connection.
+        semaphore_units<> _zstd_dict_memory;
+        // The sizes of the bodies of the responses sent on the connection,
+        // before and after compression.
+        uint64_t _uncompressed_bytes_sent = 0;
+        uint64_t _compressed_bytes_sent = 0;
         service::client_state _client_state;
         timer<lowres_clock> _shedding_timer;
         scheduling_group _current_scheduling_group;
@@ -226,6 +342,17 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
         bool _authenticating = false;
         bool _tenant_switch = false;
 
+        struct pending_response {
+            foreign_ptr<std::unique_ptr<cql_server::response>> response;
+            service_permit permit;
+            cql_compression compression;
+        };
+        // Responses which become ready while a batch is being written are
+        // sent together in the next one.
+        response_queue<pending_response> _pending_responses;
+        static constexpr size_t max_response_batch_bytes = 128 * 1024;
+        static constexpr size_t max_response_batch_count = 128;
+
         enum class tracing_request_type : uint8_t {
             not_requested,
             no_write_on_close,
@@ -259,6 +386,7 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
         future<foreign_ptr<std::unique_ptr<cql_server::response>>> process_request_one(fragmented_temporary_buffer::istream buf, uint8_t op, uint16_t stream, service::client_state& client_state, tracing_request_type tracing_request, service_permit permit);
         unsigned frame_size() const;
         unsigned pick_request_cpu();
+        bool should_shed_on_queueing_delay(uint8_t op);
         cql_binary_frame_v3 parse_frame(temporary_buffer<char> buf) const;
         future<fragmented_temporary_buffer> read_and_decompress_frame(size_t length, uint8_t flags);
         future<std::optional<cql_binary_frame_v3>> read_frame();
@@ -328,6 +456,8 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
                 tracing::trace_state_ptr trace_state, cql3::dialect dialect, cql3::computed_function_values&& cached_vals, Process process_fn);
 
         void write_response(foreign_ptr<std::unique_ptr<cql_server::response>>&& response, service_permit permit = empty_service_permit(), cql_compression compression = cql_compression::none);
+        void schedule_response_write();
+        future<> write_response_batch();
 
         friend event_notifier;
     };
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include "transport/zstd_compressor.hh"
+
+#include <seastar/core/byteorder.hh>
+
+#include "exceptions/exceptions.hh"
+#include "utils/base64.hh"
+
+namespace cql_transport {
+
+// zstd compression level, also the one the dictionaries are prepared for.
+static constexpr int zstd_compression_level = 1;
+
+static void check_zstd(size_t ret, const char* text) {
+    if (ZSTD_isError(ret)) {
+        throw std::runtime_error(fmt::format("CQL frame {} failure: {}", text, ZSTD_getErrorName(ret)));
+    }
+}
+
+// Compression contexts are reused by all connections of the shard.
+static ZSTD_CCtx& zstd_cctx() {
+    static thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> ctx(nullptr, ZSTD_freeCCtx);
+    if (!ctx) {
+        ctx.reset(ZSTD_createCCtx());
+        if (!ctx) {
+            throw std::bad_alloc();
+        }
+    }
+    return *ctx;
+}
+
+static ZSTD_DCtx& zstd_dctx() {
+    static thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> ctx(nullptr, ZSTD_freeDCtx);
+    if (!ctx) {
+        ctx.reset(ZSTD_createDCtx());
+        if (!ctx) {
+            throw std::bad_alloc();
+        }
+    }
+    return *ctx;
+}
+
+bool zstd_cpu_budget::exhausted(clock_type::time_point now) {
+    if (now >= _period_start + period) {
+        _period_start = now;
+        _used_in_period = clock_type::duration::zero();
+    }
+    auto limit = std::chrono::duration_cast<clock_type::duration>(period * _max_cpu_fraction());
+    return _used_in_period >= limit;
+}
+
+utils::dict_ptr zstd_compressor::make_dict(std::string_view base64) {
+    if (base64.empty()) {
+        return nullptr;
+    }
+    bytes data;
+    try {
+        data = base64_decode(base64);
+    } catch (const std::invalid_argument& e) {
+        throw exceptions::protocol_exception(format("Malformed zstd dictionary: {}", e.what()));
+    }
+    if (data.size() > max_dict_size) {
+        throw exceptions::protocol_exception(format("zstd dictionary too large: {} bytes, the limit is {}", data.size(), max_dict_size));
+    }
+    auto d = std::as_bytes(std::span(data.data(), data.size()));
+    return make_lw_shared(make_foreign(make_lw_shared<utils::shared_dict>(d, 0, utils::UUID(), zstd_compression_level)));
+}
+
+size_t zstd_compressor::dict_memory_usage() const noexcept {
+    auto d = dict();
+    if (!d) {
+        return 0;
+    }
+    return d->data.size() + ZSTD_sizeof_CDict(d->zstd_cdict.get()) + ZSTD_sizeof_DDict(d->zstd_ddict.get()) + sizeof(LZ4_stream_t);
+}
+
+zstd_compressor::algorithm zstd_compressor::choose_algorithm() {
+    if (_budget.exhausted(zstd_cpu_budget::clock_type::now())) {
+        _budget.note_fallback();
+        return algorithm::lz4;
+    }
+    return algorithm::zstd;
+}
+
+size_t zstd_compressor::compress_bound(algorithm algo, size_t size) {
+    switch (algo) {
+    case algorithm::zstd:
+        return 1 + ZSTD_compressBound(size);
+    case algorithm::lz4:
+        return 1 + 4 + LZ4_COMPRESSBOUND(size);
+    }
+    std::abort();
+}
+
+size_t zstd_compressor::compress(algorithm algo, bytes_view in, bytes_mutable_view out) {
+    auto dst = reinterpret_cast<char*>(out.data());
+    auto src = reinterpret_cast<const char*>(in.data());
+    dst[0] = static_cast<char>(algo);
+    switch (algo) {
+    case algorithm::zstd: {
+        auto start = zstd_cpu_budget::clock_type::now();
+        auto& cctx = zstd_cctx();
+        auto d = dict();
+        size_t ret = d
+                ? ZSTD_compress_usingCDict(&cctx, dst + 1, out.size() - 1, src, in.size(), d->zstd_cdict.get())
+                : ZSTD_compressCCtx(&cctx, dst + 1, out.size() - 1, src, in.size(), zstd_compression_level);
+        _budget.consume(zstd_cpu_budget::clock_type::now() - start);
+        check_zstd(ret, "zstd compression");
+        return 1 + ret;
+    }
+    case algorithm::lz4: {
+        write_be<uint32_t>(dst + 1, in.size());
+        auto ret = LZ4_compress_default(src, dst + 5, in.size(), out.size() - 5);
+        if (ret == 0) {
+            throw std::runtime_error("CQL frame LZ4 compression failure");
+        }
+        return 5 + static_cast<size_t>(ret);
+    }
+    }
+    std::abort();
+}
+
+size_t zstd_compressor::uncompressed_size(bytes_view in) {
+    if (in.empty()) {
+        throw std::runtime_error("CQL frame truncated: expected the compression algorithm tag");
+    }
+    auto src = reinterpret_cast<const char*>(in.data());
+    switch (algorithm(uint8_t(in[0]))) {
+    case algorithm::zstd: {
+        auto size = ZSTD_getFrameContentSize(src + 1, in.size() - 1);
+        if (size == ZSTD_CONTENTSIZE_UNKNOWN || size == ZSTD_CONTENTSIZE_ERROR) {
+            throw std::runtime_error("CQL frame zstd uncompressed size is unknown");
+        }
+        return size;
+    }
+    case algorithm::lz4:
+        if (in.size() < 5) {
+            throw std::runtime_error(fmt::format("CQL frame truncated: expected to have at least 5 bytes, got {}", in.size()));
+        }
+        return read_be<uint32_t>(src + 1);
+    }
+    throw exceptions::protocol_exception(format("Unknown compression algorithm tag: {:d}", uint8_t(in[0])));
+}
+
+void zstd_compressor::decompress(bytes_view in, bytes_mutable_view out) const {
+    auto dst = reinterpret_cast<char*>(out.data());
+    auto src = reinterpret_cast<const char*>(in.data());
+    size_t ret;
+    switch (algorithm(uint8_t(in[0]))) {
+    case algorithm::zstd: {
+        auto& dctx = zstd_dctx();
+        auto d = dict();
+        ret = d
+                ? ZSTD_decompress_usingDDict(&dctx, dst, out.size(), src + 1, in.size() - 1, d->zstd_ddict.get())
+                : ZSTD_decompressDCtx(&dctx, dst, out.size(), src + 1, in.size() - 1);
+        check_zstd(ret, "zstd decompression");
+        break;
+    }
+    case algorithm::lz4: {
+        auto lz4_ret = LZ4_decompress_safe(src + 5, dst, in.size() - 5, out.size());
+        if (lz4_ret < 0) {
+            throw std::runtime_error("CQL frame LZ4 uncompression failure");
+        }
+        ret = static_cast<size_t>(lz4_ret);
+        break;
+    }
+    default:
+        throw exceptions::protocol_exception(format("Unknown compression algorithm tag: {:d}", uint8_t(in[0])));
+    }
+    if (ret != out.size()) {
+        throw std::runtime_error("Malformed CQL frame - provided uncompressed size different than real uncompressed size");
+    }
+}
+
+} // namespace cql_transport
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <chrono>
+
+#include "bytes.hh"
+#include "utils/advanced_rpc_compressor.hh"
+#include "utils/shared_dict.hh"
+#include "utils/updateable_value.hh"
+
+namespace cql_transport {
+
+// Limits the CPU time spent on zstd compression of CQL frames on a shard.
+//
+// zstd compresses much better than lz4, especially with a dictionary, but
+// it is also several times slower. When a shard spends more than the
+// configured fraction of a period compressing with zstd, the connections
+// fall back to lz4 until the period ends.
+class zstd_cpu_budget {
+public:
+    using clock_type = std::chrono::steady_clock;
+    static constexpr std::chrono::milliseconds period = std::chrono::milliseconds(20);
+private:
+    utils::updateable_value<float> _max_cpu_fraction;
+    clock_type::time_point _period_start;
+    clock_type::duration _used_in_period = clock_type::duration::zero();
+    uint64_t _fallbacks = 0;
+public:
+    explicit zstd_cpu_budget(utils::updateable_value<float> max_cpu_fraction)
+        : _max_cpu_fraction(std::move(max_cpu_fraction))
+    {}
+
+    bool exhausted(clock_type::time_point now);
+    void consume(clock_type::duration d) {
+        _used_in_period += d;
+    }
+    void note_fallback() noexcept {
+        ++_fallbacks;
+    }
+
+    // The number of frames compressed with lz4 because the budget was exhausted.
+    uint64_t fallbacks() const noexcept {
+        return _fallbacks;
+    }
+};
+
+// Compresses the bodies of CQL frames of a connection which negotiated
+// the SCYLLA_ZSTD_DICT_COMPRESSION protocol extension.
+//
+// A compressed body starts with a byte which tags the algorithm used for
+// the rest of it:
+//  - algorithm::zstd: a zstd frame, which records its content size,
+//    compressed with the dictionary of the connection, if it has one.
+//  - algorithm::lz4: the 4-byte big-endian uncompressed length, followed
+//    by an LZ4 block, like with the plain lz4 compression. The server
+//    sends these when its zstd_cpu_budget is exhausted.
+//
+// The dictionary is supplied by the client in the STARTUP message and is
+// used only by its connection. The server never hands out dictionaries of
+// its own: those are trained on the data of all the users of the cluster.
+class zstd_compressor {
+public:
+    enum class algorithm : uint8_t {
+        zstd = 1,
+        lz4 = 2,
+    };
+    // The largest dictionary a client can send. Its base64 encoding has to
+    // fit in a [string] of the STARTUP message, which is at most 65535 bytes
+    // long. base64 encodes every 3 bytes with 4 characters.
+    static constexpr size_t max_dict_size = 65535 / 4 * 3;
+private:
+    zstd_cpu_budget& _budget;
+    utils::dict_ptr _dict;
+public:
+    zstd_compressor(zstd_cpu_budget& budget, utils::dict_ptr dict)
+        : _budget(budget)
+        , _dict(std::move(dict))
+    {}
+
+    // Makes the dictionary of a connection from the base64-encoded value of
+    // the SCYLLA_ZSTD_DICT_COMPRESSION option of the STARTUP message.
+    // Returns nullptr for an empty value.
+    static utils::dict_ptr make_dict(std::string_view base64);
+
+    // The dictionary the connection compresses with, nullptr if none.
+    const utils::shared_dict* dict() const noexcept {
+        return _dict ? &**_dict : nullptr;
+    }
+    // The memory used by the dictionary, with the tables built from it.
+    size_t dict_memory_usage() const noexcept;
+
+    // Picks the algorithm for the next body sent, depending on the budget.
+    algorithm choose_algorithm();
+
+    static size_t compress_bound(algorithm algo, size_t size);
+    // Compresses `in` with `algo` into `out`, which has to be at least
+    // compress_bound() bytes long. Returns the size of the compressed body.
+    size_t compress(algorithm algo, bytes_view in, bytes_mutable_view out);
+
+    // Returns the uncompressed size of the body, as recorded in it.
+    static size_t uncompressed_size(bytes_view in);
+    // Decompresses `in` into `out`, which is uncompressed_size(in) bytes long.
+    void decompress(bytes_view in, bytes_mutable_view out) const;
+};
+
+} // namespace cql_transport
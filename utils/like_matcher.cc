@@ -9,10 +9,20 @@
 
 
 #include "like_matcher.hh"
+#include "utils/utf8.hh"
 
 #include <boost/regex/icu.hpp>
 #include <boost/locale/encoding.hpp>
+#include <algorithm>
+#include <cstring>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
 
 namespace {
 
@@ -75,33 +85,305 @@ wstring regex_from_pattern(bytes_view pattern) {
     return re;
 }
 
+std::string_view as_string_view(bytes_view b) {
+    return std::string_view(reinterpret_cast<const char*>(b.data()), b.size());
+}
+
+bool is_utf8_continuation(int8_t c) {
+    return (uint8_t(c) & 0xc0) == 0x80;
+}
+
+/// Returns the position of the first occurrence of needle in haystack, or npos.
+size_t find_substring(bytes_view haystack, bytes_view needle) {
+    const size_t n = needle.size();
+    if (n <= 1 || haystack.size() < n) {
+        return as_string_view(haystack).find(as_string_view(needle));
+    }
+    size_t i = 0;
+#ifdef __x86_64__
+    // Compare the first and the last byte of the needle with 16 candidate
+    // positions at a time, and only verify the rest of the needle where both
+    // match (W. Muła, "SIMD-friendly algorithms for substring searching").
+    const auto* data = reinterpret_cast<const char*>(haystack.data());
+    const auto* ndata = reinterpret_cast<const char*>(needle.data());
+    const __m128i first = _mm_set1_epi8(ndata[0]);
+    const __m128i last = _mm_set1_epi8(ndata[n - 1]);
+    for (; i + n - 1 + 16 <= haystack.size(); i += 16) {
+        const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + n - 1));
+        unsigned mask = _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(first, block_first),
+                _mm_cmpeq_epi8(last, block_last)));
+        while (mask) {
+            const unsigned bit = __builtin_ctz(mask);
+            if (std::memcmp(data + i + bit + 1, ndata + 1, n - 2) == 0) {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    return as_string_view(haystack).find(as_string_view(needle), i);
+}
+
+/// A part of a LIKE pattern between two '%' wildcards: literal runs, each
+/// followed by some number of '_' wildcards.
+struct segment {
+    struct run {
+        bytes literal;
+        unsigned any_chars = 0;
+    };
+    std::vector<run> runs;
+
+    bool empty() const {
+        return runs.empty();
+    }
+
+    /// True iff the segment has no '_' wildcards.
+    bool is_literal() const {
+        return runs.size() <= 1 && (runs.empty() || runs.front().any_chars == 0);
+    }
+
+    bytes_view literal() const {
+        return runs.empty() ? bytes_view() : bytes_view(runs.front().literal);
+    }
+
+    /// Matches the segment against text starting at pos. Returns the
+    /// position right after the match, or nullopt.
+    std::optional<size_t> match_forward(bytes_view text, size_t pos) const {
+        for (const auto& r : runs) {
+            if (text.size() - pos < r.literal.size()
+                    || std::memcmp(text.data() + pos, r.literal.data(), r.literal.size()) != 0) {
+                return std::nullopt;
+            }
+            pos += r.literal.size();
+            for (unsigned i = 0; i < r.any_chars; ++i) {
+                if (pos == text.size()) {
+                    return std::nullopt;
+                }
+                ++pos;
+                while (pos < text.size() && is_utf8_continuation(text[pos])) {
+                    ++pos;
+                }
+            }
+        }
+        return pos;
+    }
+
+    /// Matches the segment against text ending at end. Returns the position
+    /// where the match starts, or nullopt.
+    std::optional<size_t> match_backward(bytes_view text, size_t end) const {
+        for (auto r = runs.rbegin(); r != runs.rend(); ++r) {
+            for (unsigned i = 0; i < r->any_chars; ++i) {
+                if (end == 0) {
+                    return std::nullopt;
+                }
+                --end;
+                while (end > 0 && is_utf8_continuation(text[end])) {
+                    --end;
+                }
+            }
+            if (end < r->literal.size()
+                    || std::memcmp(text.data() + end - r->literal.size(), r->literal.data(), r->literal.size()) != 0) {
+                return std::nullopt;
+            }
+            end -= r->literal.size();
+        }
+        return end;
+    }
+
+    /// Finds the leftmost match of the segment in text, starting at pos or
+    /// later. Returns the position right after the match, or nullopt.
+    std::optional<size_t> find(bytes_view text, size_t pos) const {
+        auto first_literal = literal();
+        if (first_literal.empty()) {
+            // Starts with '_': try every character boundary.
+            for (; pos <= text.size(); ++pos) {
+                if (pos < text.size() && is_utf8_continuation(text[pos])) {
+                    continue;
+                }
+                if (auto end = match_forward(text, pos)) {
+                    return end;
+                }
+            }
+            return std::nullopt;
+        }
+        // Matches of the first literal always start at a character boundary,
+        // since the literal starts with a whole UTF-8 character.
+        while (pos <= text.size()) {
+            auto found = find_substring(text.substr(pos), first_literal);
+            if (found == bytes_view::npos) {
+                return std::nullopt;
+            }
+            pos += found;
+            if (auto end = match_forward(text, pos)) {
+                return end;
+            }
+            ++pos;
+        }
+        return std::nullopt;
+    }
+};
+
+/// Splits a LIKE pattern into segments separated by '%' wildcards.
+std::vector<segment> parse_pattern(bytes_view pattern) {
+    std::vector<segment> segments(1);
+    bool escaping = false;
+    auto add_literal = [&] (int8_t c) {
+        auto& runs = segments.back().runs;
+        if (runs.empty() || runs.back().any_chars) {
+            runs.emplace_back();
+        }
+        runs.back().literal.push_back(c);
+    };
+    for (auto c : pattern) {
+        if (escaping) {
+            add_literal(c);
+            escaping = false;
+        } else if (c == '\\') {
+            escaping = true;
+        } else if (c == '%') {
+            segments.emplace_back();
+        } else if (c == '_') {
+            auto& runs = segments.back().runs;
+            if (runs.empty()) {
+                runs.emplace_back();
+            }
+            ++runs.back().any_chars;
+        } else {
+            add_literal(c);
+        }
+    }
+    if (escaping) {
+        // An unescaped backslash at the end matches itself.
+        add_literal('\\');
+    }
+    return segments;
+}
+
 } // anonymous namespace
 
 class like_matcher::impl {
+    // Patterns common enough to deserve a fast path, with the rest matched
+    // segment by segment.
+    enum class kind {
+        exact,     // "abc"
+        prefix,    // "abc%"
+        suffix,    // "%abc"
+        substring, // "%abc%"
+        any,       // "%"
+        general,
+        regex,     // fallback for patterns which aren't valid UTF-8
+    };
     bytes _pattern;
-    boost::u32regex _re; // Performs pattern matching.
+    kind _kind;
+    // For the general kind: the first segment is anchored at the start of
+    // the text, the last one at the end, and the (non-empty) middle ones are
+    // matched leftmost-first. For other kinds, the literal is in _segments.front().
+    std::vector<segment> _segments;
+    std::optional<boost::u32regex> _re;
   public:
     explicit impl(bytes_view pattern);
     bool operator()(bytes_view text) const;
     void reset(bytes_view pattern);
   private:
-    void init_re() {
-        _re = boost::make_u32regex(regex_from_pattern(_pattern), boost::u32regex::basic | boost::u32regex::optimize);
-    }
+    void init();
+    bool match_general(bytes_view text) const;
 };
 
 like_matcher::impl::impl(bytes_view pattern) : _pattern(pattern) {
-    init_re();
+    init();
+}
+
+void like_matcher::impl::init() {
+    _re.reset();
+    _segments.clear();
+    if (!utils::utf8::validate(_pattern)) {
+        // Let the regex engine report the error.
+        _kind = kind::regex;
+        _re = boost::make_u32regex(regex_from_pattern(_pattern), boost::u32regex::basic | boost::u32regex::optimize);
+        return;
+    }
+    auto segments = parse_pattern(_pattern);
+    const bool all_literal = std::ranges::all_of(segments, &segment::is_literal);
+    if (all_literal && segments.size() == 1) {
+        _kind = kind::exact;
+    } else if (all_literal && segments.size() == 2 && segments[1].empty()) {
+        _kind = kind::prefix;
+    } else if (all_literal && segments.size() == 2 && segments[0].empty()) {
+        _kind = kind::suffix;
+        segments.front() = std::move(segments.back());
+    } else if (std::ranges::all_of(segments, &segment::empty)) {
+        _kind = kind::any;
+    } else if (all_literal && segments.size() == 3 && segments[0].empty() && segments[2].empty()) {
+        _kind = kind::substring;
+        segments.front() = std::move(segments[1]);
+    } else {
+        _kind = kind::general;
+        // Consecutive '%' are equivalent to a single one, so empty middle
+        // segments can be dropped.
+        std::vector<segment> nonempty;
+        for (size_t i = 0; i < segments.size(); ++i) {
+            if (i == 0 || i + 1 == segments.size() || !segments[i].empty()) {
+                nonempty.push_back(std::move(segments[i]));
+            }
+        }
+        segments = std::move(nonempty);
+    }
+    if (_kind != kind::general) {
+        segments.resize(1);
+    }
+    _segments = std::move(segments);
+}
+
+bool like_matcher::impl::match_general(bytes_view text) const {
+    auto pos = _segments.front().match_forward(text, 0);
+    if (!pos) {
+        return false;
+    }
+    if (_segments.size() == 1) {
+        return *pos == text.size();
+    }
+    auto last_start = _segments.back().match_backward(text, text.size());
+    if (!last_start || *last_start < *pos) {
+        return false;
+    }
+    // Leftmost matches of the middle segments leave the most room for the
+    // following ones, so there's no need to backtrack.
+    auto middle = text.substr(0, *last_start);
+    for (size_t i = 1; i + 1 < _segments.size(); ++i) {
+        pos = _segments[i].find(middle, *pos);
+        if (!pos) {
+            return false;
+        }
+    }
+    return true;
 }
 
 bool like_matcher::impl::operator()(bytes_view text) const {
-    return boost::u32regex_match(text.begin(), text.end(), _re);
+    switch (_kind) {
+    case kind::exact:
+        return text == _segments.front().literal();
+    case kind::prefix:
+        return text.starts_with(_segments.front().literal());
+    case kind::suffix:
+        return text.ends_with(_segments.front().literal());
+    case kind::substring:
+        return find_substring(text, _segments.front().literal()) != bytes_view::npos;
+    case kind::any:
+        return true;
+    case kind::general:
+        return match_general(text);
+    case kind::regex:
+        return boost::u32regex_match(text.begin(), text.end(), *_re);
+    }
+    std::abort();
 }
 
 void like_matcher::impl::reset(bytes_view pattern) {
     if (pattern != _pattern) {
         _pattern = bytes(pattern);
-        init_re();
+        init();
     }
 }
 
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2025-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include <seastar/core/byteorder.hh>
+
+#include "bytes.hh"
+#include "seastarx.hh"
+
+namespace utils {
+
+/// A mergeable sketch of a distribution of doubles, answering approximate
+/// quantile queries (Dunning & Ertl, "Computing extremely accurate quantiles
+/// using t-digests").
+///
+/// Values are collected into a buffer, which is periodically merged into a
+/// sorted list of centroids. Centroids near the tails of the distribution are
+/// kept small, so extreme quantiles (p99, p999) are estimated much more
+/// accurately than the median. The number of centroids is bounded by
+/// O(compression), regardless of the number of values.
+///
+/// Digests can be serialized to a compact binary form and merged, so partial
+/// digests computed independently (e.g. on different shards) can be combined
+/// into a digest of the union of their inputs.
+class tdigest {
+public:
+    struct centroid {
+        double mean;
+        double weight;
+    };
+    static constexpr double default_compression = 200;
+private:
+    double _compression;
+    std::vector<centroid> _centroids; // sorted by mean
+    std::vector<double> _buffer; // values not merged into _centroids yet
+    double _total_weight = 0;
+    double _min = std::numeric_limits<double>::infinity();
+    double _max = -std::numeric_limits<double>::infinity();
+
+    size_t buffer_capacity() const {
+        return size_t(_compression) * 2;
+    }
+
+    // Scale function k1 from the paper. It maps quantiles to a scale on which
+    // every centroid may span at most 1 unit, so centroids are small near the
+    // tails and the total count is bounded by the compression.
+    double scale(double q) const {
+        return _compression / (2 * std::numbers::pi) * std::asin(2 * q - 1);
+    }
+
+    // Sorts `all` and combines neighbouring centroids into _centroids, as long
+    // as every resulting centroid spans at most 1 unit of scale().
+    void merge_centroids(std::vector<centroid> all) {
+        std::ranges::sort(all, std::less<>(), &centroid::mean);
+        _centroids.clear();
+        double weight_so_far = 0;
+        double k_left = scale(0);
+        centroid cur = all.front();
+        for (size_t i = 1; i < all.size(); ++i) {
+            const auto& next = all[i];
+            const double proposed = cur.weight + next.weight;
+            if (scale(std::min(1.0, (weight_so_far + proposed) / _total_weight)) - k_left <= 1) {
+                cur.mean += (next.mean - cur.mean) * next.weight / proposed;
+                cur.weight = proposed;
+            } else {
+                weight_so_far += cur.weight;
+                k_left = scale(std::min(1.0, weight_so_far / _total_weight));
+                _centroids.push_back(cur);
+                cur = next;
+            }
+        }
+        _centroids.push_back(cur);
+    }
+
+    // Merges the buffer into the centroid list.
+    void compress() {
+        if (_buffer.empty()) {
+            return;
+        }
+        std::vector<centroid> all;
+        all.reserve(_centroids.size() + _buffer.size());
+        all.insert(all.end(), _centroids.begin(), _centroids.end());
+        for (auto v : _buffer) {
+            all.push_back(centroid{v, 1});
+        }
+        _buffer.clear();
+        merge_centroids(std::move(all));
+    }
+
+    static double interpolate(double x0, double x1, double fraction) {
+        return x0 + (x1 - x0) * fraction;
+    }
+
+    static void write_double(bytes::iterator& out, double v) {
+        uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        write_le<uint64_t>(reinterpret_cast<char*>(&*out), bits);
+        out += sizeof(bits);
+    }
+
+    static double read_double(bytes_view& in) {
+        if (in.size() < sizeof(uint64_t)) {
+            throw std::runtime_error("truncated t-digest");
+        }
+        auto bits = read_le<uint64_t>(reinterpret_cast<const char*>(in.data()));
+        in.remove_prefix(sizeof(bits));
+        double v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+public:
+    explicit tdigest(double compression = default_compression)
+        : _compression(compression) {
+        if (!(compression >= 10)) {
+            throw std::invalid_argument("t-digest compression must be at least 10");
+        }
+    }
+
+    void add(double value) {
+        if (std::isnan(value)) {
+            return;
+        }
+        _buffer.push_back(value);
+        _total_weight += 1;
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+        if (_buffer.size() >= buffer_capacity()) {
+            compress();
+        }
+    }
+
+    void merge(const tdigest& other) {
+        if (other.empty()) {
+            return;
+        }
+        std::vector<centroid> all;
+        all.reserve(_centroids.size() + other._centroids.size() + _buffer.size() + other._buffer.size());
+        all.insert(all.end(), _centroids.begin(), _centroids.end());
+        all.insert(all.end(), other._centroids.begin(), other._centroids.end());
+        for (auto v : _buffer) {
+            all.push_back(centroid{v, 1});
+        }
+        for (auto v : other._buffer) {
+            all.push_back(centroid{v, 1});
+        }
+        _buffer.clear();
+        _total_weight += other._total_weight;
+        _min = std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+        merge_centroids(std::move(all));
+    }
+
+    bool empty() const {
+        return _total_weight == 0;
+    }
+
+    double total_weight() const {
+        return _total_weight;
+    }
+
+    /// Estimates the value at quantile q, which must be in [0, 1].
+    /// Returns NaN if the digest is empty.
+    double quantile(double q) {
+        if (q < 0 || q > 1) {
+            throw std::out_of_range("quantile must be between 0 and 1");
+        }
+        compress();
+        if (_centroids.empty()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (_centroids.size() == 1) {
+            return _centroids.front().mean;
+        }
+        const double index = q * _total_weight;
+        if (index <= 0) {
+            return _min;
+        }
+        if (index >= _total_weight) {
+            return _max;
+        }
+        // Each centroid's mass is assumed to be centered at its mean; values
+        // between the centers of neighbouring centroids are interpolated.
+        const auto& first = _centroids.front();
+        if (index < first.weight / 2) {
+            return interpolate(_min, first.mean, index / (first.weight / 2));
+        }
+        double weight_so_far = first.weight / 2;
+        for (size_t i = 0; i + 1 < _centroids.size(); ++i) {
+            const auto& a = _centroids[i];
+            const auto& b = _centroids[i + 1];
+            const double step = (a.weight + b.weight) / 2;
+            if (index < weight_so_far + step) {
+                return interpolate(a.mean, b.mean, (index - weight_so_far) / step);
+            }
+            weight_so_far += step;
+        }
+        const auto& last = _centroids.back();
+        const double tail = _total_weight - weight_so_far;
+        return interpolate(last.mean, _max, tail > 0 ? (index - weight_so_far) / tail : 1);
+    }
+
+    /// Serializes the digest, including values not merged into centroids yet.
+    /// The serialized size is bounded by O(compression). A round trip through
+    /// the serialized form costs O(compression) too, so callers adding many
+    /// values to a serialized digest should batch them.
+    bytes serialize() const {
+        bytes ret(bytes::initialized_later(), sizeof(uint64_t) * (5 + 2 * _centroids.size() + _buffer.size()));
+        auto out = ret.begin();
+        write_double(out, _compression);
+        write_double(out, _total_weight);
+        write_double(out, _min);
+        write_double(out, _max);
+        write_le<uint64_t>(reinterpret_cast<char*>(&*out), _centroids.size());
+        out += sizeof(uint64_t);
+        for (const auto& c : _centroids) {
+            write_double(out, c.mean);
+            write_double(out, c.weight);
+        }
+        for (auto v : _buffer) {
+            write_double(out, v);
+        }
+        return ret;
+    }
+
+    static tdigest deserialize(bytes_view in) {
+        tdigest ret(read_double(in));
+        ret._total_weight = read_double(in);
+        ret._min = read_double(in);
+        ret._max = read_double(in);
+        if (in.size() < sizeof(uint64_t)) {
+            throw std::runtime_error("truncated t-digest");
+        }
+        auto centroid_count = read_le<uint64_t>(reinterpret_cast<const char*>(in.data()));
+        in.remove_prefix(sizeof(uint64_t));
+        if (in.size() % sizeof(uint64_t) || in.size() / sizeof(uint64_t) < 2 * centroid_count) {
+            throw std::runtime_error("malformed t-digest");
+        }
+        ret._centroids.reserve(centroid_count);
+        for (uint64_t i = 0; i < centroid_count; ++i) {
+            auto mean = read_double(in);
+            auto weight = read_double(in);
+            ret._centroids.push_back(centroid{mean, weight});
+        }
+        ret._buffer.reserve(in.size() / sizeof(uint64_t));
+        while (!in.empty()) {
+            ret._buffer.push_back(read_double(in));
+        }
+        return ret;
+    }
+};
+
+} // namespace utils